@@ -0,0 +1,110 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Parameters sorted by their SY1000 address, built once from the parameter table.
+// Addresses are 4 bytes of 7 bit (0x10001500 for "10001500"). For range walks they are converted to a
+// linear number, so the address after 0x1000157F is 0x10001600.
+// REGISTERBIT parameters have no address of their own and are not indexed.
+// The layout is also kept as a flat array per parameter index for the write planning of many parameters.
+class SY1000AddressIndex
+{
+public:
+
+    struct Entry
+    {
+        juce::uint32 linearAddress = 0;
+        int dataBytes = 0;
+        int parameterIndex = -1;
+        SY1000Parameter::ParameterType parameterType = SY1000Parameter::SINGLE;
+        int valueOffset = 0;           // device value = parameter value + valueOffset (minValue of choice parameters)
+    };
+
+    SY1000AddressIndex(const SY1000Parameter& parameter)
+    {
+        mLayout.resize(parameter.size());
+        for (int i = 0; i < (int)parameter.size(); i++)
+        {
+            const SY1000Parameter::Data& data = parameter.getParameterData(i);
+            juce::uint32 address = 0;
+            Entry entry;
+            entry.parameterIndex = i;
+            entry.parameterType = data.parameterType;
+            if (data.parameterType != SY1000Parameter::REGISTERBIT && parseHexAddress(data.hexAddress, address))
+            {
+                entry.linearAddress = toLinear(address);
+                entry.dataBytes = data.dataBytes;
+                entry.valueOffset = data.choices.size() > 0 ? data.minValue : 0;
+                mEntries.push_back(entry);
+            }
+            mLayout[(size_t)i] = entry;
+        }
+        // stable, so parameters sharing one address keep their table order
+        std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry& a, const Entry& b) { return a.linearAddress < b.linearAddress; });
+    }
+
+    static juce::uint32 toLinear(juce::uint32 address)
+    {
+        return SY1000Parameter::toLinearAddress(address);
+    }
+
+    static juce::uint32 fromLinear(juce::uint32 linearAddress)
+    {
+        return SY1000Parameter::fromLinearAddress(linearAddress);
+    }
+
+    // "10001500" -> 0x10001500, false if the text is not an 8 digit address
+    static bool parseHexAddress(const juce::String& hexAddress, juce::uint32& address)
+    {
+        if (hexAddress.length() != 8 || !hexAddress.containsOnly("0123456789abcdefABCDEF"))
+            return false;
+        address = (juce::uint32)hexAddress.getHexValue32();
+        return true;
+    }
+
+    // All entries at this linear address, in table order
+    std::pair<const Entry*, const Entry*> findAll(juce::uint32 linearAddress) const
+    {
+        auto range = std::equal_range(mEntries.begin(), mEntries.end(), Entry { linearAddress },
+                                      [](const Entry& a, const Entry& b) { return a.linearAddress < b.linearAddress; });
+        if (range.first == range.second)
+            return { nullptr, nullptr };
+        return { &*range.first, &*range.first + (range.second - range.first) };
+    }
+
+    // Index of the parameter at this address with this width and type, -1 if there is none
+    int findParameter(juce::uint32 address, int dataBytes, SY1000Parameter::ParameterType parameterType) const
+    {
+        auto range = findAll(toLinear(address));
+        for (auto* entry = range.first; entry != range.second; ++entry)
+        {
+            if (entry->dataBytes == dataBytes && entry->parameterType == parameterType)
+                return entry->parameterIndex;
+        }
+        return -1;
+    }
+
+    // All indexed parameters in address order
+    const std::vector<Entry>& getEntries() const
+    {
+        return mEntries;
+    }
+
+    // Address layout of one parameter, dataBytes is 0 for parameters without an address
+    const Entry& getLayout(int parameterIndex) const
+    {
+        return mLayout[(size_t)parameterIndex];
+    }
+
+    // Parameters that own their device address (DUALBPM is the virtual part of a DUALTIME value)
+    bool isWritable(int parameterIndex) const
+    {
+        const Entry& entry = mLayout[(size_t)parameterIndex];
+        return entry.dataBytes > 0 && (entry.parameterType == SY1000Parameter::SINGLE || entry.parameterType == SY1000Parameter::DUALTIME || entry.parameterType == SY1000Parameter::REGISTER);
+    }
+
+private:
+
+    std::vector<Entry> mEntries;
+    std::vector<Entry> mLayout;
+};
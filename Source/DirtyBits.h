@@ -0,0 +1,48 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Lock-free "value changed" flag per parameter. The incoming and outgoing paths set bits from any thread,
+// the editor takes and clears all bits once per frame, so the UI work scales with the number of changed
+// parameters and not with the number of change events.
+class SY1000DirtyBits
+{
+public:
+
+    SY1000DirtyBits(size_t numBits)
+        : mNumWords((numBits + 63) / 64), mWords(new std::atomic<juce::uint64>[mNumWords])
+    {
+        for (size_t i = 0; i < mNumWords; i++)
+            mWords[i] = 0;
+    }
+
+    void set(int index)
+    {
+        if (index >= 0 && (size_t)(index / 64) < mNumWords)
+            mWords[(size_t)(index / 64)].fetch_or((juce::uint64)1 << (index % 64));
+    }
+
+    void setAll()
+    {
+        for (size_t i = 0; i < mNumWords; i++)
+            mWords[i] = ~(juce::uint64)0;
+    }
+
+    // Copy all bits into snapshot and clear them
+    void takeAll(std::vector<juce::uint64>& snapshot)
+    {
+        snapshot.resize(mNumWords);
+        for (size_t i = 0; i < mNumWords; i++)
+            snapshot[i] = mWords[i].exchange(0);
+    }
+
+    static bool isSet(const std::vector<juce::uint64>& snapshot, int index)
+    {
+        return index >= 0 && (size_t)(index / 64) < snapshot.size()
+            && (snapshot[(size_t)(index / 64)] & ((juce::uint64)1 << (index % 64))) != 0;
+    }
+
+private:
+
+    size_t mNumWords;
+    std::unique_ptr<std::atomic<juce::uint64>[]> mWords;
+};
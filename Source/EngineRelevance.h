@@ -0,0 +1,134 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Dependency model from the engine type selectors to the parameter groups they activate.
+// INST1/2/3 carry the parameters of every INST TYPE (DYNAMIC SYNTH, OSC SYNTH, ...) and FX1/2/3 those of
+// every FX TYPE, but only the group selected by the type parameter is audible. Writes to the other groups
+// are deferred and sent when the type selector activates their group.
+// The selector values and the deferred flags are atomics: the audio thread (incoming DT1, morph, modulation,
+// macros) and the message thread (editor, state restore) change them concurrently.
+class SY1000EngineRelevance
+{
+public:
+
+    SY1000EngineRelevance(const SY1000Parameter& parameter)
+    {
+        int numParameters = (int)parameter.size();
+        mGroupOf.assign((size_t)numParameters, -1);
+        mChoiceOf.assign((size_t)numParameters, -1);
+        mSelectorIndex.assign((size_t)numParameters, -1);
+        mDeferred.reset(new std::atomic<bool>[(size_t)numParameters]);
+        for (int i = 0; i < numParameters; i++)
+            mDeferred[(size_t)i] = false;
+
+        for (int i = 0; i < numParameters; i++)
+        {
+            const SY1000Parameter::Data& selectorData = parameter.getParameterData(i);
+            juce::String leaf = selectorData.parameterName.fromLastOccurrenceOf("/", false, false);
+            if (!mSelectorNames.contains(leaf) || selectorData.choices.size() == 0)
+                continue;
+
+            // "INST1/COMMON/INST TYPE" selects "INST1/<INST TYPE>/...", "EFFECTS/FX1/FX TYPE" selects "EFFECTS/FX1/<FX TYPE>/..."
+            juce::String groupRoot = selectorData.parameterName.upToLastOccurrenceOf("/", false, false);
+            if (groupRoot.endsWith("/COMMON"))
+                groupRoot = groupRoot.upToLastOccurrenceOf("/", false, false);
+
+            Selector selector;
+            selector.parameterIndex = i;
+            selector.defaultValue = selectorData.defaultValue;
+            int selectorNumber = (int)mSelectors.size();
+
+            for (int j = 0; j < numParameters; j++)
+            {
+                const juce::String& name = parameter.getParameterData(j).parameterName;
+                if (!name.startsWith(groupRoot + "/"))
+                    continue;
+                juce::String group = name.substring(groupRoot.length() + 1).upToFirstOccurrenceOf("/", false, false);
+                int choice = selectorData.choices.indexOf(group);
+                if (choice >= 0 && name.length() > groupRoot.length() + group.length() + 1)
+                {
+                    mGroupOf[(size_t)j] = selectorNumber;
+                    mChoiceOf[(size_t)j] = choice;
+                    selector.members.push_back(j);
+                }
+            }
+            mSelectorIndex[(size_t)i] = selectorNumber;
+            mSelectors.push_back(selector);
+        }
+
+        mSelectorValue.reset(new std::atomic<int>[mSelectors.size()]);
+        for (size_t i = 0; i < mSelectors.size(); i++)
+            mSelectorValue[i] = mSelectors[i].defaultValue;
+    }
+
+    bool isSelector(int parameterIndex) const
+    {
+        return mSelectorIndex[(size_t)parameterIndex] >= 0;
+    }
+
+    // true if the parameter belongs to no engine group or to the group selected right now
+    bool isRelevant(int parameterIndex) const
+    {
+        int group = mGroupOf[(size_t)parameterIndex];
+        if (group < 0)
+            return true;
+        return mSelectorValue[(size_t)group].load() == mChoiceOf[(size_t)parameterIndex];
+    }
+
+    // Returns false if a selector change of another thread made the parameter relevant meanwhile, then the
+    // parameter is not deferred and the caller sends it.
+    bool defer(int parameterIndex)
+    {
+        mDeferred[(size_t)parameterIndex] = true;
+        if (!isRelevant(parameterIndex))
+            return true;
+        // the activation scan may have missed the flag, exactly one side takes it back
+        return !mDeferred[(size_t)parameterIndex].exchange(false);
+    }
+
+    // Set the selector choice index. Returns the deferred parameters that became relevant by this change,
+    // the caller sends their current values.
+    std::vector<int> setSelectorValue(int parameterIndex, int choiceIndex)
+    {
+        std::vector<int> activated;
+        int selectorNumber = mSelectorIndex[(size_t)parameterIndex];
+        if (selectorNumber < 0)
+            return activated;
+
+        if (mSelectorValue[(size_t)selectorNumber].exchange(choiceIndex) == choiceIndex)
+            return activated;
+
+        for (int member : mSelectors[(size_t)selectorNumber].members)
+        {
+            if (isRelevant(member) && mDeferred[(size_t)member].exchange(false))
+                activated.push_back(member);
+        }
+        return activated;
+    }
+
+    // Forget all deferred writes, e.g. after the device sent a complete patch
+    void clearDeferred()
+    {
+        for (size_t i = 0; i < mGroupOf.size(); i++)
+            mDeferred[i] = false;
+    }
+
+private:
+
+    struct Selector
+    {
+        int parameterIndex = -1;
+        int defaultValue = 0;
+        std::vector<int> members;
+    };
+
+    const juce::StringArray mSelectorNames = { "INST TYPE", "FX TYPE" };
+
+    std::vector<Selector> mSelectors;
+    std::vector<int> mSelectorIndex;
+    std::vector<int> mGroupOf;
+    std::vector<int> mChoiceOf;
+    std::unique_ptr<std::atomic<int>[]> mSelectorValue;    // choice index of every selector
+    std::unique_ptr<std::atomic<bool>[]> mDeferred;
+};
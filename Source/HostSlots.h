@@ -0,0 +1,205 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Which SY1000 parameters the host sees. ALL_PARAMETERS registers every table parameter (host parameter
+// index = SY1000Param index). SLOTS registers only a fixed pool of host slots, each one remappable to any
+// table parameter; the other parameters live only in the plugin's value store and are saved with the state.
+// The mode decides the host parameter count, so it is a global setting that applies to the next plugin load.
+class SY1000HostSlots
+{
+public:
+
+    enum Mode { ALL_PARAMETERS, SLOTS };
+
+    static constexpr int numSlots = 128;
+
+    SY1000HostSlots(const SY1000Parameter& parameter, Mode mode)
+        : mParameter(parameter), mMode(mode), mParameterSlot(new std::atomic<int>[parameter.size()])
+    {
+        for (auto& slotParameter : mSlotParameter)
+            slotParameter = -1;
+        for (size_t i = 0; i < parameter.size(); i++)
+            mParameterSlot[i] = -1;
+    }
+
+    Mode getMode() const            { return mMode; }
+    bool isSlotMode() const         { return mMode == SLOTS; }
+
+    // Host parameters for the SY1000 parameters, the macros follow them
+    int getNumDeviceHostParameters() const
+    {
+        return isSlotMode() ? numSlots : (int)mParameter.size();
+    }
+
+    static juce::String getParameterID(int slot)
+    {
+        return "slot" + juce::String(slot + 1);
+    }
+
+    // SY1000Param index of the slot, -1 if unmapped
+    int getSlotParameter(int slot) const
+    {
+        return juce::isPositiveAndBelow(slot, numSlots) ? mSlotParameter[(size_t)slot].load() : -1;
+    }
+
+    // Slot of the parameter, -1 if not exposed
+    int getSlot(int parameterIndex) const
+    {
+        return isValidIndex(parameterIndex) ? mParameterSlot[(size_t)parameterIndex].load() : -1;
+    }
+
+    // parameterIndex -1 clears the slot. A parameter is exposed by one slot only.
+    void setSlotParameter(int slot, int parameterIndex)
+    {
+        if (!juce::isPositiveAndBelow(slot, numSlots))
+            return;
+
+        int previousIndex = mSlotParameter[(size_t)slot].exchange(-1);
+        if (isValidIndex(previousIndex))
+            mParameterSlot[(size_t)previousIndex] = -1;
+
+        if (!isValidIndex(parameterIndex))
+            return;
+        int previousSlot = mParameterSlot[(size_t)parameterIndex].exchange(slot);
+        if (juce::isPositiveAndBelow(previousSlot, numSlots) && previousSlot != slot)
+            mSlotParameter[(size_t)previousSlot] = -1;
+        mSlotParameter[(size_t)slot] = parameterIndex;
+    }
+
+    // Integer values of the table (choice index for choice parameters) to normalised slot values and back
+    int getMinValue(int parameterIndex) const
+    {
+        const SY1000Parameter::Data& data = mParameter.getParameterData(parameterIndex);
+        return data.choices.size() > 0 ? 0 : data.minValue;
+    }
+
+    int getMaxValue(int parameterIndex) const
+    {
+        const SY1000Parameter::Data& data = mParameter.getParameterData(parameterIndex);
+        return data.choices.size() > 0 ? data.choices.size() - 1 : data.maxValue;
+    }
+
+    float toNormalised(int parameterIndex, int value) const
+    {
+        int minValue = getMinValue(parameterIndex);
+        int range = getMaxValue(parameterIndex) - minValue;
+        return range > 0 ? juce::jlimit(0.0f, 1.0f, (float)(value - minValue) / (float)range) : 0.0f;
+    }
+
+    int fromNormalised(int parameterIndex, float normalisedValue) const
+    {
+        int minValue = getMinValue(parameterIndex);
+        return minValue + juce::roundToInt(juce::jlimit(0.0f, 1.0f, normalisedValue) * (float)(getMaxValue(parameterIndex) - minValue));
+    }
+
+    juce::String getText(int parameterIndex, int value) const
+    {
+        const SY1000Parameter::Data& data = mParameter.getParameterData(parameterIndex);
+        return data.choices.size() > 0 ? data.choices[value] : juce::String(value);
+    }
+
+    // The mapping is stored as a child of the plugin state
+    juce::ValueTree toValueTree() const
+    {
+        juce::ValueTree slots("SLOTS");
+        for (int slot = 0; slot < numSlots; slot++)
+        {
+            int parameterIndex = getSlotParameter(slot);
+            if (parameterIndex < 0)
+                continue;
+            juce::ValueTree child("SLOT");
+            child.setProperty("slot", slot, nullptr);
+            child.setProperty("parameter", parameterIndex, nullptr);
+            slots.appendChild(child, nullptr);
+        }
+        return slots;
+    }
+
+    void fromValueTree(const juce::ValueTree& slots)
+    {
+        for (int slot = 0; slot < numSlots; slot++)
+            setSlotParameter(slot, -1);
+        for (int i = 0; i < slots.getNumChildren(); i++)
+        {
+            juce::ValueTree child = slots.getChild(i);
+            setSlotParameter(child.getProperty("slot", -1), child.getProperty("parameter", -1));
+        }
+    }
+
+    // Global setting, read before the parameter layout is created
+    static Mode loadMode()
+    {
+        juce::PropertiesFile settings(getSettingsOptions());
+        return settings.getValue("exposedParameters", "all") == "slots" ? SLOTS : ALL_PARAMETERS;
+    }
+
+    static void saveMode(Mode mode)
+    {
+        juce::PropertiesFile settings(getSettingsOptions());
+        settings.setValue("exposedParameters", mode == SLOTS ? "slots" : "all");
+        settings.saveIfNeeded();
+    }
+
+    // Settings file of the machine, shared by all instances (also used by SY1000SharedDevice)
+    static juce::PropertiesFile::Options getSettingsOptions()
+    {
+        juce::PropertiesFile::Options options;
+        options.applicationName = "SY1000";
+        options.filenameSuffix = "settings";
+        options.folderName = "SY1000";
+        options.osxLibrarySubFolder = "Application Support";
+        return options;
+    }
+
+private:
+
+    bool isValidIndex(int parameterIndex) const
+    {
+        return parameterIndex >= 0 && (size_t)parameterIndex < mParameter.size();
+    }
+
+    const SY1000Parameter& mParameter;
+    Mode mMode;
+    std::array<std::atomic<int>, numSlots> mSlotParameter;
+    std::unique_ptr<std::atomic<int>[]> mParameterSlot;
+};
+
+// Host slot, shows the name and the value text of the mapped SY1000 parameter
+class SY1000SlotParameter : public juce::AudioParameterFloat
+{
+public:
+
+    SY1000SlotParameter(const SY1000Parameter& parameter, const SY1000HostSlots& hostSlots, int slot)
+        : juce::AudioParameterFloat(SY1000HostSlots::getParameterID(slot), "SLOT/" + juce::String(slot + 1), 0.0f, 1.0f, 0.0f),
+          mParameter(parameter), mHostSlots(hostSlots), mSlot(slot)
+    {
+    }
+
+    juce::String getName(int maximumStringLength) const override
+    {
+        int parameterIndex = mHostSlots.getSlotParameter(mSlot);
+        if (parameterIndex < 0)
+            return juce::AudioParameterFloat::getName(maximumStringLength);
+        return limitLength(mParameter.getParameterData(parameterIndex).parameterName, maximumStringLength);
+    }
+
+    juce::String getText(float normalisedValue, int maximumStringLength) const override
+    {
+        int parameterIndex = mHostSlots.getSlotParameter(mSlot);
+        if (parameterIndex < 0)
+            return {};
+        return limitLength(mHostSlots.getText(parameterIndex, mHostSlots.fromNormalised(parameterIndex, normalisedValue)), maximumStringLength);
+    }
+
+private:
+
+    static juce::String limitLength(const juce::String& text, int maximumStringLength)
+    {
+        return maximumStringLength > 0 ? text.substring(0, maximumStringLength) : text;
+    }
+
+    const SY1000Parameter& mParameter;
+    const SY1000HostSlots& mHostSlots;
+    int mSlot;
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AddressIndex.h"
+#include "SysExCodec.h"
+#include "SysExDecoder.h"
+
+// Measures the SysEx throughput of the link to the SY1000 (USB MIDI has no baud rate, the SysEx handling of
+// the device limits it). An RQ1 asks for the INST1 block of the temporary patch, the device answers with DT1
+// packets as fast as it can. The rate is the received bytes over the time from the request going on the wire
+// (not from queueing it, a backlog ahead of it doesn't count) to the last reply, so the round trip latency is
+// included and the figure errs on the slow side.
+// The reply times have the resolution of the audio block.
+class SY1000LinkMeter
+{
+public:
+
+    static constexpr juce::uint32 requestAddress = 0x10001500;
+    static constexpr int requestSize = 11 * 128;
+    static constexpr double timeoutMs = 3000.0;
+
+    static juce::MidiMessage createRequest()
+    {
+        return SY1000SysExCodec::createRQ1(requestAddress, requestSize);
+    }
+
+    // The request is queued at timeMs, its wire start time follows with setRequestSentTime
+    void start(double timeMs)
+    {
+        mQueuedTime = timeMs;
+        mStartTime = -1.0;
+        mLastReplyTime = timeMs;
+        mBytesReceived = 0;
+        mDataBytesReceived = 0;
+        mIsRunning = true;
+    }
+
+    bool isRunning() const
+    {
+        return mIsRunning;
+    }
+
+    bool isWaitingForRequest() const
+    {
+        return mIsRunning && mStartTime < 0.0;
+    }
+
+    void setRequestSentTime(double timeMs)
+    {
+        mStartTime = timeMs;
+    }
+
+    // Returns true if the DT1 is a reply to the request, it is consumed by the measurement
+    bool addReply(const SY1000SysExDecoder::DT1& dt1, int numMessageBytes, double timeMs)
+    {
+        juce::uint32 beginAddress = SY1000AddressIndex::toLinear(requestAddress);
+        juce::uint32 address = SY1000AddressIndex::toLinear(dt1.address);
+        if (!mIsRunning || address < beginAddress || address >= beginAddress + (juce::uint32)requestSize)
+            return false;
+
+        mBytesReceived += numMessageBytes;
+        mDataBytesReceived += dt1.numDataBytes;
+        mLastReplyTime = timeMs;
+        return true;
+    }
+
+    // Measured bytes per second once all data arrived, 0 while running or after a timeout without reply
+    double process(double timeMs)
+    {
+        if (!mIsRunning)
+            return 0.0;
+
+        if (mDataBytesReceived >= requestSize && mStartTime >= 0.0)
+        {
+            mIsRunning = false;
+            return mBytesReceived * 1000.0 / juce::jmax(1.0, mLastReplyTime - mStartTime);
+        }
+        if (timeMs - (mStartTime >= 0.0 ? mStartTime : mQueuedTime) > timeoutMs)
+            mIsRunning = false;
+        return 0.0;
+    }
+
+private:
+
+    bool mIsRunning = false;
+    double mQueuedTime = 0.0;
+    double mStartTime = -1.0;
+    double mLastReplyTime = 0.0;
+    int mBytesReceived = 0;
+    int mDataBytesReceived = 0;
+};
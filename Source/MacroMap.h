@@ -0,0 +1,138 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Macro host parameters, each one maps to a list of SY1000 parameters with a value range and a curve.
+// A macro change evaluates all its targets in one pass, the processor sends the result as packed DT1s.
+class SY1000MacroMap
+{
+public:
+
+    static constexpr int numMacros = 8;
+
+    enum Curve { LINEAR, EXPONENTIAL, LOGARITHMIC, S_CURVE };
+
+    struct Target
+    {
+        int parameterIndex = -1;
+        int minValue = 0;       // parameter value at macro 0 (may be above maxValue for an inverted mapping)
+        int maxValue = 0;       // parameter value at macro 1
+        Curve curve = LINEAR;
+    };
+
+    struct Step
+    {
+        int parameterIndex;
+        int value;
+    };
+
+    SY1000MacroMap(const SY1000Parameter& parameter) : mParameter(parameter) {}
+
+    static juce::String getParameterID(int macroIndex)
+    {
+        return "macro" + juce::String(macroIndex + 1);
+    }
+
+    void setTargets(int macroIndex, const std::vector<Target>& targets)
+    {
+        if (!juce::isPositiveAndBelow(macroIndex, numMacros))
+            return;
+        mTargets[macroIndex].clear();
+        for (auto& target : targets)
+        {
+            if (target.parameterIndex >= 0 && target.parameterIndex < (int)mParameter.size())
+                mTargets[macroIndex].push_back(target);
+        }
+    }
+
+    void copyFrom(const SY1000MacroMap& other)
+    {
+        for (int m = 0; m < numMacros; m++)
+            mTargets[m] = other.mTargets[m];
+    }
+
+    const std::vector<Target>& getTargets(int macroIndex) const
+    {
+        return mTargets[juce::jlimit(0, numMacros - 1, macroIndex)];
+    }
+
+    // Values of all targets for the normalised macro value into steps (cleared first). The caller keeps
+    // the storage, with getNumTargets() capacity no allocation happens (macro changes on the audio thread).
+    void evaluate(int macroIndex, float macroValue, std::vector<Step>& steps) const
+    {
+        steps.clear();
+        if (!juce::isPositiveAndBelow(macroIndex, numMacros))
+            return;
+
+        double x = juce::jlimit(0.0, 1.0, (double)macroValue);
+        for (auto& target : mTargets[macroIndex])
+        {
+            double y = applyCurve(target.curve, x);
+            steps.push_back({ target.parameterIndex, juce::roundToInt(target.minValue + (target.maxValue - target.minValue) * y) });
+        }
+    }
+
+    // Targets of the largest macro
+    int getNumTargets() const
+    {
+        size_t numTargets = 0;
+        for (auto& targets : mTargets)
+            numTargets = juce::jmax(numTargets, targets.size());
+        return (int)numTargets;
+    }
+
+    // The mapping is stored as a child of the plugin state
+    juce::ValueTree toValueTree() const
+    {
+        juce::ValueTree macros("MACROS");
+        for (int m = 0; m < numMacros; m++)
+        {
+            for (auto& target : mTargets[m])
+            {
+                juce::ValueTree child("TARGET");
+                child.setProperty("macro", m, nullptr);
+                child.setProperty("parameter", target.parameterIndex, nullptr);
+                child.setProperty("min", target.minValue, nullptr);
+                child.setProperty("max", target.maxValue, nullptr);
+                child.setProperty("curve", (int)target.curve, nullptr);
+                macros.appendChild(child, nullptr);
+            }
+        }
+        return macros;
+    }
+
+    void fromValueTree(const juce::ValueTree& macros)
+    {
+        for (auto& targets : mTargets)
+            targets.clear();
+        for (int i = 0; i < macros.getNumChildren(); i++)
+        {
+            juce::ValueTree child = macros.getChild(i);
+            int m = child.getProperty("macro", -1);
+            Target target;
+            target.parameterIndex = child.getProperty("parameter", -1);
+            target.minValue = child.getProperty("min", 0);
+            target.maxValue = child.getProperty("max", 0);
+            target.curve = (Curve)juce::jlimit(0, (int)S_CURVE, (int)child.getProperty("curve", 0));
+            if (juce::isPositiveAndBelow(m, numMacros) && target.parameterIndex >= 0 && target.parameterIndex < (int)mParameter.size())
+                mTargets[m].push_back(target);
+        }
+    }
+
+private:
+
+    static double applyCurve(Curve curve, double x)
+    {
+        switch (curve)
+        {
+        case LINEAR:        return x;
+        case EXPONENTIAL:   return x * x;
+        case LOGARITHMIC:   return 1.0 - (1.0 - x) * (1.0 - x);
+        case S_CURVE:       return x * x * (3.0 - 2.0 * x);
+        }
+        return x;
+    }
+
+    const SY1000Parameter& mParameter;
+    std::vector<Target> mTargets[numMacros];
+};
@@ -0,0 +1,202 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Plugin side modulators for any SY1000 parameter: LFO, envelope follower on the host MIDI input and
+// step sequencer, free running or synced to the host tempo.
+// Every modulator has a maximum update rate and a dead band, a value is only written if the last write is
+// old enough and the value moved by more than the dead band, so the DT1 stream stays within the bandwidth.
+class SY1000ModulationEngine
+{
+public:
+
+    enum Source { LFO, ENVELOPE, STEP };
+    enum Shape { SINE, TRIANGLE, SQUARE, SAW_UP, SAW_DOWN };
+
+    struct Modulator
+    {
+        int parameterIndex = -1;
+        Source source = LFO;
+        int center = 0;                 // parameter value at modulation 0
+        double depth = 0.5;             // part of the parameter range for modulation 1
+        double maxUpdateRate = 20.0;    // writes per second
+        int deadBand = 1;               // minimum change of the parameter value
+
+        // LFO and STEP timing, cycle (LFO) or step (STEP) length
+        bool isTempoSynced = false;
+        double rateHz = 1.0;            // free running
+        double beats = 1.0;             // tempo synced
+
+        // LFO
+        Shape shape = SINE;
+
+        // ENVELOPE: note velocity or controller value of the host MIDI input
+        int controllerNumber = -1;      // -1 = note velocity
+        double attackMs = 10.0;
+        double releaseMs = 200.0;
+
+        // STEP: values -1..1
+        std::vector<double> steps;
+    };
+
+    // Host transport of the current block
+    struct Transport
+    {
+        double timeMs = 0.0;            // Time::getMillisecondCounterHiRes()
+        double blockDurationMs = 0.0;
+        double bpm = 120.0;
+        double ppqPosition = 0.0;
+        bool isPlaying = false;
+    };
+
+    struct Step
+    {
+        int parameterIndex;
+        int value;
+    };
+
+    SY1000ModulationEngine(const SY1000Parameter& parameter) : mParameter(parameter) {}
+
+    // Returns the id of the modulator, -1 for an invalid parameter
+    int addModulator(const Modulator& modulator)
+    {
+        if (modulator.parameterIndex < 0 || modulator.parameterIndex >= (int)mParameter.size())
+            return -1;
+
+        const SY1000Parameter::Data& data = mParameter.getParameterData(modulator.parameterIndex);
+        State state;
+        state.id = mNextId++;
+        state.modulator = modulator;
+        state.minValue = data.choices.size() > 0 ? 0 : data.minValue;
+        state.maxValue = data.choices.size() > 0 ? data.choices.size() - 1 : data.maxValue;
+        mStates.push_back(state);
+        // one step per modulator at most, process() does not allocate
+        mSteps.reserve(mStates.size());
+        return state.id;
+    }
+
+    void removeModulator(int id)
+    {
+        mStates.erase(std::remove_if(mStates.begin(), mStates.end(), [id](const State& state) { return state.id == id; }), mStates.end());
+    }
+
+    void clear()
+    {
+        mStates.clear();
+    }
+
+    bool isEmpty() const
+    {
+        return mStates.empty();
+    }
+
+    // Input of the envelope followers
+    void handleMidiMessage(const juce::MidiMessage& message)
+    {
+        for (auto& state : mStates)
+        {
+            if (state.modulator.source != ENVELOPE)
+                continue;
+            if (state.modulator.controllerNumber < 0)
+            {
+                if (message.isNoteOn())
+                    state.envelopeInput = message.getVelocity() / 127.0;
+                else if (message.isNoteOff())
+                    state.envelopeInput = 0.0;
+            }
+            else if (message.isController() && message.getControllerNumber() == state.modulator.controllerNumber)
+            {
+                state.envelopeInput = message.getControllerValue() / 127.0;
+            }
+        }
+    }
+
+    // Values to write for this block, valid until the next call
+    const std::vector<Step>& process(const Transport& transport)
+    {
+        mSteps.clear();
+        for (auto& state : mStates)
+        {
+            double modulation = getModulation(state, transport);
+            const Modulator& modulator = state.modulator;
+            int value = juce::jlimit(state.minValue, state.maxValue,
+                                     juce::roundToInt(modulator.center + modulation * modulator.depth * (state.maxValue - state.minValue)));
+
+            bool isDue = transport.timeMs - state.lastSendTime >= 1000.0 / juce::jmax(0.1, modulator.maxUpdateRate);
+            if (isDue && (state.lastSentValue < 0 || std::abs(value - state.lastSentValue) >= juce::jmax(1, modulator.deadBand)))
+            {
+                mSteps.push_back({ modulator.parameterIndex, value });
+                state.lastSentValue = value;
+                state.lastSendTime = transport.timeMs;
+            }
+        }
+        return mSteps;
+    }
+
+private:
+
+    struct State
+    {
+        int id = 0;
+        Modulator modulator;
+        int minValue = 0;
+        int maxValue = 0;
+        double phase = 0.0;             // free running position in cycles (LFO) or steps (STEP)
+        double envelope = 0.0;
+        double envelopeInput = 0.0;
+        int lastSentValue = -1;
+        double lastSendTime = 0.0;
+    };
+
+    // Modulation -1..1 (ENVELOPE 0..1) at the end of this block
+    double getModulation(State& state, const Transport& transport)
+    {
+        const Modulator& modulator = state.modulator;
+        if (modulator.source == ENVELOPE)
+        {
+            double timeConstant = state.envelopeInput > state.envelope ? modulator.attackMs : modulator.releaseMs;
+            double coefficient = 1.0 - std::exp(-transport.blockDurationMs / juce::jmax(1.0, timeConstant));
+            state.envelope += (state.envelopeInput - state.envelope) * coefficient;
+            return state.envelope;
+        }
+
+        // position in cycles / steps
+        double position = 0.0;
+        if (modulator.isTempoSynced && transport.isPlaying)
+        {
+            position = transport.ppqPosition / juce::jmax(0.0625, modulator.beats);
+            state.phase = position;
+        }
+        else
+        {
+            double cyclesPerSecond = modulator.isTempoSynced ? transport.bpm / 60.0 / juce::jmax(0.0625, modulator.beats) : modulator.rateHz;
+            state.phase += cyclesPerSecond * transport.blockDurationMs / 1000.0;
+            position = state.phase;
+        }
+
+        if (modulator.source == STEP)
+        {
+            if (modulator.steps.empty())
+                return 0.0;
+            int numSteps = (int)modulator.steps.size();
+            int step = ((int)std::floor(position) % numSteps + numSteps) % numSteps;
+            return juce::jlimit(-1.0, 1.0, modulator.steps[(size_t)step]);
+        }
+
+        double phase = position - std::floor(position);
+        switch (modulator.shape)
+        {
+        case SINE:      return std::sin(juce::MathConstants<double>::twoPi * phase);
+        case TRIANGLE:  return phase < 0.5 ? 4.0 * phase - 1.0 : 3.0 - 4.0 * phase;
+        case SQUARE:    return phase < 0.5 ? 1.0 : -1.0;
+        case SAW_UP:    return 2.0 * phase - 1.0;
+        case SAW_DOWN:  return 1.0 - 2.0 * phase;
+        }
+        return 0.0;
+    }
+
+    const SY1000Parameter& mParameter;
+    std::vector<State> mStates;
+    std::vector<Step> mSteps;
+    int mNextId = 1;
+};
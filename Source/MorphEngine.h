@@ -0,0 +1,137 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+#include "AddressIndex.h"
+
+// Morphs between two patch states (flat value arrays indexed like SY1000Param) over a given time.
+// Continuous parameters (no choices) are interpolated, discrete ones switch at a configurable point of the
+// morph. Every tick returns only values that differ from the last returned ones and stays within a byte
+// budget, the parameters with the largest normalised distance to their current target come first.
+// The morph ends when every parameter has reached its final value, even if that takes longer than planned.
+class SY1000MorphEngine
+{
+public:
+
+    struct Step
+    {
+        int parameterIndex;
+        int value;
+    };
+
+    SY1000MorphEngine(const SY1000Parameter& parameter, const SY1000AddressIndex& addressIndex)
+    {
+        mLayout.resize(parameter.size());
+        for (int i = 0; i < (int)parameter.size(); i++)
+        {
+            const SY1000Parameter::Data& data = parameter.getParameterData(i);
+            Layout& layout = mLayout[(size_t)i];
+            layout.isMorphable = addressIndex.isWritable(i) && data.parameterType != SY1000Parameter::REGISTER;
+            layout.isContinuous = data.choices.size() == 0;
+            layout.range = juce::jmax(1, data.choices.size() > 0 ? data.choices.size() - 1 : data.maxValue - data.minValue);
+            // F0, header, command, address, data, checksum, F7
+            layout.numBytes = 14 + addressIndex.getLayout(i).dataBytes;
+        }
+    }
+
+    // switchPoint: position 0..1 of the morph where discrete parameters change to their target
+    void start(const std::vector<int>& from, const std::vector<int>& to, double durationMs, double switchPoint = 0.5)
+    {
+        jassert(from.size() == mLayout.size() && to.size() == mLayout.size());
+        mFrom = from;
+        mTo = to;
+        mLastSent = from;
+        mDurationMs = juce::jmax(1.0, durationMs);
+        mSwitchPoint = juce::jlimit(0.0, 1.0, switchPoint);
+        mActive.clear();
+        for (size_t i = 0; i < mLayout.size(); i++)
+        {
+            if (mLayout[i].isMorphable && from[i] != to[i])
+                mActive.push_back((int)i);
+        }
+    }
+
+    void stop()
+    {
+        mActive.clear();
+    }
+
+    bool isRunning() const
+    {
+        return !mActive.empty();
+    }
+
+    // Frees the per parameter buffers of a stopped morph (dormant instance), start() allocates them again
+    void releaseBuffers()
+    {
+        jassert(!isRunning());
+        std::vector<int>().swap(mFrom);
+        std::vector<int>().swap(mTo);
+        std::vector<int>().swap(mLastSent);
+        std::vector<int>().swap(mActive);
+        std::vector<Candidate>().swap(mCandidates);
+    }
+
+    // Values to write at elapsedMs after the start, at most byteBudget bytes
+    std::vector<Step> process(double elapsedMs, int byteBudget)
+    {
+        std::vector<Step> steps;
+        if (mActive.empty())
+            return steps;
+
+        double position = juce::jlimit(0.0, 1.0, elapsedMs / mDurationMs);
+
+        mCandidates.clear();
+        for (int parameterIndex : mActive)
+        {
+            size_t i = (size_t)parameterIndex;
+            int target = mLayout[i].isContinuous ? juce::roundToInt(mFrom[i] + (mTo[i] - mFrom[i]) * position)
+                                                 : (position >= mSwitchPoint ? mTo[i] : mFrom[i]);
+            if (target != mLastSent[i])
+                mCandidates.push_back({ parameterIndex, target, std::abs(target - mLastSent[i]) / (double)mLayout[i].range });
+        }
+
+        std::sort(mCandidates.begin(), mCandidates.end(), [](const Candidate& a, const Candidate& b) { return a.distance > b.distance; });
+        for (auto& candidate : mCandidates)
+        {
+            int numBytes = mLayout[(size_t)candidate.parameterIndex].numBytes;
+            if (numBytes > byteBudget)
+                break;
+            byteBudget -= numBytes;
+            mLastSent[(size_t)candidate.parameterIndex] = candidate.value;
+            steps.push_back({ candidate.parameterIndex, candidate.value });
+        }
+
+        // parameters at their final value are done
+        mActive.erase(std::remove_if(mActive.begin(), mActive.end(), [this](int parameterIndex)
+        {
+            return mLastSent[(size_t)parameterIndex] == mTo[(size_t)parameterIndex];
+        }), mActive.end());
+        return steps;
+    }
+
+private:
+
+    struct Layout
+    {
+        bool isMorphable = false;
+        bool isContinuous = false;
+        int range = 1;
+        int numBytes = 0;
+    };
+
+    struct Candidate
+    {
+        int parameterIndex;
+        int value;
+        double distance;
+    };
+
+    std::vector<Layout> mLayout;
+    std::vector<int> mFrom;
+    std::vector<int> mTo;
+    std::vector<int> mLastSent;
+    std::vector<int> mActive;
+    std::vector<Candidate> mCandidates;
+    double mDurationMs = 1.0;
+    double mSwitchPoint = 0.5;
+};
@@ -0,0 +1,200 @@
+#pragma once
+#include <JuceHeader.h>
+#include "TransitionPlanner.h"
+
+// Paces the outgoing SysEx stream to the rate the MIDI link to the SY1000 can carry.
+// A virtual wire clock tracks when the last message has left the link. Messages that do not fit into the
+// current audio block stay queued and are sent with the following blocks, so bursts never overrun the device.
+// Two lanes feed the link: the real-time lane (pedal states, levels, BPM) is served before every packet of
+// the bulk lane (patch restores and other bursts), so a real-time write waits for one bulk packet at most.
+class SY1000OutputScheduler
+{
+public:
+
+    enum LinkProfile { DIN, USB, CUSTOM };
+
+    // Timing of the audio block the messages are written into
+    struct BlockTiming
+    {
+        double blockTime = 0.0;          // Time::getMillisecondCounterHiRes() at the start of this block
+        int numSamples = 0;
+        double sampleRate = 44100.0;
+    };
+
+    struct Statistics
+    {
+        juce::int64 packetsSent = 0;
+        juce::int64 bytesSent = 0;
+        int queuedPackets = 0;
+        double averageLatency = 0.0;     // ms from the change to the start of its message on the wire
+        double maxLatency = 0.0;
+        double maxRealtimeLatency = 0.0;
+        double bytesInFlight = 0.0;
+    };
+
+    static constexpr double dinBytesPerSecond = 3125.0;     // 31250 baud, 10 bits per byte
+
+    void setLinkProfile(LinkProfile profile, double customBytesPerSecond = 0.0)
+    {
+        mLinkProfile = profile;
+        switch (profile)
+        {
+        case DIN:
+            mBytesPerSecond = dinBytesPerSecond;
+            break;
+        case USB:
+            // USB MIDI is limited by the SysEx processing of the device, there is no published figure.
+            // The rate measured by SY1000LinkMeter, the DIN rate (which the device always handles) until then.
+            mBytesPerSecond = mMeasuredBytesPerSecond > 0.0 ? mMeasuredBytesPerSecond.load() : dinBytesPerSecond;
+            break;
+        case CUSTOM:
+            mBytesPerSecond = juce::jmax(100.0, customBytesPerSecond);
+            break;
+        }
+    }
+
+    LinkProfile getLinkProfile() const
+    {
+        return mLinkProfile;
+    }
+
+    // Measured rate of the USB link, 0 = not measured
+    void setMeasuredBytesPerSecond(double measuredBytesPerSecond)
+    {
+        mMeasuredBytesPerSecond = juce::jmax(0.0, measuredBytesPerSecond);
+        if (mLinkProfile == USB)
+            setLinkProfile(USB);
+    }
+
+    double getMeasuredBytesPerSecond() const
+    {
+        return mMeasuredBytesPerSecond;
+    }
+
+    double getBytesPerSecond() const
+    {
+        return mBytesPerSecond;
+    }
+
+    // Size of a message that leaves the wire within one audio block, so a real-time write waits for one
+    // block at most behind it (10 ms until the first block)
+    int getMaxMessageBytes() const
+    {
+        return (int)(mBytesPerSecond * mBlockDurationMs / 1000.0);
+    }
+
+    // Link is idle, e.g. after prepareToPlay
+    void reset()
+    {
+        mWireFreeTime = 0.0;
+    }
+
+    // Write the queued messages that fit into this block. A change made by processBlock starts at its sample
+    // offset in the block, a change made before the block (host automation, UI) at the start of the block,
+    // but never before the previous message has left the wire. The real-time lane preempts the bulk lane
+    // between two packets.
+    void process(SY1000TransitionPlanner& realtimeLane, SY1000TransitionPlanner& bulkLane, juce::MidiBuffer& midiMessages, const BlockTiming& timing)
+    {
+        double blockDuration = 1000.0 * timing.numSamples / timing.sampleRate;
+        mBlockDurationMs = blockDuration;
+        double blockEnd = timing.blockTime + blockDuration;
+
+        auto getChangeTime = [&](const SY1000TransitionPlanner::Write& write)
+        {
+            return write.changeTime < 0.0 ? timing.blockTime : juce::jlimit(timing.blockTime, blockEnd, write.changeTime);
+        };
+
+        while (!realtimeLane.isEmpty() || !bulkLane.isEmpty())
+        {
+            // a real-time write that belongs to the next block does not hold back the bulk lane
+            bool isRealtime = !realtimeLane.isEmpty() && (bulkLane.isEmpty() || getChangeTime(realtimeLane.front()) < blockEnd);
+            SY1000TransitionPlanner& queue = isRealtime ? realtimeLane : bulkLane;
+            const SY1000TransitionPlanner::Write& write = queue.front();
+            double changeTime = getChangeTime(write);
+            double startTime = juce::jmax(changeTime, mWireFreeTime);
+            if (startTime >= blockEnd)
+                break;
+
+            int samplePosition = juce::jlimit(0, juce::jmax(0, timing.numSamples - 1), (int)((startTime - timing.blockTime) * timing.sampleRate / 1000.0));
+            midiMessages.addEvent(write.message, samplePosition);
+
+            int numBytes = write.message.getRawDataSize();
+            if (isDataRequest(write.message))
+                mRequestSentTime = startTime;
+            mWireFreeTime = startTime + 1000.0 * numBytes / mBytesPerSecond;
+            addToStatistics(numBytes, startTime - write.timeStamp, isRealtime);
+            queue.popFront();
+        }
+
+        mQueuedPackets = realtimeLane.getNumPending() + bulkLane.getNumPending();
+        mBytesInFlight = juce::jmax(0.0, mWireFreeTime - blockEnd) * mBytesPerSecond / 1000.0;
+    }
+
+    // Wire start time of the last RQ1 sent since the last call, -1 if none (start of a link measurement).
+    // Called under the midiOutLock like process.
+    double takeRequestSentTime()
+    {
+        double requestSentTime = mRequestSentTime;
+        mRequestSentTime = -1.0;
+        return requestSentTime;
+    }
+
+    Statistics getStatistics() const
+    {
+        Statistics statistics;
+        statistics.packetsSent = mPacketsSent;
+        statistics.bytesSent = mBytesSent;
+        statistics.queuedPackets = mQueuedPackets;
+        statistics.averageLatency = mPacketsSent > 0 ? mLatencySum / (double)mPacketsSent : 0.0;
+        statistics.maxLatency = mMaxLatency;
+        statistics.maxRealtimeLatency = mMaxRealtimeLatency;
+        statistics.bytesInFlight = mBytesInFlight;
+        return statistics;
+    }
+
+    void resetStatistics()
+    {
+        mPacketsSent = 0;
+        mBytesSent = 0;
+        mLatencySum = 0.0;
+        mMaxLatency = 0.0;
+        mMaxRealtimeLatency = 0.0;
+    }
+
+private:
+
+    // Roland RQ1: F0 41 <device> <model 4 bytes> 11 ...
+    static bool isDataRequest(const juce::MidiMessage& message)
+    {
+        return message.isSysEx() && message.getSysExDataSize() > 6 && message.getSysExData()[6] == 0x11;
+    }
+
+    void addToStatistics(int numBytes, double latency, bool isRealtime)
+    {
+        latency = juce::jmax(0.0, latency);
+        mPacketsSent = mPacketsSent + 1;
+        mBytesSent = mBytesSent + numBytes;
+        mLatencySum = mLatencySum + latency;
+        if (latency > mMaxLatency)
+            mMaxLatency = latency;
+        if (isRealtime && latency > mMaxRealtimeLatency)
+            mMaxRealtimeLatency = latency;
+    }
+
+    // written under the midiOutLock, read without it (processMorph, settings)
+    std::atomic<LinkProfile> mLinkProfile { DIN };
+    std::atomic<double> mBytesPerSecond { dinBytesPerSecond };
+    std::atomic<double> mMeasuredBytesPerSecond { 0.0 };   // written by the audio thread, saved with the state
+    double mWireFreeTime = 0.0;
+    double mRequestSentTime = -1.0;
+    std::atomic<double> mBlockDurationMs { 10.0 };
+
+    // written by the audio thread, read by the UI
+    std::atomic<juce::int64> mPacketsSent { 0 };
+    std::atomic<juce::int64> mBytesSent { 0 };
+    std::atomic<int> mQueuedPackets { 0 };
+    std::atomic<double> mLatencySum { 0.0 };
+    std::atomic<double> mMaxLatency { 0.0 };
+    std::atomic<double> mMaxRealtimeLatency { 0.0 };
+    std::atomic<double> mBytesInFlight { 0.0 };
+};
@@ -243,7 +243,7 @@ public:
         addParameter("100", "10001630", "INST1/DYNAMIC SYNTH/LFO1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("101", "10001631", "INST1/DYNAMIC SYNTH/LFO2/LFO2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("102", "10001632", "INST1/DYNAMIC SYNTH/LFO2/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("103", "10001633", "INST1/DYNAMIC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
+        addParameter("103", "10001633", "INST1/DYNAMIC SYNTH/LFO2/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
         addParameter("104", "10001633", "INST1/DYNAMIC SYNTH/LFO2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
         addParameter("105", "10001634", "INST1/DYNAMIC SYNTH/LFO2/DYNAMIC DEPTH", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("106", "10001635", "INST1/DYNAMIC SYNTH/LFO2/PITCH DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
@@ -683,1092 +683,19 @@ public:
         addParameter("540", "10001E10", "INST1/POLY FX/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("541", "10001E11", "INST1/POLY FX/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
         addParameter("542", "10001E12", "INST1/POLY FX/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("543", "10002000", "INST2/COMMON/INST ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("544", "10002001", "INST2/COMMON/INST TYPE", choices_INST_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("545", "10002002", "INST2/COMMON/INST LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("546", "10002003", "INST2/COMMON/NOR MIX SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("547", "10002004", "INST2/COMMON/NOR MIX LEVEL", {}, SINGLE, 2, 0, 200, 0, 0);
-        addParameter("548", "10002006", "INST2/COMMON/STRING LEVEL1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("549", "10002007", "INST2/COMMON/STRING LEVEL2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("550", "10002008", "INST2/COMMON/STRING LEVEL3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("551", "10002009", "INST2/COMMON/STRING LEVEL4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("552", "1000200A", "INST2/COMMON/STRING LEVEL5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("553", "1000200B", "INST2/COMMON/STRING LEVEL6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("554", "1000200C", "INST2/COMMON/STRING PAN1", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("555", "1000200D", "INST2/COMMON/STRING PAN2", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("556", "1000200E", "INST2/COMMON/STRING PAN3", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("557", "1000200F", "INST2/COMMON/STRING PAN4", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("558", "10002010", "INST2/COMMON/STRING PAN5", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("559", "10002011", "INST2/COMMON/STRING PAN6", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("560", "10002A00", "INST2/ALT TUNE/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("561", "10002A01", "INST2/ALT TUNE/TUNING TYPE", choices_TUNING_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("562", "10002A02", "INST2/ALT TUNE/USER/PITCH 1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("563", "10002A03", "INST2/ALT TUNE/USER/PITCH 2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("564", "10002A04", "INST2/ALT TUNE/USER/PITCH 3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("565", "10002A05", "INST2/ALT TUNE/USER/PITCH 4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("566", "10002A06", "INST2/ALT TUNE/USER/PITCH 5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("567", "10002A07", "INST2/ALT TUNE/USER/PITCH 6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("568", "10002A08", "INST2/ALT TUNE/USER/FINE 1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("569", "10002A09", "INST2/ALT TUNE/USER/FINE 2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("570", "10002A0A", "INST2/ALT TUNE/USER/FINE 3", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("571", "10002A0B", "INST2/ALT TUNE/USER/FINE 4", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("572", "10002A0C", "INST2/ALT TUNE/USER/FINE 5", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("573", "10002A0D", "INST2/ALT TUNE/USER/FINE 6", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("574", "10002A0E", "INST2/ALT TUNE/GUITAR/12STR SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("575", "10002A0F", "INST2/ALT TUNE/GUITAR/12STR TYPE", choices_12STR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("576", "10002A10", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("577", "10002A11", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("578", "10002A12", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("579", "10002A13", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("580", "10002A14", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("581", "10002A15", "INST2/ALT TUNE/GUITAR USER/12STR PITCH 6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("582", "10002A16", "INST2/ALT TUNE/GUITAR USER/12STR FINE 1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("583", "10002A17", "INST2/ALT TUNE/GUITAR USER/12STR FINE 2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("584", "10002A18", "INST2/ALT TUNE/GUITAR USER/12STR FINE 3", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("585", "10002A19", "INST2/ALT TUNE/GUITAR USER/12STR FINE 4", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("586", "10002A1A", "INST2/ALT TUNE/GUITAR USER/12STR FINE 5", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("587", "10002A1B", "INST2/ALT TUNE/GUITAR USER/12STR FINE 6", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("588", "10002A1C", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("589", "10002A1D", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("590", "10002A1E", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("591", "10002A1F", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("592", "10002A20", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("593", "10002A21", "INST2/ALT TUNE/GUITAR USER/12STR LEVEL 6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("594", "10002A22", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("595", "10002A23", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("596", "10002A24", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("597", "10002A25", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("598", "10002A26", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("599", "10002A27", "INST2/ALT TUNE/GUITAR USER/12STR DELAY 6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("600", "10002A28", "INST2/ALT TUNE/GUITAR USER/STR BEND SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("601", "10002A29", "INST2/ALT TUNE/BEND DEPTH1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("602", "10002A2A", "INST2/ALT TUNE/BEND DEPTH2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("603", "10002A2B", "INST2/ALT TUNE/BEND DEPTH3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("604", "10002A2C", "INST2/ALT TUNE/BEND DEPTH4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("605", "10002A2D", "INST2/ALT TUNE/BEND DEPTH5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("606", "10002A2E", "INST2/ALT TUNE/BEND DEPTH6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("607", "10002A2F", "INST2/ALT TUNE/BEND CONTROL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("608", "10002104", "INST2/DYNAMIC SYNTH/OSC/WAVEFORM", choices_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("609", "10002105", "INST2/DYNAMIC SYNTH/OSC/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("610", "10002106", "INST2/DYNAMIC SYNTH/OSC/FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("611", "10002107", "INST2/DYNAMIC SYNTH/OSC/PWM/PWM PULSE WIDTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("612", "10002108", "INST2/DYNAMIC SYNTH/OSC/PWM/PWM ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("613", "10002109", "INST2/DYNAMIC SYNTH/OSC/PWM/PWM ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("614", "1000210A", "INST2/DYNAMIC SYNTH/OSC/DETUNE SAW/DETUNE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("615", "1000210B", "INST2/DYNAMIC SYNTH/OSC/NOISE/SHARPNESS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("616", "1000210C", "INST2/DYNAMIC SYNTH/OSC/FEEDBACK OSC/FEEDBACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("617", "1000210D", "INST2/DYNAMIC SYNTH/OSC/FEEDBACK OSC/HARMONICS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("618", "1000210E", "INST2/DYNAMIC SYNTH/OSC/SUPER SAW/S-SAW DETUNE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("619", "1000210F", "INST2/DYNAMIC SYNTH/OSC/P. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("620", "10002110", "INST2/DYNAMIC SYNTH/OSC/P. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("621", "10002111", "INST2/DYNAMIC SYNTH/OSC/P. BEND DEPTH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("622", "10002112", "INST2/DYNAMIC SYNTH/OSC/P. BEND CTL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("623", "1000211C", "INST2/DYNAMIC SYNTH/FILTER/FILTER ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("624", "1000211D", "INST2/DYNAMIC SYNTH/FILTER/TYPE", choices_FILTER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("625", "1000211E", "INST2/DYNAMIC SYNTH/FILTER/SLOPE", choices_FILTER_SLOPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("626", "1000211F", "INST2/DYNAMIC SYNTH/FILTER/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("627", "10002120", "INST2/DYNAMIC SYNTH/FILTER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("628", "10002121", "INST2/DYNAMIC SYNTH/FILTER/F. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("629", "10002122", "INST2/DYNAMIC SYNTH/FILTER/F. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("630", "10002123", "INST2/DYNAMIC SYNTH/AMP/A. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("631", "10002125", "INST2/DYNAMIC SYNTH/AMP/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("632", "10002126", "INST2/DYNAMIC SYNTH/AMP/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("633", "10002127", "INST2/DYNAMIC SYNTH/LFO1/LFO1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("634", "10002128", "INST2/DYNAMIC SYNTH/LFO1/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("635", "10002129", "INST2/DYNAMIC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("636", "10002129", "INST2/DYNAMIC SYNTH/LFO1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("637", "1000212A", "INST2/DYNAMIC SYNTH/LFO1/DYNAMIC DEPTH", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("638", "1000212B", "INST2/DYNAMIC SYNTH/LFO1/PITCH DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("639", "1000212C", "INST2/DYNAMIC SYNTH/LFO1/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("640", "1000212D", "INST2/DYNAMIC SYNTH/LFO1/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("641", "1000212E", "INST2/DYNAMIC SYNTH/LFO1/PWM DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("642", "1000212F", "INST2/DYNAMIC SYNTH/LFO1/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("643", "10002130", "INST2/DYNAMIC SYNTH/LFO1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("644", "10002131", "INST2/DYNAMIC SYNTH/LFO2/LFO2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("645", "10002132", "INST2/DYNAMIC SYNTH/LFO2/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("646", "10002133", "INST2/DYNAMIC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("647", "10002133", "INST2/DYNAMIC SYNTH/LFO2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("648", "10002134", "INST2/DYNAMIC SYNTH/LFO2/DYNAMIC DEPTH", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("649", "10002135", "INST2/DYNAMIC SYNTH/LFO2/PITCH DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("650", "10002136", "INST2/DYNAMIC SYNTH/LFO2/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("651", "10002137", "INST2/DYNAMIC SYNTH/LFO2/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("652", "10002138", "INST2/DYNAMIC SYNTH/LFO2/PWM DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("653", "10002139", "INST2/DYNAMIC SYNTH/LFO2/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("654", "1000213A", "INST2/DYNAMIC SYNTH/LFO2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("655", "1000213B", "INST2/DYNAMIC SYNTH/SEQ/PITCH TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("656", "1000213C", "INST2/DYNAMIC SYNTH/SEQ/CUTOFF TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("657", "1000213D", "INST2/DYNAMIC SYNTH/SEQ/LEVEL TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("658", "1000213E", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP1 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("659", "1000213F", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP1 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("660", "10002140", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP2 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("661", "10002141", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP2 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("662", "10002142", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP3 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("663", "10002143", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP3 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("664", "10002144", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP4 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("665", "10002145", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP4 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("666", "10002146", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP5 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("667", "10002147", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP5 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("668", "10002148", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP6 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("669", "10002149", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP6 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("670", "1000214A", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP7 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("671", "1000214B", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP7 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("672", "1000214C", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP8 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("673", "1000214D", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP8 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("674", "1000214E", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP9 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("675", "1000214F", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP9 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("676", "10002150", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP10 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("677", "10002151", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP10 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("678", "10002152", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP11 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("679", "10002153", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP11 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("680", "10002154", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP12 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("681", "10002155", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP12 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("682", "10002156", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP13 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("683", "10002157", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP13 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("684", "10002158", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP14 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("685", "10002159", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP14 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("686", "1000215A", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP15 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("687", "1000215B", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP15 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("688", "1000215C", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP16 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("689", "1000215D", "INST2/DYNAMIC SYNTH/SEQ/PITCH STEP16 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("690", "1000215E", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP1 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("691", "1000215F", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP1 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("692", "10002160", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP2 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("693", "10002161", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP2 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("694", "10002162", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP3 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("695", "10002163", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP3 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("696", "10002164", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP4 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("697", "10002165", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP4 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("698", "10002166", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP5 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("699", "10002167", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP5 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("700", "10002168", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP6 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("701", "10002169", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP6 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("702", "1000216A", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP7 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("703", "1000216B", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP7 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("704", "1000216C", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP8 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("705", "1000216D", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP8 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("706", "1000216E", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP9 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("707", "1000216F", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP9 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("708", "10002170", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP10 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("709", "10002171", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP10 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("710", "10002172", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP11 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("711", "10002173", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP11 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("712", "10002174", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP12 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("713", "10002175", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP12 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("714", "10002176", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP13 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("715", "10002177", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP13 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("716", "10002178", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP14 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("717", "10002179", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP14 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("718", "1000217A", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP15 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("719", "1000217B", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP15 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("720", "1000217C", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP16 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("721", "1000217D", "INST2/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP16 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("722", "1000217E", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP1 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("723", "1000217F", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP1 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("724", "10002200", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP2 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("725", "10002201", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP2 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("726", "10002202", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP3 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("727", "10002203", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP3 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("728", "10002204", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP4 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("729", "10002205", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP4 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("730", "10002206", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP5 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("731", "10002207", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP5 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("732", "10002208", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP6 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("733", "10002209", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP6 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("734", "1000220A", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP7 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("735", "1000220B", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP7 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("736", "1000220C", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP8 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("737", "1000220D", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP8 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("738", "1000220E", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP9 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("739", "1000220F", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP9 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("740", "10002210", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP10 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("741", "10002211", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP10 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("742", "10002212", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP11 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("743", "10002213", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP11 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("744", "10002214", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP12 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("745", "10002215", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP12 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("746", "10002216", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP13 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("747", "10002217", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP13 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("748", "10002218", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP14 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("749", "10002219", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP14 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("750", "1000221A", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP15 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("751", "1000221B", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP15 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("752", "1000221C", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP16 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("753", "1000221D", "INST2/DYNAMIC SYNTH/SEQ/INST LEVEL STEP16 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("754", "1000221E", "INST2/DYNAMIC SYNTH/SEQ1/SEQ1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("755", "1000221F", "INST2/DYNAMIC SYNTH/SEQ1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("756", "10002220", "INST2/DYNAMIC SYNTH/SEQ1/LOOP LENGTH", {}, SINGLE, 1, 1, 16, 1, 0);
-        addParameter("757", "10002221", "INST2/DYNAMIC SYNTH/SEQ1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("758", "10002221", "INST2/DYNAMIC SYNTH/SEQ1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("759", "10002222", "INST2/DYNAMIC SYNTH/SEQ1/1 SHOT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("760", "10002223", "INST2/DYNAMIC SYNTH/SEQ1/TURBO", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("761", "10002224", "INST2/DYNAMIC SYNTH/SEQ1/STEP1 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("762", "10002225", "INST2/DYNAMIC SYNTH/SEQ1/STEP2 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("763", "10002226", "INST2/DYNAMIC SYNTH/SEQ1/STEP3 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("764", "10002227", "INST2/DYNAMIC SYNTH/SEQ1/STEP4 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("765", "10002228", "INST2/DYNAMIC SYNTH/SEQ1/STEP5 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("766", "10002229", "INST2/DYNAMIC SYNTH/SEQ1/STEP6 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("767", "1000222A", "INST2/DYNAMIC SYNTH/SEQ1/STEP7 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("768", "1000222B", "INST2/DYNAMIC SYNTH/SEQ1/STEP8 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("769", "1000222C", "INST2/DYNAMIC SYNTH/SEQ1/STEP9 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("770", "1000222D", "INST2/DYNAMIC SYNTH/SEQ1/STEP10 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("771", "1000222E", "INST2/DYNAMIC SYNTH/SEQ1/STEP11 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("772", "1000222F", "INST2/DYNAMIC SYNTH/SEQ1/STEP12 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("773", "10002230", "INST2/DYNAMIC SYNTH/SEQ1/STEP13 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("774", "10002231", "INST2/DYNAMIC SYNTH/SEQ1/STEP14 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("775", "10002232", "INST2/DYNAMIC SYNTH/SEQ1/STEP15 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("776", "10002233", "INST2/DYNAMIC SYNTH/SEQ1/STEP16 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("777", "10002234", "INST2/DYNAMIC SYNTH/SEQ2/SEQ2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("778", "10002235", "INST2/DYNAMIC SYNTH/SEQ2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("779", "10002236", "INST2/DYNAMIC SYNTH/SEQ2/LOOP LENGTH", {}, SINGLE, 1, 1, 16, 1, 0);
-        addParameter("780", "10002237", "INST2/DYNAMIC SYNTH/SEQ2/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("781", "10002237", "INST2/DYNAMIC SYNTH/SEQ2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("782", "10002238", "INST2/DYNAMIC SYNTH/SEQ2/1 SHOT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("783", "10002239", "INST2/DYNAMIC SYNTH/SEQ2/TURBO", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("784", "1000223A", "INST2/DYNAMIC SYNTH/SEQ2/STEP1 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("785", "1000223B", "INST2/DYNAMIC SYNTH/SEQ2/STEP2 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("786", "1000223C", "INST2/DYNAMIC SYNTH/SEQ2/STEP3 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("787", "1000223D", "INST2/DYNAMIC SYNTH/SEQ2/STEP4 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("788", "1000223E", "INST2/DYNAMIC SYNTH/SEQ2/STEP5 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("789", "1000223F", "INST2/DYNAMIC SYNTH/SEQ2/STEP6 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("790", "10002240", "INST2/DYNAMIC SYNTH/SEQ2/STEP7 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("791", "10002241", "INST2/DYNAMIC SYNTH/SEQ2/STEP8 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("792", "10002242", "INST2/DYNAMIC SYNTH/SEQ2/STEP9 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("793", "10002243", "INST2/DYNAMIC SYNTH/SEQ2/STEP10 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("794", "10002244", "INST2/DYNAMIC SYNTH/SEQ2/STEP11 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("795", "10002245", "INST2/DYNAMIC SYNTH/SEQ2/STEP12 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("796", "10002246", "INST2/DYNAMIC SYNTH/SEQ2/STEP13 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("797", "10002247", "INST2/DYNAMIC SYNTH/SEQ2/STEP14 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("798", "10002248", "INST2/DYNAMIC SYNTH/SEQ2/STEP15 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("799", "10002249", "INST2/DYNAMIC SYNTH/SEQ2/STEP16 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("800", "1000224A", "INST2/DYNAMIC SYNTH/LAYER/L. FADE", {}, SINGLE, 1, 1, 60, 1, 0);
-        addParameter("801", "1000224B", "INST2/DYNAMIC SYNTH/LAYER/LOWER", choices_LOWER_UPPER, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("802", "1000224C", "INST2/DYNAMIC SYNTH/LAYER/UPPER", choices_LOWER_UPPER, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("803", "1000224D", "INST2/DYNAMIC SYNTH/LAYER/U. FADE", {}, SINGLE, 1, 1, 60, 1, 0);
-        addParameter("804", "10002300", "INST2/OSC SYNTH/OSC/MODE", choices_OSC_SYNTH_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("805", "10002301", "INST2/OSC SYNTH/OSC/WAVEFORM1", choices_OSC_SYNTH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("806", "10002302", "INST2/OSC SYNTH/OSC/PITCH1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("807", "10002303", "INST2/OSC SYNTH/OSC/FINE1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("808", "10002304", "INST2/OSC SYNTH/OSC/PWM1/PULSE WIDTH1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("809", "10002305", "INST2/OSC SYNTH/OSC/PWM1/PW MOD RATE1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("810", "10002306", "INST2/OSC SYNTH/OSC/P. ENV ATTACK1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("811", "10002307", "INST2/OSC SYNTH/OSC/P. ENV DECAY1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("812", "10002308", "INST2/OSC SYNTH/OSC/P. ENV DEPTH1", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("813", "10002309", "INST2/OSC SYNTH/OSC/LEVEL1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("814", "1000230A", "INST2/OSC SYNTH/OSC/WAVEFORM2", choices_OSC_SYNTH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("815", "1000230B", "INST2/OSC SYNTH/OSC/PITCH2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("816", "1000230C", "INST2/OSC SYNTH/OSC/FINE2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("817", "1000230D", "INST2/OSC SYNTH/OSC/PWM2/PULSE WIDTH2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("818", "1000230E", "INST2/OSC SYNTH/OSC/PWM2/PW MOD RATE2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("819", "1000230F", "INST2/OSC SYNTH/OSC/P. ENV ATTACK2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("820", "10002310", "INST2/OSC SYNTH/OSC/P. ENV DECAY2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("821", "10002311", "INST2/OSC SYNTH/OSC/P. ENV DEPTH2", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("822", "10002312", "INST2/OSC SYNTH/OSC/LEVEL2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("823", "10002313", "INST2/OSC SYNTH/OSC/MONO_POLY SW", choices_MONO_POLY_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("824", "10002314", "INST2/OSC SYNTH/OSC/CHROMATIC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("825", "10002315", "INST2/OSC SYNTH/OSC/PORTA SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("826", "10002316", "INST2/OSC SYNTH/OSC/PORTA TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("827", "10002317", "INST2/OSC SYNTH/OSC/PORTA MODE", choices_PORTA_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("828", "10002318", "INST2/OSC SYNTH/OSC/HOLD MODE", choices_HOLD_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("829", "10002319", "INST2/OSC SYNTH/OSC/LOW VELO CUT", {}, SINGLE, 1, 0, 10, 0, 0);
-        addParameter("830", "1000231A", "INST2/OSC SYNTH/FILTER/FILTER ON/OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("831", "1000231B", "INST2/OSC SYNTH/FILTER/TYPE", choices_FILTER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("832", "1000231C", "INST2/OSC SYNTH/FILTER/SLOPE", choices_FILTER_SLOPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("833", "1000231D", "INST2/OSC SYNTH/FILTER/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("834", "1000231E", "INST2/OSC SYNTH/FILTER/CUTOFF FOLLOW", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("835", "1000231F", "INST2/OSC SYNTH/FILTER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("836", "10002320", "INST2/OSC SYNTH/FILTER/VELOCITY SENS", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("837", "10002321", "INST2/OSC SYNTH/FILTER/F. ENV ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("838", "10002322", "INST2/OSC SYNTH/FILTER/F. ENV DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("839", "10002323", "INST2/OSC SYNTH/FILTER/F. ENV SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("840", "10002324", "INST2/OSC SYNTH/FILTER/F. ENV RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("841", "10002325", "INST2/OSC SYNTH/FILTER/F. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("842", "10002326", "INST2/OSC SYNTH/AMP/VELOCITY SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("843", "10002327", "INST2/OSC SYNTH/AMP/A. ENV ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("844", "10002328", "INST2/OSC SYNTH/AMP/A. ENV DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("845", "10002329", "INST2/OSC SYNTH/AMP/A. ENV SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("846", "1000232A", "INST2/OSC SYNTH/AMP/A. ENV RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("847", "1000232B", "INST2/OSC SYNTH/AMP/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("848", "1000232C", "INST2/OSC SYNTH/AMP/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("849", "1000232D", "INST2/OSC SYNTH/LFO1/LFO1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("850", "1000232E", "INST2/OSC SYNTH/LFO1/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("851", "1000232F", "INST2/OSC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("852", "1000232F", "INST2/OSC SYNTH/LFO1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("853", "10002330", "INST2/OSC SYNTH/LFO1/PITCH1 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("854", "10002331", "INST2/OSC SYNTH/LFO1/PITCH2 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("855", "10002332", "INST2/OSC SYNTH/LFO1/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("856", "10002333", "INST2/OSC SYNTH/LFO1/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("857", "10002334", "INST2/OSC SYNTH/LFO1/DELAY TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("858", "10002335", "INST2/OSC SYNTH/LFO1/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("859", "10002336", "INST2/OSC SYNTH/LFO1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("860", "10002337", "INST2/OSC SYNTH/LFO2/LFO2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("861", "10002338", "INST2/OSC SYNTH/LFO2/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("862", "10002339", "INST2/OSC SYNTH/LFO2/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("863", "10002339", "INST2/OSC SYNTH/LFO2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("864", "1000233A", "INST2/OSC SYNTH/LFO2/PITCH1 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("865", "1000233B", "INST2/OSC SYNTH/LFO2/PITCH2 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("866", "1000233C", "INST2/OSC SYNTH/LFO2/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("867", "1000233D", "INST2/OSC SYNTH/LFO2/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("868", "1000233E", "INST2/OSC SYNTH/LFO2/DELAY TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("869", "1000233F", "INST2/OSC SYNTH/LFO2/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("870", "10002340", "INST2/OSC SYNTH/LFO2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("871", "10002400", "INST2/GR-300/MODE", choices_GR_300_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("872", "10002401", "INST2/GR-300/VXX/COMP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("873", "10002402", "INST2/GR-300/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("874", "10002403", "INST2/GR-300/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("875", "10002404", "INST2/GR-300/ENV MOD SW", choices_ENV_MOD_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("876", "10002405", "INST2/GR-300/ENV MOD SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("877", "10002406", "INST2/GR-300/ENV MOD ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("878", "10002407", "INST2/GR-300/VXX/PITCH SW", choices_PITCH_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("879", "10002408", "INST2/GR-300/VXX/PITCH A", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("880", "10002409", "INST2/GR-300/VXX/FINE A", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("881", "1000240A", "INST2/GR-300/VXX/PITCH B", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("882", "1000240B", "INST2/GR-300/VXX/FINE B", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("883", "1000240C", "INST2/GR-300/VXX/DUET SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("884", "1000240D", "INST2/GR-300/VXX/SWEEP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("885", "1000240E", "INST2/GR-300/VXX/SWEEP RISE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("886", "1000240F", "INST2/GR-300/VXX/SWEEP FALL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("887", "10002410", "INST2/GR-300/VXX/VIBRATO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("888", "10002411", "INST2/GR-300/VXX/VIBRATO RATE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("889", "10002412", "INST2/GR-300/VXX/VIBRATO DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("890", "10002413", "INST2/GR-300/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("891", "10002414", "INST2/GR-300/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("892", "10002500", "INST2/E.GUITAR/GUITAR/TYPE", choices_GUITAR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("893", "10002501", "INST2/E.GUITAR/GUITAR/PU SELECT", choices_GUITAR_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("894", "10002502", "INST2/E.GUITAR/GUITAR/FRETLESS/TONE TYPE", choices_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("895", "10002503", "INST2/E.GUITAR/GUITAR/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("896", "10002504", "INST2/E.GUITAR/GUITAR/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("897", "10002505", "INST2/E.GUITAR/GUITAR/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("898", "10002506", "INST2/E.GUITAR/GUITAR/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("899", "10002507", "INST2/E.GUITAR/GUITAR/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("900", "10002508", "INST2/E.GUITAR/GUITAR/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("901", "10002509", "INST2/E.GUITAR/GUITAR/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("902", "1000250A", "INST2/E.GUITAR/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("903", "1000250B", "INST2/E.GUITAR/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("904", "1000250C", "INST2/E.GUITAR/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("905", "1000250D", "INST2/E.GUITAR/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("906", "1000250E", "INST2/E.GUITAR/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("907", "1000250F", "INST2/E.GUITAR/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("908", "10002510", "INST2/E.GUITAR/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("909", "10002511", "INST2/E.GUITAR/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("910", "10002512", "INST2/E.GUITAR/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("911", "10002513", "INST2/E.GUITAR/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("912", "10002514", "INST2/E.GUITAR/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("913", "10002515", "INST2/E.GUITAR/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("914", "10002516", "INST2/E.GUITAR/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("915", "10002517", "INST2/E.GUITAR/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("916", "10002518", "INST2/E.GUITAR/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("917", "10002519", "INST2/E.GUITAR/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("918", "1000251A", "INST2/E.GUITAR/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("919", "1000251B", "INST2/E.GUITAR/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("920", "1000251C", "INST2/E.GUITAR/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("921", "1000251D", "INST2/E.GUITAR/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("922", "1000251E", "INST2/E.GUITAR/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("923", "1000251F", "INST2/E.GUITAR/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("924", "10002520", "INST2/E.GUITAR/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("925", "10002521", "INST2/E.GUITAR/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("926", "10002522", "INST2/E.GUITAR/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("927", "10002523", "INST2/E.GUITAR/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("928", "10002524", "INST2/E.GUITAR/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("929", "10002525", "INST2/E.GUITAR/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("930", "10002526", "INST2/E.GUITAR/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("931", "10002527", "INST2/E.GUITAR/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("932", "10002528", "INST2/E.GUITAR/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("933", "10002529", "INST2/E.GUITAR/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("934", "1000252A", "INST2/E.GUITAR/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("935", "1000252B", "INST2/E.GUITAR/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("936", "1000252C", "INST2/E.GUITAR/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("937", "10002600", "INST2/ACOUSTIC/ACOUSTIC/TYPE", choices_ACOUSTIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("938", "10002601", "INST2/ACOUSTIC/ACOUSTIC/BODY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("939", "10002602", "INST2/ACOUSTIC/ACOUSTIC/NYLON BENJO SITAR/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("940", "10002603", "INST2/ACOUSTIC/ACOUSTIC/SITAR/PU SELECT", choices_ACOUSTIC_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("941", "10002604", "INST2/ACOUSTIC/ACOUSTIC/SITAR/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("942", "10002605", "INST2/ACOUSTIC/ACOUSTIC/SITAR/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("943", "10002606", "INST2/ACOUSTIC/ACOUSTIC/SITAR/DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("944", "10002607", "INST2/ACOUSTIC/ACOUSTIC/SITAR/BUZZ", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("945", "10002608", "INST2/ACOUSTIC/ACOUSTIC/RESO BANJO/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("946", "10002609", "INST2/ACOUSTIC/ACOUSTIC/RESO/SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("947", "1000260A", "INST2/ACOUSTIC/ACOUSTIC/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("948", "1000260B", "INST2/ACOUSTIC/ACOUSTIC/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("949", "1000260C", "INST2/ACOUSTIC/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("950", "1000260D", "INST2/ACOUSTIC/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("951", "1000260E", "INST2/ACOUSTIC/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("952", "1000260F", "INST2/ACOUSTIC/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("953", "10002610", "INST2/ACOUSTIC/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("954", "10002611", "INST2/ACOUSTIC/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("955", "10002612", "INST2/ACOUSTIC/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("956", "10002613", "INST2/ACOUSTIC/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("957", "10002614", "INST2/ACOUSTIC/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("958", "10002615", "INST2/ACOUSTIC/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("959", "10002616", "INST2/ACOUSTIC/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("960", "10002617", "INST2/ACOUSTIC/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("961", "10002618", "INST2/ACOUSTIC/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("962", "10002619", "INST2/ACOUSTIC/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("963", "1000261A", "INST2/ACOUSTIC/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("964", "1000261B", "INST2/ACOUSTIC/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("965", "1000261C", "INST2/ACOUSTIC/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("966", "1000261D", "INST2/ACOUSTIC/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("967", "1000261E", "INST2/ACOUSTIC/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("968", "1000261F", "INST2/ACOUSTIC/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("969", "10002620", "INST2/ACOUSTIC/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("970", "10002621", "INST2/ACOUSTIC/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("971", "10002622", "INST2/ACOUSTIC/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("972", "10002623", "INST2/ACOUSTIC/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("973", "10002624", "INST2/ACOUSTIC/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("974", "10002625", "INST2/ACOUSTIC/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("975", "10002626", "INST2/ACOUSTIC/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("976", "10002627", "INST2/ACOUSTIC/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("977", "10002628", "INST2/ACOUSTIC/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("978", "10002629", "INST2/ACOUSTIC/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("979", "1000262A", "INST2/ACOUSTIC/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("980", "1000262B", "INST2/ACOUSTIC/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("981", "1000262C", "INST2/ACOUSTIC/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("982", "1000262D", "INST2/ACOUSTIC/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("983", "1000262E", "INST2/ACOUSTIC/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("984", "10002700", "INST2/E.BASS/BASS/TYPE", choices_E_BASS_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("985", "10002701", "INST2/E.BASS/BASS/JB/FRONT VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("986", "10002702", "INST2/E.BASS/BASS/JB/REAR VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("987", "10002703", "INST2/E.BASS/BASS/FRETLESS/TONE TYPE", choices_E_BASS_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("988", "10002704", "INST2/E.BASS/BASS/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("989", "10002705", "INST2/E.BASS/BASS/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("990", "10002706", "INST2/E.BASS/BASS/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("991", "10002707", "INST2/E.BASS/BASS/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("992", "10002708", "INST2/E.BASS/BASS/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("993", "10002709", "INST2/E.BASS/BASS/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("994", "1000270A", "INST2/E.BASS/BASS/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("995", "1000270B", "INST2/E.BASS/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("996", "1000270C", "INST2/E.BASS/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("997", "1000270D", "INST2/E.BASS/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("998", "1000270E", "INST2/E.BASS/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("999", "1000270F", "INST2/E.BASS/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1000", "10002710", "INST2/E.BASS/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1001", "10002711", "INST2/E.BASS/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1002", "10002712", "INST2/E.BASS/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1003", "10002713", "INST2/E.BASS/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1004", "10002714", "INST2/E.BASS/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1005", "10002715", "INST2/E.BASS/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1006", "10002716", "INST2/E.BASS/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1007", "10002717", "INST2/E.BASS/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1008", "10002718", "INST2/E.BASS/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1009", "10002719", "INST2/E.BASS/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1010", "1000271A", "INST2/E.BASS/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1011", "1000271B", "INST2/E.BASS/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1012", "1000271C", "INST2/E.BASS/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1013", "1000271D", "INST2/E.BASS/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1014", "1000271E", "INST2/E.BASS/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1015", "1000271F", "INST2/E.BASS/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1016", "10002720", "INST2/E.BASS/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1017", "10002721", "INST2/E.BASS/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1018", "10002722", "INST2/E.BASS/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1019", "10002723", "INST2/E.BASS/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1020", "10002724", "INST2/E.BASS/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1021", "10002725", "INST2/E.BASS/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1022", "10002726", "INST2/E.BASS/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1023", "10002727", "INST2/E.BASS/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1024", "10002728", "INST2/E.BASS/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1025", "10002729", "INST2/E.BASS/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1026", "1000272A", "INST2/E.BASS/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1027", "1000272B", "INST2/E.BASS/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1028", "1000272C", "INST2/E.BASS/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1029", "1000272D", "INST2/E.BASS/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1030", "10002800", "INST2/VIO GUITAR/GUITAR/TYPE", choices_GUITAR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1031", "10002801", "INST2/VIO GUITAR/GUITAR/PU SELECT", choices_GUITAR_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1032", "10002802", "INST2/VIO GUITAR/GUITAR/FRETLESS/TONE TYPE", choices_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1033", "10002803", "INST2/VIO GUITAR/GUITAR/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1034", "10002804", "INST2/VIO GUITAR/GUITAR/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1035", "10002805", "INST2/VIO GUITAR/GUITAR/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1036", "10002806", "INST2/VIO GUITAR/GUITAR/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1037", "10002807", "INST2/VIO GUITAR/GUITAR/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1038", "10002808", "INST2/VIO GUITAR/GUITAR/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1039", "10002809", "INST2/VIO GUITAR/GUITAR/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1040", "1000280A", "INST2/VIO GUITAR/HARMO/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1041", "1000280B", "INST2/VIO GUITAR/HARMO/GAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1042", "1000280C", "INST2/VIO GUITAR/HARMO/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1043", "1000280D", "INST2/VIO GUITAR/HARMO/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1044", "1000280E", "INST2/VIO GUITAR/FILTER/OVERTONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1045", "1000280F", "INST2/VIO GUITAR/FILTER/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1046", "10002810", "INST2/VIO GUITAR/FILTER/POWER BEND", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1047", "10002811", "INST2/VIO GUITAR/FILTER/SLIDE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1048", "10002812", "INST2/VIO GUITAR/FILTER/OCTAVE", choices_OCTAVE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1049", "10002813", "INST2/VIO GUITAR/FILTER/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1050", "10002814", "INST2/VIO GUITAR/FILTER/TOUCH SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1051", "10002815", "INST2/VIO GUITAR/FILTER/LEAD EMPHASIS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1052", "10002816", "INST2/VIO GUITAR/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1053", "10002817", "INST2/VIO GUITAR/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1054", "10002818", "INST2/VIO GUITAR/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1055", "10002819", "INST2/VIO GUITAR/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1056", "1000281A", "INST2/VIO GUITAR/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1057", "1000281B", "INST2/VIO GUITAR/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1058", "1000281C", "INST2/VIO GUITAR/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1059", "1000281D", "INST2/VIO GUITAR/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1060", "1000281E", "INST2/VIO GUITAR/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1061", "1000281F", "INST2/VIO GUITAR/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1062", "10002820", "INST2/VIO GUITAR/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1063", "10002821", "INST2/VIO GUITAR/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1064", "10002822", "INST2/VIO GUITAR/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1065", "10002823", "INST2/VIO GUITAR/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1066", "10002824", "INST2/VIO GUITAR/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1067", "10002900", "INST2/POLY FX/POLY FX/TYPE", choices_POLY_FX_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1068", "10002901", "INST2/POLY FX/POLY FX/GUITAR VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1069", "10002902", "INST2/POLY FX/POLY FX/DISTORTION/GAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1070", "10002903", "INST2/POLY FX/POLY FX/DISTORTION/GAIN BALANCE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1071", "10002904", "INST2/POLY FX/POLY FX/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1072", "10002905", "INST2/POLY FX/POLY FX/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1073", "10002906", "INST2/POLY FX/POLY FX/TOUCH WAH/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1074", "10002907", "INST2/POLY FX/POLY FX/TOUCH WAH/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1075", "10002908", "INST2/POLY FX/POLY FX/TOUCH WAH/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1076", "10002909", "INST2/POLY FX/POLY FX/TOUCH WAH/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1077", "1000290A", "INST2/POLY FX/POLY FX/TOUCH WAH/DECAY", {}, SINGLE, 1, 0, 10, 0, 0);
-        addParameter("1078", "1000290B", "INST2/POLY FX/POLY FX/TOUCH WAH/PEAK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1079", "1000290C", "INST2/POLY FX/POLY FX/TOUCH WAH/TONE TYPE", choices_POLY_FX_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1080", "1000290D", "INST2/POLY FX/POLY FX/TOUCH WAH/COMP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1081", "1000290E", "INST2/POLY FX/POLY FX/TOUCH WAH/COMP SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1082", "1000290F", "INST2/POLY FX/POLY FX/TOUCH WAH/COMP ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1083", "10002910", "INST2/POLY FX/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1084", "10002911", "INST2/POLY FX/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1085", "10002912", "INST2/POLY FX/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1086", "10002B00", "INST3/COMMON/INST ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1087", "10002B01", "INST3/COMMON/INST TYPE", choices_INST_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1088", "10002B02", "INST3/COMMON/INST LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1089", "10002B03", "INST3/COMMON/NOR MIX SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1090", "10002B04", "INST3/COMMON/NOR MIX LEVEL", {}, SINGLE, 2, 0, 200, 0, 0);
-        addParameter("1091", "10002B06", "INST3/COMMON/STRING LEVEL1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1092", "10002B07", "INST3/COMMON/STRING LEVEL2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1093", "10002B08", "INST3/COMMON/STRING LEVEL3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1094", "10002B09", "INST3/COMMON/STRING LEVEL4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1095", "10002B0A", "INST3/COMMON/STRING LEVEL5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1096", "10002B0B", "INST3/COMMON/STRING LEVEL6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1097", "10002B0C", "INST3/COMMON/STRING PAN1", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1098", "10002B0D", "INST3/COMMON/STRING PAN2", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1099", "10002B0E", "INST3/COMMON/STRING PAN3", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1100", "10002B0F", "INST3/COMMON/STRING PAN4", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1101", "10002B10", "INST3/COMMON/STRING PAN5", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1102", "10002B11", "INST3/COMMON/STRING PAN6", choices_L50_R50, SINGLE, 1, 0, 100, 50, 0);
-        addParameter("1103", "10003500", "INST3/ALT TUNE/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1104", "10003501", "INST3/ALT TUNE/TUNING TYPE", choices_TUNING_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1105", "10003502", "INST3/ALT TUNE/USER/PITCH 1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1106", "10003503", "INST3/ALT TUNE/USER/PITCH 2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1107", "10003504", "INST3/ALT TUNE/USER/PITCH 3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1108", "10003505", "INST3/ALT TUNE/USER/PITCH 4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1109", "10003506", "INST3/ALT TUNE/USER/PITCH 5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1110", "10003507", "INST3/ALT TUNE/USER/PITCH 6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1111", "10003508", "INST3/ALT TUNE/USER/FINE 1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1112", "10003509", "INST3/ALT TUNE/USER/FINE 2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1113", "1000350A", "INST3/ALT TUNE/USER/FINE 3", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1114", "1000350B", "INST3/ALT TUNE/USER/FINE 4", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1115", "1000350C", "INST3/ALT TUNE/USER/FINE 5", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1116", "1000350D", "INST3/ALT TUNE/USER/FINE 6", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1117", "1000350E", "INST3/ALT TUNE/GUITAR/12STR SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1118", "1000350F", "INST3/ALT TUNE/GUITAR/12STR TYPE", choices_12STR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1119", "10003510", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1120", "10003511", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1121", "10003512", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1122", "10003513", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1123", "10003514", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1124", "10003515", "INST3/ALT TUNE/GUITAR USER/12STR PITCH 6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1125", "10003516", "INST3/ALT TUNE/GUITAR USER/12STR FINE 1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1126", "10003517", "INST3/ALT TUNE/GUITAR USER/12STR FINE 2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1127", "10003518", "INST3/ALT TUNE/GUITAR USER/12STR FINE 3", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1128", "10003519", "INST3/ALT TUNE/GUITAR USER/12STR FINE 4", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1129", "1000351A", "INST3/ALT TUNE/GUITAR USER/12STR FINE 5", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1130", "1000351B", "INST3/ALT TUNE/GUITAR USER/12STR FINE 6", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1131", "1000351C", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1132", "1000351D", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1133", "1000351E", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1134", "1000351F", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1135", "10003520", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1136", "10003521", "INST3/ALT TUNE/GUITAR USER/12STR LEVEL 6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1137", "10003522", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1138", "10003523", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1139", "10003524", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 3", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1140", "10003525", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 4", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1141", "10003526", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 5", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1142", "10003527", "INST3/ALT TUNE/GUITAR USER/12STR DELAY 6", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1143", "10003528", "INST3/ALT TUNE/GUITAR USER/STR BEND SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1144", "10003529", "INST3/ALT TUNE/BEND DEPTH1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1145", "1000352A", "INST3/ALT TUNE/BEND DEPTH2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1146", "1000352B", "INST3/ALT TUNE/BEND DEPTH3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1147", "1000352C", "INST3/ALT TUNE/BEND DEPTH4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1148", "1000352D", "INST3/ALT TUNE/BEND DEPTH5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1149", "1000352E", "INST3/ALT TUNE/BEND DEPTH6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1150", "1000352F", "INST3/ALT TUNE/BEND CONTROL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1151", "10002C04", "INST3/DYNAMIC SYNTH/OSC/WAVEFORM", choices_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1152", "10002C05", "INST3/DYNAMIC SYNTH/OSC/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1153", "10002C06", "INST3/DYNAMIC SYNTH/OSC/FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1154", "10002C07", "INST3/DYNAMIC SYNTH/OSC/PWM/PWM PULSE WIDTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1155", "10002C08", "INST3/DYNAMIC SYNTH/OSC/PWM/PWM ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1156", "10002C09", "INST3/DYNAMIC SYNTH/OSC/PWM/PWM ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1157", "10002C0A", "INST3/DYNAMIC SYNTH/OSC/DETUNE SAW/DETUNE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1158", "10002C0B", "INST3/DYNAMIC SYNTH/OSC/NOISE/SHARPNESS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1159", "10002C0C", "INST3/DYNAMIC SYNTH/OSC/FEEDBACK OSC/FEEDBACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1160", "10002C0D", "INST3/DYNAMIC SYNTH/OSC/FEEDBACK OSC/HARMONICS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1161", "10002C0E", "INST3/DYNAMIC SYNTH/OSC/SUPER SAW/S-SAW DETUNE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1162", "10002C0F", "INST3/DYNAMIC SYNTH/OSC/P. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1163", "10002C10", "INST3/DYNAMIC SYNTH/OSC/P. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1164", "10002C11", "INST3/DYNAMIC SYNTH/OSC/P. BEND DEPTH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1165", "10002C12", "INST3/DYNAMIC SYNTH/OSC/P. BEND CTL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1166", "10002C1C", "INST3/DYNAMIC SYNTH/FILTER/FILTER ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1167", "10002C1D", "INST3/DYNAMIC SYNTH/FILTER/TYPE", choices_FILTER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1168", "10002C1E", "INST3/DYNAMIC SYNTH/FILTER/SLOPE", choices_FILTER_SLOPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1169", "10002C1F", "INST3/DYNAMIC SYNTH/FILTER/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1170", "10002C20", "INST3/DYNAMIC SYNTH/FILTER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1171", "10002C21", "INST3/DYNAMIC SYNTH/FILTER/F. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1172", "10002C22", "INST3/DYNAMIC SYNTH/FILTER/F. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1173", "10002C23", "INST3/DYNAMIC SYNTH/AMP/A. ENV ATTACK", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1174", "10002C25", "INST3/DYNAMIC SYNTH/AMP/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1175", "10002C26", "INST3/DYNAMIC SYNTH/AMP/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1176", "10002C27", "INST3/DYNAMIC SYNTH/LFO1/LFO1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1177", "10002C28", "INST3/DYNAMIC SYNTH/LFO1/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1178", "10002C29", "INST3/DYNAMIC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1179", "10002C29", "INST3/DYNAMIC SYNTH/LFO1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1180", "10002C2A", "INST3/DYNAMIC SYNTH/LFO1/DYNAMIC DEPTH", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1181", "10002C2B", "INST3/DYNAMIC SYNTH/LFO1/PITCH DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1182", "10002C2C", "INST3/DYNAMIC SYNTH/LFO1/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1183", "10002C2D", "INST3/DYNAMIC SYNTH/LFO1/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1184", "10002C2E", "INST3/DYNAMIC SYNTH/LFO1/PWM DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1185", "10002C2F", "INST3/DYNAMIC SYNTH/LFO1/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1186", "10002C30", "INST3/DYNAMIC SYNTH/LFO1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1187", "10002C31", "INST3/DYNAMIC SYNTH/LFO2/LFO2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1188", "10002C32", "INST3/DYNAMIC SYNTH/LFO2/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1189", "10002C33", "INST3/DYNAMIC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1190", "10002C33", "INST3/DYNAMIC SYNTH/LFO2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1191", "10002C34", "INST3/DYNAMIC SYNTH/LFO2/DYNAMIC DEPTH", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1192", "10002C35", "INST3/DYNAMIC SYNTH/LFO2/PITCH DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1193", "10002C36", "INST3/DYNAMIC SYNTH/LFO2/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1194", "10002C37", "INST3/DYNAMIC SYNTH/LFO2/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1195", "10002C38", "INST3/DYNAMIC SYNTH/LFO2/PWM DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1196", "10002C39", "INST3/DYNAMIC SYNTH/LFO2/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1197", "10002C3A", "INST3/DYNAMIC SYNTH/LFO2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1198", "10002C3B", "INST3/DYNAMIC SYNTH/SEQ/PITCH TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1199", "10002C3C", "INST3/DYNAMIC SYNTH/SEQ/CUTOFF TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1200", "10002C3D", "INST3/DYNAMIC SYNTH/SEQ/LEVEL TARGET", choices_SEQ_TARGET, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1201", "10002C3E", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP1 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1202", "10002C3F", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP1 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1203", "10002C40", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP2 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1204", "10002C41", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP2 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1205", "10002C42", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP3 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1206", "10002C43", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP3 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1207", "10002C44", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP4 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1208", "10002C45", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP4 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1209", "10002C46", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP5 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1210", "10002C47", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP5 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1211", "10002C48", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP6 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1212", "10002C49", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP6 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1213", "10002C4A", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP7 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1214", "10002C4B", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP7 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1215", "10002C4C", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP8 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1216", "10002C4D", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP8 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1217", "10002C4E", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP9 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1218", "10002C4F", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP9 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1219", "10002C50", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP10 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1220", "10002C51", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP10 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1221", "10002C52", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP11 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1222", "10002C53", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP11 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1223", "10002C54", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP12 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1224", "10002C55", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP12 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1225", "10002C56", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP13 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1226", "10002C57", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP13 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1227", "10002C58", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP14 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1228", "10002C59", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP14 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1229", "10002C5A", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP15 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1230", "10002C5B", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP15 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1231", "10002C5C", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP16 MIN", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1232", "10002C5D", "INST3/DYNAMIC SYNTH/SEQ/PITCH STEP16 MAX", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1233", "10002C5E", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP1 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1234", "10002C5F", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP1 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1235", "10002C60", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP2 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1236", "10002C61", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP2 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1237", "10002C62", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP3 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1238", "10002C63", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP3 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1239", "10002C64", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP4 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1240", "10002C65", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP4 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1241", "10002C66", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP5 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1242", "10002C67", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP5 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1243", "10002C68", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP6 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1244", "10002C69", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP6 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1245", "10002C6A", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP7 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1246", "10002C6B", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP7 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1247", "10002C6C", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP8 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1248", "10002C6D", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP8 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1249", "10002C6E", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP9 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1250", "10002C6F", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP9 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1251", "10002C70", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP10 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1252", "10002C71", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP10 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1253", "10002C72", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP11 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1254", "10002C73", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP11 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1255", "10002C74", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP12 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1256", "10002C75", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP12 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1257", "10002C76", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP13 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1258", "10002C77", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP13 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1259", "10002C78", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP14 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1260", "10002C79", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP14 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1261", "10002C7A", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP15 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1262", "10002C7B", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP15 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1263", "10002C7C", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP16 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1264", "10002C7D", "INST3/DYNAMIC SYNTH/SEQ/FILTER CUTOFF STEP16 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1265", "10002C7E", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP1 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1266", "10002C7F", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP1 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1267", "10002D00", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP2 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1268", "10002D01", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP2 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1269", "10002D02", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP3 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1270", "10002D03", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP3 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1271", "10002D04", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP4 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1272", "10002D05", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP4 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1273", "10002D06", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP5 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1274", "10002D07", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP5 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1275", "10002D08", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP6 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1276", "10002D09", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP6 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1277", "10002D0A", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP7 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1278", "10002D0B", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP7 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1279", "10002D0C", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP8 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1280", "10002D0D", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP8 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1281", "10002D0E", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP9 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1282", "10002D0F", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP9 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1283", "10002D10", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP10 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1284", "10002D11", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP10 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1285", "10002D12", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP11 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1286", "10002D13", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP11 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1287", "10002D14", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP12 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1288", "10002D15", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP12 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1289", "10002D16", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP13 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1290", "10002D17", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP13 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1291", "10002D18", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP14 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1292", "10002D19", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP14 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1293", "10002D1A", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP15 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1294", "10002D1B", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP15 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1295", "10002D1C", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP16 MIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1296", "10002D1D", "INST3/DYNAMIC SYNTH/SEQ/INST LEVEL STEP16 MAX", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1297", "10002D1E", "INST3/DYNAMIC SYNTH/SEQ1/SEQ1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1298", "10002D1F", "INST3/DYNAMIC SYNTH/SEQ1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1299", "10002D20", "INST3/DYNAMIC SYNTH/SEQ1/LOOP LENGTH", {}, SINGLE, 1, 1, 16, 1, 0);
-        addParameter("1300", "10002D21", "INST3/DYNAMIC SYNTH/SEQ1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1301", "10002D21", "INST3/DYNAMIC SYNTH/SEQ1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1302", "10002D22", "INST3/DYNAMIC SYNTH/SEQ1/1 SHOT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1303", "10002D23", "INST3/DYNAMIC SYNTH/SEQ1/TURBO", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1304", "10002D24", "INST3/DYNAMIC SYNTH/SEQ1/STEP1 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1305", "10002D25", "INST3/DYNAMIC SYNTH/SEQ1/STEP2 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1306", "10002D26", "INST3/DYNAMIC SYNTH/SEQ1/STEP3 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1307", "10002D27", "INST3/DYNAMIC SYNTH/SEQ1/STEP4 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1308", "10002D28", "INST3/DYNAMIC SYNTH/SEQ1/STEP5 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1309", "10002D29", "INST3/DYNAMIC SYNTH/SEQ1/STEP6 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1310", "10002D2A", "INST3/DYNAMIC SYNTH/SEQ1/STEP7 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1311", "10002D2B", "INST3/DYNAMIC SYNTH/SEQ1/STEP8 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1312", "10002D2C", "INST3/DYNAMIC SYNTH/SEQ1/STEP9 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1313", "10002D2D", "INST3/DYNAMIC SYNTH/SEQ1/STEP10 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1314", "10002D2E", "INST3/DYNAMIC SYNTH/SEQ1/STEP11 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1315", "10002D2F", "INST3/DYNAMIC SYNTH/SEQ1/STEP12 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1316", "10002D30", "INST3/DYNAMIC SYNTH/SEQ1/STEP13 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1317", "10002D31", "INST3/DYNAMIC SYNTH/SEQ1/STEP14 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1318", "10002D32", "INST3/DYNAMIC SYNTH/SEQ1/STEP15 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1319", "10002D33", "INST3/DYNAMIC SYNTH/SEQ1/STEP16 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1320", "10002D34", "INST3/DYNAMIC SYNTH/SEQ2/SEQ2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1321", "10002D35", "INST3/DYNAMIC SYNTH/SEQ2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1322", "10002D36", "INST3/DYNAMIC SYNTH/SEQ2/LOOP LENGTH", {}, SINGLE, 1, 1, 16, 1, 0);
-        addParameter("1323", "10002D37", "INST3/DYNAMIC SYNTH/SEQ2/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1324", "10002D37", "INST3/DYNAMIC SYNTH/SEQ2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1325", "10002D38", "INST3/DYNAMIC SYNTH/SEQ2/1 SHOT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1326", "10002D39", "INST3/DYNAMIC SYNTH/SEQ2/TURBO", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1327", "10002D3A", "INST3/DYNAMIC SYNTH/SEQ2/STEP1 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1328", "10002D3B", "INST3/DYNAMIC SYNTH/SEQ2/STEP2 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1329", "10002D3C", "INST3/DYNAMIC SYNTH/SEQ2/STEP3 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1330", "10002D3D", "INST3/DYNAMIC SYNTH/SEQ2/STEP4 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1331", "10002D3E", "INST3/DYNAMIC SYNTH/SEQ2/STEP5 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1332", "10002D3F", "INST3/DYNAMIC SYNTH/SEQ2/STEP6 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1333", "10002D40", "INST3/DYNAMIC SYNTH/SEQ2/STEP7 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1334", "10002D41", "INST3/DYNAMIC SYNTH/SEQ2/STEP8 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1335", "10002D42", "INST3/DYNAMIC SYNTH/SEQ2/STEP9 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1336", "10002D43", "INST3/DYNAMIC SYNTH/SEQ2/STEP10 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1337", "10002D44", "INST3/DYNAMIC SYNTH/SEQ2/STEP11 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1338", "10002D45", "INST3/DYNAMIC SYNTH/SEQ2/STEP12 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1339", "10002D46", "INST3/DYNAMIC SYNTH/SEQ2/STEP13 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1340", "10002D47", "INST3/DYNAMIC SYNTH/SEQ2/STEP14 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1341", "10002D48", "INST3/DYNAMIC SYNTH/SEQ2/STEP15 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1342", "10002D49", "INST3/DYNAMIC SYNTH/SEQ2/STEP16 CURVE", {}, SINGLE, 1, 0, 12, 0, 0);
-        addParameter("1343", "10002D4A", "INST3/DYNAMIC SYNTH/LAYER/L. FADE", {}, SINGLE, 1, 1, 60, 1, 0);
-        addParameter("1344", "10002D4B", "INST3/DYNAMIC SYNTH/LAYER/LOWER", choices_LOWER_UPPER, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1345", "10002D4C", "INST3/DYNAMIC SYNTH/LAYER/UPPER", choices_LOWER_UPPER, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1346", "10002D4D", "INST3/DYNAMIC SYNTH/LAYER/U. FADE", {}, SINGLE, 1, 1, 60, 1, 0);
-        addParameter("1347", "10002E00", "INST3/OSC SYNTH/OSC/MODE", choices_OSC_SYNTH_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1348", "10002E01", "INST3/OSC SYNTH/OSC/WAVEFORM1", choices_OSC_SYNTH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1349", "10002E02", "INST3/OSC SYNTH/OSC/PITCH1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1350", "10002E03", "INST3/OSC SYNTH/OSC/FINE1", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1351", "10002E04", "INST3/OSC SYNTH/OSC/PWM1/PULSE WIDTH1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1352", "10002E05", "INST3/OSC SYNTH/OSC/PWM1/PW MOD RATE1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1353", "10002E06", "INST3/OSC SYNTH/OSC/P. ENV ATTACK1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1354", "10002E07", "INST3/OSC SYNTH/OSC/P. ENV DECAY1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1355", "10002E08", "INST3/OSC SYNTH/OSC/P. ENV DEPTH1", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("1356", "10002E09", "INST3/OSC SYNTH/OSC/LEVEL1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1357", "10002E0A", "INST3/OSC SYNTH/OSC/WAVEFORM2", choices_OSC_SYNTH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1358", "10002E0B", "INST3/OSC SYNTH/OSC/PITCH2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1359", "10002E0C", "INST3/OSC SYNTH/OSC/FINE2", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1360", "10002E0D", "INST3/OSC SYNTH/OSC/PWM2/PULSE WIDTH2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1361", "10002E0E", "INST3/OSC SYNTH/OSC/PWM2/PW MOD RATE2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1362", "10002E0F", "INST3/OSC SYNTH/OSC/P. ENV ATTACK2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1363", "10002E10", "INST3/OSC SYNTH/OSC/P. ENV DECAY2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1364", "10002E11", "INST3/OSC SYNTH/OSC/P. ENV DEPTH2", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("1365", "10002E12", "INST3/OSC SYNTH/OSC/LEVEL2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1366", "10002E13", "INST3/OSC SYNTH/OSC/MONO_POLY SW", choices_MONO_POLY_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1367", "10002E14", "INST3/OSC SYNTH/OSC/CHROMATIC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1368", "10002E15", "INST3/OSC SYNTH/OSC/PORTA SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1369", "10002E16", "INST3/OSC SYNTH/OSC/PORTA TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1370", "10002E17", "INST3/OSC SYNTH/OSC/PORTA MODE", choices_PORTA_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1371", "10002E18", "INST3/OSC SYNTH/OSC/HOLD MODE", choices_HOLD_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1372", "10002E19", "INST3/OSC SYNTH/OSC/LOW VELO CUT", {}, SINGLE, 1, 0, 10, 0, 0);
-        addParameter("1373", "10002E1A", "INST3/OSC SYNTH/FILTER/FILTER ON/OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1374", "10002E1B", "INST3/OSC SYNTH/FILTER/TYPE", choices_FILTER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1375", "10002E1C", "INST3/OSC SYNTH/FILTER/SLOPE", choices_FILTER_SLOPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1376", "10002E1D", "INST3/OSC SYNTH/FILTER/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1377", "10002E1E", "INST3/OSC SYNTH/FILTER/CUTOFF FOLLOW", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1378", "10002E1F", "INST3/OSC SYNTH/FILTER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1379", "10002E20", "INST3/OSC SYNTH/FILTER/VELOCITY SENS", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1380", "10002E21", "INST3/OSC SYNTH/FILTER/F. ENV ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1381", "10002E22", "INST3/OSC SYNTH/FILTER/F. ENV DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1382", "10002E23", "INST3/OSC SYNTH/FILTER/F. ENV SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1383", "10002E24", "INST3/OSC SYNTH/FILTER/F. ENV RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1384", "10002E25", "INST3/OSC SYNTH/FILTER/F. ENV DEPTH", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1385", "10002E26", "INST3/OSC SYNTH/AMP/VELOCITY SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1386", "10002E27", "INST3/OSC SYNTH/AMP/A. ENV ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1387", "10002E28", "INST3/OSC SYNTH/AMP/A. ENV DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1388", "10002E29", "INST3/OSC SYNTH/AMP/A. ENV SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1389", "10002E2A", "INST3/OSC SYNTH/AMP/A. ENV RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1390", "10002E2B", "INST3/OSC SYNTH/AMP/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1391", "10002E2C", "INST3/OSC SYNTH/AMP/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1392", "10002E2D", "INST3/OSC SYNTH/LFO1/LFO1 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1393", "10002E2E", "INST3/OSC SYNTH/LFO1/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1394", "10002E2F", "INST3/OSC SYNTH/LFO1/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1395", "10002E2F", "INST3/OSC SYNTH/LFO1/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1396", "10002E30", "INST3/OSC SYNTH/LFO1/PITCH1 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1397", "10002E31", "INST3/OSC SYNTH/LFO1/PITCH2 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1398", "10002E32", "INST3/OSC SYNTH/LFO1/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1399", "10002E33", "INST3/OSC SYNTH/LFO1/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1400", "10002E34", "INST3/OSC SYNTH/LFO1/DELAY TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1401", "10002E35", "INST3/OSC SYNTH/LFO1/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1402", "10002E36", "INST3/OSC SYNTH/LFO1/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1403", "10002E37", "INST3/OSC SYNTH/LFO2/LFO2 ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1404", "10002E38", "INST3/OSC SYNTH/LFO2/SHAPE", choices_LFO_SHAPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1405", "10002E39", "INST3/OSC SYNTH/LFO2/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("1406", "10002E39", "INST3/OSC SYNTH/LFO2/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("1407", "10002E3A", "INST3/OSC SYNTH/LFO2/PITCH1 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1408", "10002E3B", "INST3/OSC SYNTH/LFO2/PITCH2 DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1409", "10002E3C", "INST3/OSC SYNTH/LFO2/FILTER DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1410", "10002E3D", "INST3/OSC SYNTH/LFO2/AMP DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1411", "10002E3E", "INST3/OSC SYNTH/LFO2/DELAY TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1412", "10002E3F", "INST3/OSC SYNTH/LFO2/FADE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1413", "10002E40", "INST3/OSC SYNTH/LFO2/SYNC", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1414", "10002F00", "INST3/GR-300/MODE", choices_GR_300_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1415", "10002F01", "INST3/GR-300/VXX/COMP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1416", "10002F02", "INST3/GR-300/CUTOFF", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1417", "10002F03", "INST3/GR-300/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1418", "10002F04", "INST3/GR-300/ENV MOD SW", choices_ENV_MOD_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1419", "10002F05", "INST3/GR-300/ENV MOD SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1420", "10002F06", "INST3/GR-300/ENV MOD ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1421", "10002F07", "INST3/GR-300/VXX/PITCH SW", choices_PITCH_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1422", "10002F08", "INST3/GR-300/VXX/PITCH A", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("1423", "10002F09", "INST3/GR-300/VXX/FINE A", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1424", "10002F0A", "INST3/GR-300/VXX/PITCH B", choices_M12_P12, SINGLE, 1, 4, 28, 16, 0);
-        addParameter("1425", "10002F0B", "INST3/GR-300/VXX/FINE B", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1426", "10002F0C", "INST3/GR-300/VXX/DUET SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1427", "10002F0D", "INST3/GR-300/VXX/SWEEP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1428", "10002F0E", "INST3/GR-300/VXX/SWEEP RISE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1429", "10002F0F", "INST3/GR-300/VXX/SWEEP FALL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1430", "10002F10", "INST3/GR-300/VXX/VIBRATO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1431", "10002F11", "INST3/GR-300/VXX/VIBRATO RATE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1432", "10002F12", "INST3/GR-300/VXX/VIBRATO DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1433", "10002F13", "INST3/GR-300/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1434", "10002F14", "INST3/GR-300/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1435", "10003000", "INST3/E.GUITAR/GUITAR/TYPE", choices_GUITAR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1436", "10003001", "INST3/E.GUITAR/GUITAR/PU SELECT", choices_GUITAR_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1437", "10003002", "INST3/E.GUITAR/GUITAR/FRETLESS/TONE TYPE", choices_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1438", "10003003", "INST3/E.GUITAR/GUITAR/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1439", "10003004", "INST3/E.GUITAR/GUITAR/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1440", "10003005", "INST3/E.GUITAR/GUITAR/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1441", "10003006", "INST3/E.GUITAR/GUITAR/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1442", "10003007", "INST3/E.GUITAR/GUITAR/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1443", "10003008", "INST3/E.GUITAR/GUITAR/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1444", "10003009", "INST3/E.GUITAR/GUITAR/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1445", "1000300A", "INST3/E.GUITAR/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1446", "1000300B", "INST3/E.GUITAR/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1447", "1000300C", "INST3/E.GUITAR/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("1448", "1000300D", "INST3/E.GUITAR/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1449", "1000300E", "INST3/E.GUITAR/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1450", "1000300F", "INST3/E.GUITAR/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1451", "10003010", "INST3/E.GUITAR/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1452", "10003011", "INST3/E.GUITAR/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1453", "10003012", "INST3/E.GUITAR/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1454", "10003013", "INST3/E.GUITAR/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1455", "10003014", "INST3/E.GUITAR/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1456", "10003015", "INST3/E.GUITAR/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1457", "10003016", "INST3/E.GUITAR/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1458", "10003017", "INST3/E.GUITAR/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1459", "10003018", "INST3/E.GUITAR/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1460", "10003019", "INST3/E.GUITAR/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1461", "1000301A", "INST3/E.GUITAR/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1462", "1000301B", "INST3/E.GUITAR/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1463", "1000301C", "INST3/E.GUITAR/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1464", "1000301D", "INST3/E.GUITAR/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1465", "1000301E", "INST3/E.GUITAR/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1466", "1000301F", "INST3/E.GUITAR/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1467", "10003020", "INST3/E.GUITAR/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1468", "10003021", "INST3/E.GUITAR/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1469", "10003022", "INST3/E.GUITAR/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1470", "10003023", "INST3/E.GUITAR/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1471", "10003024", "INST3/E.GUITAR/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1472", "10003025", "INST3/E.GUITAR/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1473", "10003026", "INST3/E.GUITAR/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1474", "10003027", "INST3/E.GUITAR/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1475", "10003028", "INST3/E.GUITAR/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1476", "10003029", "INST3/E.GUITAR/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1477", "1000302A", "INST3/E.GUITAR/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1478", "1000302B", "INST3/E.GUITAR/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1479", "1000302C", "INST3/E.GUITAR/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1480", "10003100", "INST3/ACOUSTIC/ACOUSTIC/TYPE", choices_ACOUSTIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1481", "10003101", "INST3/ACOUSTIC/ACOUSTIC/BODY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1482", "10003102", "INST3/ACOUSTIC/ACOUSTIC/NYLON BENJO SITAR/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1483", "10003103", "INST3/ACOUSTIC/ACOUSTIC/SITAR/PU SELECT", choices_ACOUSTIC_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1484", "10003104", "INST3/ACOUSTIC/ACOUSTIC/SITAR/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1485", "10003105", "INST3/ACOUSTIC/ACOUSTIC/SITAR/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1486", "10003106", "INST3/ACOUSTIC/ACOUSTIC/SITAR/DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1487", "10003107", "INST3/ACOUSTIC/ACOUSTIC/SITAR/BUZZ", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1488", "10003108", "INST3/ACOUSTIC/ACOUSTIC/RESO BANJO/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1489", "10003109", "INST3/ACOUSTIC/ACOUSTIC/RESO/SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1490", "1000310A", "INST3/ACOUSTIC/ACOUSTIC/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1491", "1000310B", "INST3/ACOUSTIC/ACOUSTIC/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1492", "1000310C", "INST3/ACOUSTIC/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1493", "1000310D", "INST3/ACOUSTIC/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1494", "1000310E", "INST3/ACOUSTIC/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("1495", "1000310F", "INST3/ACOUSTIC/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1496", "10003110", "INST3/ACOUSTIC/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1497", "10003111", "INST3/ACOUSTIC/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1498", "10003112", "INST3/ACOUSTIC/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1499", "10003113", "INST3/ACOUSTIC/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1500", "10003114", "INST3/ACOUSTIC/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1501", "10003115", "INST3/ACOUSTIC/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1502", "10003116", "INST3/ACOUSTIC/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1503", "10003117", "INST3/ACOUSTIC/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1504", "10003118", "INST3/ACOUSTIC/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1505", "10003119", "INST3/ACOUSTIC/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1506", "1000311A", "INST3/ACOUSTIC/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1507", "1000311B", "INST3/ACOUSTIC/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1508", "1000311C", "INST3/ACOUSTIC/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1509", "1000311D", "INST3/ACOUSTIC/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1510", "1000311E", "INST3/ACOUSTIC/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1511", "1000311F", "INST3/ACOUSTIC/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1512", "10003120", "INST3/ACOUSTIC/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1513", "10003121", "INST3/ACOUSTIC/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1514", "10003122", "INST3/ACOUSTIC/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1515", "10003123", "INST3/ACOUSTIC/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1516", "10003124", "INST3/ACOUSTIC/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1517", "10003125", "INST3/ACOUSTIC/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1518", "10003126", "INST3/ACOUSTIC/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1519", "10003127", "INST3/ACOUSTIC/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1520", "10003128", "INST3/ACOUSTIC/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1521", "10003129", "INST3/ACOUSTIC/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1522", "1000312A", "INST3/ACOUSTIC/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1523", "1000312B", "INST3/ACOUSTIC/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1524", "1000312C", "INST3/ACOUSTIC/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1525", "1000312D", "INST3/ACOUSTIC/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1526", "1000312E", "INST3/ACOUSTIC/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1527", "10003200", "INST3/E.BASS/BASS/TYPE", choices_E_BASS_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1528", "10003201", "INST3/E.BASS/BASS/JB/FRONT VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1529", "10003202", "INST3/E.BASS/BASS/JB/REAR VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1530", "10003203", "INST3/E.BASS/BASS/FRETLESS/TONE TYPE", choices_E_BASS_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1531", "10003204", "INST3/E.BASS/BASS/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1532", "10003205", "INST3/E.BASS/BASS/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1533", "10003206", "INST3/E.BASS/BASS/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1534", "10003207", "INST3/E.BASS/BASS/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1535", "10003208", "INST3/E.BASS/BASS/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1536", "10003209", "INST3/E.BASS/BASS/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1537", "1000320A", "INST3/E.BASS/BASS/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1538", "1000320B", "INST3/E.BASS/AMP/AMP ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1539", "1000320C", "INST3/E.BASS/AMP/TYPE", choices_AMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1540", "1000320D", "INST3/E.BASS/AMP/GAIN", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("1541", "1000320E", "INST3/E.BASS/AMP/SAG", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1542", "1000320F", "INST3/E.BASS/AMP/RESONANCE", choices_M10_P10, SINGLE, 1, 6, 26, 16, 0);
-        addParameter("1543", "10003210", "INST3/E.BASS/AMP/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1544", "10003211", "INST3/E.BASS/AMP/BASS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1545", "10003212", "INST3/E.BASS/AMP/MIDDLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1546", "10003213", "INST3/E.BASS/AMP/TREBLE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1547", "10003214", "INST3/E.BASS/AMP/PRESENCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1548", "10003215", "INST3/E.BASS/AMP/BRIGHT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1549", "10003216", "INST3/E.BASS/AMP/GAIN SW", choices_GAIN_SW, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1550", "10003217", "INST3/E.BASS/AMP/SOLO SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1551", "10003218", "INST3/E.BASS/AMP/SOLO LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1552", "10003219", "INST3/E.BASS/AMP/SP TYPE", choices_SP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1553", "1000321A", "INST3/E.BASS/AMP/MIC TYPE", choices_MIC_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1554", "1000321B", "INST3/E.BASS/AMP/MIC DISTANCE", choices_MIC_DISTANCE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1555", "1000321C", "INST3/E.BASS/AMP/MIC POSITION", choices_MIC_POSITION, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1556", "1000321D", "INST3/E.BASS/AMP/MIC LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1557", "1000321E", "INST3/E.BASS/AMP/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1558", "1000321F", "INST3/E.BASS/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1559", "10003220", "INST3/E.BASS/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1560", "10003221", "INST3/E.BASS/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1561", "10003222", "INST3/E.BASS/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1562", "10003223", "INST3/E.BASS/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1563", "10003224", "INST3/E.BASS/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1564", "10003225", "INST3/E.BASS/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1565", "10003226", "INST3/E.BASS/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1566", "10003227", "INST3/E.BASS/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1567", "10003228", "INST3/E.BASS/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1568", "10003229", "INST3/E.BASS/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1569", "1000322A", "INST3/E.BASS/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1570", "1000322B", "INST3/E.BASS/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1571", "1000322C", "INST3/E.BASS/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1572", "1000322D", "INST3/E.BASS/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1573", "10003300", "INST3/VIO GUITAR/GUITAR/TYPE", choices_GUITAR_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1574", "10003301", "INST3/VIO GUITAR/GUITAR/PU SELECT", choices_GUITAR_PU_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1575", "10003302", "INST3/VIO GUITAR/GUITAR/FRETLESS/TONE TYPE", choices_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1576", "10003303", "INST3/VIO GUITAR/GUITAR/FRETLESS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1577", "10003304", "INST3/VIO GUITAR/GUITAR/FRETLESS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1578", "10003305", "INST3/VIO GUITAR/GUITAR/FRETLESS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1579", "10003306", "INST3/VIO GUITAR/GUITAR/FRETLESS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1580", "10003307", "INST3/VIO GUITAR/GUITAR/FRETLESS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1581", "10003308", "INST3/VIO GUITAR/GUITAR/VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1582", "10003309", "INST3/VIO GUITAR/GUITAR/TONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1583", "1000330A", "INST3/VIO GUITAR/HARMO/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("1584", "1000330B", "INST3/VIO GUITAR/HARMO/GAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1585", "1000330C", "INST3/VIO GUITAR/HARMO/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1586", "1000330D", "INST3/VIO GUITAR/HARMO/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1587", "1000330E", "INST3/VIO GUITAR/FILTER/OVERTONE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1588", "1000330F", "INST3/VIO GUITAR/FILTER/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1589", "10003310", "INST3/VIO GUITAR/FILTER/POWER BEND", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1590", "10003311", "INST3/VIO GUITAR/FILTER/SLIDE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1591", "10003312", "INST3/VIO GUITAR/FILTER/OCTAVE", choices_OCTAVE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1592", "10003313", "INST3/VIO GUITAR/FILTER/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1593", "10003314", "INST3/VIO GUITAR/FILTER/TOUCH SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1594", "10003315", "INST3/VIO GUITAR/FILTER/LEAD EMPHASIS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1595", "10003316", "INST3/VIO GUITAR/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1596", "10003317", "INST3/VIO GUITAR/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1597", "10003318", "INST3/VIO GUITAR/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1598", "10003319", "INST3/VIO GUITAR/EQ/EQ ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1599", "1000331A", "INST3/VIO GUITAR/EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1600", "1000331B", "INST3/VIO GUITAR/EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1601", "1000331C", "INST3/VIO GUITAR/EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1602", "1000331D", "INST3/VIO GUITAR/EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1603", "1000331E", "INST3/VIO GUITAR/EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1604", "1000331F", "INST3/VIO GUITAR/EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1605", "10003320", "INST3/VIO GUITAR/EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1606", "10003321", "INST3/VIO GUITAR/EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1607", "10003322", "INST3/VIO GUITAR/EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1608", "10003323", "INST3/VIO GUITAR/EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1609", "10003324", "INST3/VIO GUITAR/EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("1610", "10003400", "INST3/POLY FX/POLY FX/TYPE", choices_POLY_FX_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1611", "10003401", "INST3/POLY FX/POLY FX/GUITAR VOLUME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1612", "10003402", "INST3/POLY FX/POLY FX/DISTORTION/GAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1613", "10003403", "INST3/POLY FX/POLY FX/DISTORTION/GAIN BALANCE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1614", "10003404", "INST3/POLY FX/POLY FX/COLOR", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1615", "10003405", "INST3/POLY FX/POLY FX/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("1616", "10003406", "INST3/POLY FX/POLY FX/TOUCH WAH/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1617", "10003407", "INST3/POLY FX/POLY FX/TOUCH WAH/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1618", "10003408", "INST3/POLY FX/POLY FX/TOUCH WAH/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1619", "10003409", "INST3/POLY FX/POLY FX/TOUCH WAH/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1620", "1000340A", "INST3/POLY FX/POLY FX/TOUCH WAH/DECAY", {}, SINGLE, 1, 0, 10, 0, 0);
-        addParameter("1621", "1000340B", "INST3/POLY FX/POLY FX/TOUCH WAH/PEAK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1622", "1000340C", "INST3/POLY FX/POLY FX/TOUCH WAH/TONE TYPE", choices_POLY_FX_TONE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1623", "1000340D", "INST3/POLY FX/POLY FX/TOUCH WAH/COMP SW", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1624", "1000340E", "INST3/POLY FX/POLY FX/TOUCH WAH/COMP SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1625", "1000340F", "INST3/POLY FX/POLY FX/TOUCH WAH/COMP ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1626", "10003410", "INST3/POLY FX/NS/NS ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("1627", "10003411", "INST3/POLY FX/NS/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("1628", "10003412", "INST3/POLY FX/NS/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
+        addBlock("INST1", "INST1/", 0, 543, "10001500");
+
+        // INST2 and INST3 have the structure of INST1 at their own base address, they start muted
+        addBlockInstance("INST2", "INST2/", "INST1", "10002000");
+        addBlockInstance("INST3", "INST3/", "INST1", "10002B00");
+        for (auto blockName : { "INST2", "INST3" })
+        {
+            for (auto leafName : { "COMMON/INST LEVEL", "COMMON/NOR MIX LEVEL", "COMMON/STRING LEVEL1", "COMMON/STRING LEVEL2",
+                                   "COMMON/STRING LEVEL3", "COMMON/STRING LEVEL4", "COMMON/STRING LEVEL5", "COMMON/STRING LEVEL6" })
+            {
+                setBlockDefaultValue(blockName, leafName, 0);
+            }
+        }
         addParameter("1629", "10001201", "NORMAL/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("1630", "10001202", "NORMAL/NORMAL LEVEL", {}, SINGLE, 2, 0, 200, 0, 0);
         addParameter("1631", "10001204", "NORMAL/CABLE SIM", choices_CABLE_SIM, SINGLE, 1, 0, 0, 0, 0);
@@ -2270,644 +1197,11 @@ public:
         addParameter("2127", "10006506", "EFFECTS/FX1/WAH/PEDAL MIN", {}, SINGLE, 4, 0, 1000, 0, 0);
         addParameter("2128", "1000650A", "EFFECTS/FX1/WAH/PEDAL MAX", {}, SINGLE, 4, 0, 1000, 0, 0);
         addParameter("2129", "1000650E", "EFFECTS/FX1/WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2130", "10006600", "EFFECTS/FX2/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2131", "10006601", "EFFECTS/FX2/FX TYPE", choices_FX_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2132", "10006700", "EFFECTS/FX2/AC RESONANCE/TYPE", choices_AC_RESONANCE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2133", "10006701", "EFFECTS/FX2/AC RESONANCE/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2134", "10006702", "EFFECTS/FX2/AC RESONANCE/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2135", "10006703", "EFFECTS/FX2/AC RESONANCE/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2136", "10006800", "EFFECTS/FX2/AUTO WAH/FILTER MODE", choices_AUTO_WAH_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2137", "10006801", "EFFECTS/FX2/AUTO WAH/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2138", "10006801", "EFFECTS/FX2/AUTO WAH/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2139", "10006802", "EFFECTS/FX2/AUTO WAH/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2140", "10006803", "EFFECTS/FX2/AUTO WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2141", "10006804", "EFFECTS/FX2/AUTO WAH/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2142", "10006805", "EFFECTS/FX2/AUTO WAH/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2143", "10006806", "EFFECTS/FX2/AUTO WAH/WAVEFORM", choices_AUTO_WAH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2144", "10006807", "EFFECTS/FX2/AUTO WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2145", "10006901", "EFFECTS/FX2/CHORUS/MODE", choices_FX_CHORUS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2146", "10006902", "EFFECTS/FX2/CHORUS/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2147", "10006902", "EFFECTS/FX2/CHORUS/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2148", "10006903", "EFFECTS/FX2/CHORUS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2149", "10006904", "EFFECTS/FX2/CHORUS/PRE-DELAY", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2150", "10006905", "EFFECTS/FX2/CHORUS/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2151", "10006906", "EFFECTS/FX2/CHORUS/WAVEFORM", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2152", "10006907", "EFFECTS/FX2/CHORUS/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2153", "10006908", "EFFECTS/FX2/CHORUS/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2154", "10006909", "EFFECTS/FX2/CHORUS/DUAL/RATE 1 BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2155", "10006909", "EFFECTS/FX2/CHORUS/DUAL/RATE 1", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2156", "1000690A", "EFFECTS/FX2/CHORUS/DUAL/DEPTH 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2157", "1000690B", "EFFECTS/FX2/CHORUS/DUAL/PRE-DELAY 1", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2158", "1000690C", "EFFECTS/FX2/CHORUS/DUAL/EFFECT LEVEL 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2159", "1000690D", "EFFECTS/FX2/CHORUS/DUAL/WAVEFORM 1", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2160", "1000690E", "EFFECTS/FX2/CHORUS/DUAL/LOW CUT 1", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2161", "1000690F", "EFFECTS/FX2/CHORUS/DUAL/HIGH CUT 1", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2162", "10006910", "EFFECTS/FX2/CHORUS/DUAL/RATE 2 BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2163", "10006910", "EFFECTS/FX2/CHORUS/DUAL/RATE 2", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2164", "10006911", "EFFECTS/FX2/CHORUS/DUAL/DEPTH 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2165", "10006912", "EFFECTS/FX2/CHORUS/DUAL/PRE-DELAY 2", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2166", "10006913", "EFFECTS/FX2/CHORUS/DUAL/EFFECT LEVEL 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2167", "10006914", "EFFECTS/FX2/CHORUS/DUAL/WAVEFORM 2", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2168", "10006915", "EFFECTS/FX2/CHORUS/DUAL/LOW CUT 2", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2169", "10006916", "EFFECTS/FX2/CHORUS/DUAL/HIGH CUT 2", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2170", "10006917", "EFFECTS/FX2/CHORUS/DUAL/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2171", "10006918", "EFFECTS/FX2/CHORUS/DUAL/OUTPUT MODE", choices_OUTPUT_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2172", "10006A00", "EFFECTS/FX2/CLASSIC-VIBE/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2173", "10006A00", "EFFECTS/FX2/CLASSIC-VIBE/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2174", "10006A01", "EFFECTS/FX2/CLASSIC-VIBE/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2175", "10006A02", "EFFECTS/FX2/CLASSIC-VIBE/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2176", "10006B01", "EFFECTS/FX2/COMPRESSOR/TYPE", choices_CMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2177", "10006B02", "EFFECTS/FX2/COMPRESSOR/SUSTAIN", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2178", "10006B03", "EFFECTS/FX2/COMPRESSOR/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2179", "10006B04", "EFFECTS/FX2/COMPRESSOR/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2180", "10006B05", "EFFECTS/FX2/COMPRESSOR/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2181", "10006B06", "EFFECTS/FX2/COMPRESSOR/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2182", "10006C00", "EFFECTS/FX2/DEFRETTER/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2183", "10006C01", "EFFECTS/FX2/DEFRETTER/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2184", "10006C02", "EFFECTS/FX2/DEFRETTER/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2185", "10006C03", "EFFECTS/FX2/DEFRETTER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2186", "10006C04", "EFFECTS/FX2/DEFRETTER/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2187", "10006C05", "EFFECTS/FX2/DEFRETTER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2188", "10006C06", "EFFECTS/FX2/DEFRETTER/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2189", "10006D00", "EFFECTS/FX2/DEFRETTER BASS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2190", "10006D01", "EFFECTS/FX2/DEFRETTER BASS/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2191", "10006D02", "EFFECTS/FX2/DEFRETTER BASS/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2192", "10006D03", "EFFECTS/FX2/DEFRETTER BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2193", "10006D04", "EFFECTS/FX2/DEFRETTER BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2194", "10006E01", "EFFECTS/FX2/DELAY/TYPE", choices_FX_DELAY_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2195", "10006E02", "EFFECTS/FX2/DELAY/TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2196", "10006E02", "EFFECTS/FX2/DELAY/TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2197", "10006E06", "EFFECTS/FX2/DELAY/FEEDBACK", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2198", "10006E07", "EFFECTS/FX2/DELAY/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2199", "10006E08", "EFFECTS/FX2/DELAY/EFFECT LEVEL", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("2200", "10006E09", "EFFECTS/FX2/DELAY/DIRECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2201", "10006E0A", "EFFECTS/FX2/DELAY/DUAL/D1 TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2202", "10006E0A", "EFFECTS/FX2/DELAY/DUAL/D1 TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2203", "10006E0E", "EFFECTS/FX2/DELAY/DUAL/D1 FEEDBACK", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2204", "10006E0F", "EFFECTS/FX2/DELAY/DUAL/D1 HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2205", "10006E10", "EFFECTS/FX2/DELAY/DUAL/D1 EFFECT LEVEL", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("2206", "10006E11", "EFFECTS/FX2/DELAY/DUAL/D2 TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2207", "10006E11", "EFFECTS/FX2/DELAY/DUAL/D2 TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2208", "10006E15", "EFFECTS/FX2/DELAY/DUAL/D2 FEEDBACK", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2209", "10006E16", "EFFECTS/FX2/DELAY/DUAL/D2 HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2210", "10006E17", "EFFECTS/FX2/DELAY/DUAL/D2 EFFECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2211", "10006E18", "EFFECTS/FX2/DELAY/MOD/MOD RATE", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2212", "10006E19", "EFFECTS/FX2/DELAY/MOD/MOD DEPTH", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2213", "10006E1A", "EFFECTS/FX2/DELAY/WARP TWIST/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2214", "10006E1B", "EFFECTS/FX2/DELAY/TWIST/MODE", choices_TWIST_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2215", "10006E1C", "EFFECTS/FX2/DELAY/TWIST/RISE TIME", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2216", "10006E1D", "EFFECTS/FX2/DELAY/TWIST/FALL TIME", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2217", "10006E1E", "EFFECTS/FX2/DELAY/TWIST/FADE TIME", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2218", "10006E1F", "EFFECTS/FX2/DELAY/PAN/TAP TIME", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2219", "10006E20", "EFFECTS/FX2/DELAY/CARRY OVER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2220", "10006F00", "EFFECTS/FX2/FLANGER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2221", "10006F00", "EFFECTS/FX2/FLANGER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2222", "10006F01", "EFFECTS/FX2/FLANGER/DEPTH", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2223", "10006F02", "EFFECTS/FX2/FLANGER/RESONANCE", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2224", "10006F03", "EFFECTS/FX2/FLANGER/MANUAL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2225", "10006F04", "EFFECTS/FX2/FLANGER/SEPARATION", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2226", "10006F05", "EFFECTS/FX2/FLANGER/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2227", "10006F06", "EFFECTS/FX2/FLANGER/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2228", "10006F07", "EFFECTS/FX2/FLANGER/EFFECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2229", "10006F08", "EFFECTS/FX2/FLANGER/DIRECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2230", "10007000", "EFFECTS/FX2/FLANGER BASS/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2231", "10007000", "EFFECTS/FX2/FLANGER BASS/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2232", "10007001", "EFFECTS/FX2/FLANGER BASS/DEPTH", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2233", "10007002", "EFFECTS/FX2/FLANGER BASS/RESONANCE", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2234", "10007003", "EFFECTS/FX2/FLANGER BASS/MANUAL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2235", "10007004", "EFFECTS/FX2/FLANGER BASS/SEPARATION", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2236", "10007005", "EFFECTS/FX2/FLANGER BASS/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2237", "10007006", "EFFECTS/FX2/FLANGER BASS/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2238", "10007007", "EFFECTS/FX2/FLANGER BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2239", "10007008", "EFFECTS/FX2/FLANGER BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 2018, 0, 0);
-        addParameter("2240", "10007100", "EFFECTS/FX2/FOOT VOLUME/VOLUME MIN", {}, SINGLE, 4, 0, 2018, 0, 0);
-        addParameter("2241", "10007104", "EFFECTS/FX2/FOOT VOLUME/VOLUME MAX", {}, SINGLE, 4, 0, 2018, 0, 0);
-        addParameter("2242", "10007108", "EFFECTS/FX2/FOOT VOLUME/PEDAL POSITION", {}, SINGLE, 4, 0, 2018, 0, 0);
-        addParameter("2243", "1000710C", "EFFECTS/FX2/FOOT VOLUME/VOLUME CURVE", choices_VOLUME_CURVE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2244", "10007200", "EFFECTS/FX2/GRAPHIC EQ/100Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2245", "10007201", "EFFECTS/FX2/GRAPHIC EQ/200Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2246", "10007202", "EFFECTS/FX2/GRAPHIC EQ/400Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2247", "10007203", "EFFECTS/FX2/GRAPHIC EQ/800Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2248", "10007204", "EFFECTS/FX2/GRAPHIC EQ/1.6kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2249", "10007205", "EFFECTS/FX2/GRAPHIC EQ/3.2kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2250", "10007206", "EFFECTS/FX2/GRAPHIC EQ/6.4kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2251", "10007207", "EFFECTS/FX2/GRAPHIC EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2252", "10007300", "EFFECTS/FX2/HARMONIST/VOICE", choices_HARMONIST_VOICE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2253", "10007301", "EFFECTS/FX2/HARMONIST/HR1:HARMONY", choices_HARMONIST_HARMONY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2254", "10007302", "EFFECTS/FX2/HARMONIST/HR2:HARMONY", choices_HARMONIST_HARMONY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2255", "10007303", "EFFECTS/FX2/HARMONIST/HR1:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2256", "10007304", "EFFECTS/FX2/HARMONIST/HR1:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2257", "10007304", "EFFECTS/FX2/HARMONIST/HR1:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2258", "10007308", "EFFECTS/FX2/HARMONIST/HR1:FEEDBACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2259", "10007309", "EFFECTS/FX2/HARMONIST/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2260", "1000730A", "EFFECTS/FX2/HARMONIST/HR2:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2261", "1000730B", "EFFECTS/FX2/HARMONIST/HR2:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2262", "1000730B", "EFFECTS/FX2/HARMONIST/HR2:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2263", "1000730F", "EFFECTS/FX2/HARMONIST/USER1/HR1:0", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2264", "10007310", "EFFECTS/FX2/HARMONIST/USER1/HR1:1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2265", "10007311", "EFFECTS/FX2/HARMONIST/USER1/HR1:2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2266", "10007312", "EFFECTS/FX2/HARMONIST/USER1/HR1:3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2267", "10007313", "EFFECTS/FX2/HARMONIST/USER1/HR1:4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2268", "10007314", "EFFECTS/FX2/HARMONIST/USER1/HR1:5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2269", "10007315", "EFFECTS/FX2/HARMONIST/USER1/HR1:6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2270", "10007316", "EFFECTS/FX2/HARMONIST/USER1/HR1:7", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2271", "10007317", "EFFECTS/FX2/HARMONIST/USER1/HR1:8", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2272", "10007318", "EFFECTS/FX2/HARMONIST/USER1/HR1:9", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2273", "10007319", "EFFECTS/FX2/HARMONIST/USER1/HR1:10", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2274", "1000731A", "EFFECTS/FX2/HARMONIST/USER1/HR1:11", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2275", "1000731B", "EFFECTS/FX2/HARMONIST/USER2/HR2:0", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2276", "1000731C", "EFFECTS/FX2/HARMONIST/USER2/HR2:1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2277", "1000731D", "EFFECTS/FX2/HARMONIST/USER2/HR2:2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2278", "1000731E", "EFFECTS/FX2/HARMONIST/USER2/HR2:3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2279", "1000731F", "EFFECTS/FX2/HARMONIST/USER2/HR2:4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2280", "10007320", "EFFECTS/FX2/HARMONIST/USER2/HR2:5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2281", "10007321", "EFFECTS/FX2/HARMONIST/USER2/HR2:6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2282", "10007322", "EFFECTS/FX2/HARMONIST/USER2/HR2:7", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2283", "10007323", "EFFECTS/FX2/HARMONIST/USER2/HR2:8", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2284", "10007324", "EFFECTS/FX2/HARMONIST/USER2/HR2:9", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2285", "10007325", "EFFECTS/FX2/HARMONIST/USER2/HR2:10", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2286", "10007326", "EFFECTS/FX2/HARMONIST/USER2/HR2:11", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2287", "10007400", "EFFECTS/FX2/HUMANIZER/MODE", choices_HUMANIZER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2288", "10007401", "EFFECTS/FX2/HUMANIZER/VOWEL1", choices_HUMANIZER_VOWEL, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2289", "10007402", "EFFECTS/FX2/HUMANIZER/VOWEL2", choices_HUMANIZER_VOWEL, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2290", "10007403", "EFFECTS/FX2/HUMANIZER/PICKING/SENS", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2291", "10007404", "EFFECTS/FX2/HUMANIZER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2292", "10007404", "EFFECTS/FX2/HUMANIZER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2293", "10007405", "EFFECTS/FX2/HUMANIZER/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2294", "10007406", "EFFECTS/FX2/HUMANIZER/AUTO/MANUAL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2295", "10007407", "EFFECTS/FX2/HUMANIZER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2296", "10007500", "EFFECTS/FX2/ISOLATOR/BAND", choices_ISOLATOR_BAND, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2297", "10007501", "EFFECTS/FX2/ISOLATOR/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2298", "10007501", "EFFECTS/FX2/ISOLATOR/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2299", "10007502", "EFFECTS/FX2/ISOLATOR/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2300", "10007503", "EFFECTS/FX2/ISOLATOR/BAND LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2301", "10007600", "EFFECTS/FX2/LIMITER/TYPE", choices_LIMITER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2302", "10007601", "EFFECTS/FX2/LIMITER/THRESHOLD", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2303", "10007602", "EFFECTS/FX2/LIMITER/RATIO", choices_LIMITER_RATIO, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2304", "10007603", "EFFECTS/FX2/LIMITER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2305", "10007604", "EFFECTS/FX2/LIMITER/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2306", "10007605", "EFFECTS/FX2/LIMITER/RELEASE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2307", "10007700", "EFFECTS/FX2/LO-FI/BIT DEPTH", choices_LO_FI_BIT_DEPTH, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2308", "10007701", "EFFECTS/FX2/LO-FI/SAMPLE RATE", choices_LO_FI_SAMPLE_RATE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2309", "10007702", "EFFECTS/FX2/LO-FI/BALANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2310", "10007800", "EFFECTS/FX2/OCTAVE/-2OCT", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2311", "10007801", "EFFECTS/FX2/OCTAVE/-1OCT", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2312", "10007802", "EFFECTS/FX2/OCTAVE/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2313", "10007900", "EFFECTS/FX2/OCTAVE BASS/-2OCT", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2314", "10007901", "EFFECTS/FX2/OCTAVE BASS/-1OCT", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2315", "10007902", "EFFECTS/FX2/OCTAVE BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2316", "10007A00", "EFFECTS/FX2/PAN/TYPE", choices_PAN_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2317", "10007A01", "EFFECTS/FX2/PAN/WAVE SHAPE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2318", "10007A02", "EFFECTS/FX2/PAN/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2319", "10007A02", "EFFECTS/FX2/PAN/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2320", "10007A03", "EFFECTS/FX2/PAN/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2321", "10007A04", "EFFECTS/FX2/PAN/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2322", "10007A05", "EFFECTS/FX2/PAN/POSITION", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2323", "10007B01", "EFFECTS/FX2/PARAMETRIC EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2324", "10007B02", "EFFECTS/FX2/PARAMETRIC EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2325", "10007B03", "EFFECTS/FX2/PARAMETRIC EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2326", "10007B04", "EFFECTS/FX2/PARAMETRIC EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2327", "10007B05", "EFFECTS/FX2/PARAMETRIC EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2328", "10007B06", "EFFECTS/FX2/PARAMETRIC EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2329", "10007B07", "EFFECTS/FX2/PARAMETRIC EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2330", "10007B08", "EFFECTS/FX2/PARAMETRIC EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2331", "10007B09", "EFFECTS/FX2/PARAMETRIC EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2332", "10007B0A", "EFFECTS/FX2/PARAMETRIC EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2333", "10007B0B", "EFFECTS/FX2/PARAMETRIC EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2334", "10007C00", "EFFECTS/FX2/PEDAL BEND/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2335", "10007C01", "EFFECTS/FX2/PEDAL BEND/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2336", "10007C02", "EFFECTS/FX2/PEDAL BEND/PEDAL POSITION", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2337", "10007C06", "EFFECTS/FX2/PEDAL BEND/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2338", "10007D00", "EFFECTS/FX2/PHASER/TYPE", choices_PHASER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2339", "10007D01", "EFFECTS/FX2/PHASER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2340", "10007D01", "EFFECTS/FX2/PHASER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2341", "10007D02", "EFFECTS/FX2/PHASER/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2342", "10007D03", "EFFECTS/FX2/PHASER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2343", "10007D04", "EFFECTS/FX2/PHASER/MANUAL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2344", "10007D05", "EFFECTS/FX2/PHASER/STEP RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2345", "10007D05", "EFFECTS/FX2/PHASER/STEP RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2346", "10007D06", "EFFECTS/FX2/PHASER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2347", "10007D07", "EFFECTS/FX2/PHASER/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2348", "10007E00", "EFFECTS/FX2/PITCH SHIFTER/VOICE", choices_PS_VOICE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2349", "10007E01", "EFFECTS/FX2/PITCH SHIFTER/PS1:PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2350", "10007E02", "EFFECTS/FX2/PITCH SHIFTER/PS2:PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2351", "10007E03", "EFFECTS/FX2/PITCH SHIFTER/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2352", "10007E04", "EFFECTS/FX2/PITCH SHIFTER/PS1:MODE", choices_PS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2353", "10007E05", "EFFECTS/FX2/PITCH SHIFTER/PS1:FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2354", "10007E06", "EFFECTS/FX2/PITCH SHIFTER/PS1:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2355", "10007E06", "EFFECTS/FX2/PITCH SHIFTER/PS1:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2356", "10007E0A", "EFFECTS/FX2/PITCH SHIFTER/PS1:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2357", "10007E0B", "EFFECTS/FX2/PITCH SHIFTER/PS1:FEEDBACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2358", "10007E0C", "EFFECTS/FX2/PITCH SHIFTER/2VOICES/PS2:MODE", choices_PS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2359", "10007E0D", "EFFECTS/FX2/PITCH SHIFTER/2VOICES/PS2:FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2360", "10007E0E", "EFFECTS/FX2/PITCH SHIFTER/2VOICES/PS2:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2361", "10007E0E", "EFFECTS/FX2/PITCH SHIFTER/2VOICES/PS2:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2362", "10007E12", "EFFECTS/FX2/PITCH SHIFTER/2VOICES/PS2:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2363", "10007F01", "EFFECTS/FX2/REVERB/TYPE", choices_REVERB_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2364", "10007F02", "EFFECTS/FX2/REVERB/TIME", choices_REVERB_TIME, SINGLE, 1, 1, 100, 1, 0);
-        addParameter("2365", "10007F03", "EFFECTS/FX2/REVERB/CARRY OVER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2366", "10007F04", "EFFECTS/FX2/REVERB/PRE-DELAY", {}, SINGLE, 4, 0, 500, 0, 0);
-        addParameter("2367", "10007F08", "EFFECTS/FX2/REVERB/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2368", "10007F09", "EFFECTS/FX2/REVERB/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2369", "10007F0A", "EFFECTS/FX2/REVERB/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2370", "10007F0B", "EFFECTS/FX2/REVERB/DENSITY", {}, SINGLE, 1, 1, 10, 1, 0);
-        addParameter("2371", "10007F0C", "EFFECTS/FX2/REVERB/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2372", "10007F0D", "EFFECTS/FX2/REVERB/SPRING/SPRING SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2373", "10010000", "EFFECTS/FX2/RING MOD/INTELLIGENT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2374", "10010001", "EFFECTS/FX2/RING MOD/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2375", "10010002", "EFFECTS/FX2/RING MOD/FREQ MOD RATE BPM", choices_TIME_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2376", "10010002", "EFFECTS/FX2/RING MOD/FREQ MOD RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2377", "10010003", "EFFECTS/FX2/RING MOD/FREQ MOD DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2378", "10010004", "EFFECTS/FX2/RING MOD/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2379", "10010005", "EFFECTS/FX2/RING MOD/DIRECT LEVE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2380", "10010100", "EFFECTS/FX2/ROTARY/SPEED SELECT", choices_SPEED_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2381", "10010101", "EFFECTS/FX2/ROTARY/RATE SLOW BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2382", "10010101", "EFFECTS/FX2/ROTARY/RATE SLOW", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2383", "10010102", "EFFECTS/FX2/ROTARY/RATE FAST BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2384", "10010102", "EFFECTS/FX2/ROTARY/RATE FAST", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2385", "10010103", "EFFECTS/FX2/ROTARY/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2386", "10010104", "EFFECTS/FX2/ROTARY/RISE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2387", "10010105", "EFFECTS/FX2/ROTARY/FALL TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2388", "10010106", "EFFECTS/FX2/ROTARY/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2389", "10010107", "EFFECTS/FX2/ROTARY/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2390", "10010200", "EFFECTS/FX2/SITAR SIM/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2391", "10010201", "EFFECTS/FX2/SITAR SIM/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2392", "10010202", "EFFECTS/FX2/SITAR SIM/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2393", "10010203", "EFFECTS/FX2/SITAR SIM/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2394", "10010204", "EFFECTS/FX2/SITAR SIM/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2395", "10010205", "EFFECTS/FX2/SITAR SIM/BUZZ", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2396", "10010206", "EFFECTS/FX2/SITAR SIM/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2397", "10010300", "EFFECTS/FX2/SLICER/PATTERN", choices_SLICER_PATTERN, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2398", "10010301", "EFFECTS/FX2/SLICER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2399", "10010301", "EFFECTS/FX2/SLICER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2400", "10010302", "EFFECTS/FX2/SLICER/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2401", "10010303", "EFFECTS/FX2/SLICER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2402", "10010304", "EFFECTS/FX2/SLICER/ATTACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2403", "10010305", "EFFECTS/FX2/SLICER/DUTY", {}, SINGLE, 1, 1, 99, 1, 0);
-        addParameter("2404", "10010306", "EFFECTS/FX2/SLICER/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2405", "10010400", "EFFECTS/FX2/SLOW GEAR/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2406", "10010401", "EFFECTS/FX2/SLOW GEAR/RISE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2407", "10010402", "EFFECTS/FX2/SLOW GEAR/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2408", "10010500", "EFFECTS/FX2/SLOW GEAR BASS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2409", "10010501", "EFFECTS/FX2/SLOW GEAR BASS/RISE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2410", "10010502", "EFFECTS/FX2/SLOW GEAR BASS/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2411", "10010600", "EFFECTS/FX2/SOUND HOLD/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2412", "10010601", "EFFECTS/FX2/SOUND HOLD/RISE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2413", "10010602", "EFFECTS/FX2/SOUND HOLD/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2414", "10010700", "EFFECTS/FX2/TOUCH WAH/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2415", "10010701", "EFFECTS/FX2/TOUCH WAH/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2416", "10010702", "EFFECTS/FX2/TOUCH WAH/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2417", "10010703", "EFFECTS/FX2/TOUCH WAH/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2418", "10010704", "EFFECTS/FX2/TOUCH WAH/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2419", "10010705", "EFFECTS/FX2/TOUCH WAH/DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2420", "10010706", "EFFECTS/FX2/TOUCH WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2421", "10010707", "EFFECTS/FX2/TOUCH WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2422", "10010800", "EFFECTS/FX2/TOUCH WAH BASS/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2423", "10010801", "EFFECTS/FX2/TOUCH WAH BASS/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2424", "10010802", "EFFECTS/FX2/TOUCH WAH BASS/SENS", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2425", "10010803", "EFFECTS/FX2/TOUCH WAH BASS/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2426", "10010804", "EFFECTS/FX2/TOUCH WAH BASS/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2427", "10010805", "EFFECTS/FX2/TOUCH WAH BASS/DECAY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2428", "10010806", "EFFECTS/FX2/TOUCH WAH BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2429", "10010807", "EFFECTS/FX2/TOUCH WAH BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2430", "10010900", "EFFECTS/FX2/TREMOLO/WAVE SHAPE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2431", "10010901", "EFFECTS/FX2/TREMOLO/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2432", "10010901", "EFFECTS/FX2/TREMOLO/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2433", "10010902", "EFFECTS/FX2/TREMOLO/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2434", "10010903", "EFFECTS/FX2/TREMOLO/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2435", "10010904", "EFFECTS/FX2/TREMOLO/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2436", "10010A00", "EFFECTS/FX2/VIBRATO/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2437", "10010A00", "EFFECTS/FX2/VIBRATO/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2438", "10010A01", "EFFECTS/FX2/VIBRATO/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2439", "10010A02", "EFFECTS/FX2/VIBRATO/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2440", "10010A03", "EFFECTS/FX2/VIBRATO/RISE TIME", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2441", "10010A04", "EFFECTS/FX2/VIBRATO/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2442", "10010A05", "EFFECTS/FX2/VIBRATO/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2443", "10010B00", "EFFECTS/FX2/WAH/TYPE", choices_WAH_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2444", "10010B01", "EFFECTS/FX2/WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2445", "10010B02", "EFFECTS/FX2/WAH/PEDAL POSITION", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2446", "10010B06", "EFFECTS/FX2/WAH/PEDAL MIN", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2447", "10010B0A", "EFFECTS/FX2/WAH/PEDAL MAX", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2448", "10010B0E", "EFFECTS/FX2/WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2449", "10010C00", "EFFECTS/FX3/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2450", "10010C01", "EFFECTS/FX3/FX TYPE", choices_FX_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2451", "10010D00", "EFFECTS/FX3/AC RESONANCE/TYPE", choices_AC_RESONANCE_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2452", "10010D01", "EFFECTS/FX3/AC RESONANCE/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2453", "10010D02", "EFFECTS/FX3/AC RESONANCE/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2454", "10010D03", "EFFECTS/FX3/AC RESONANCE/LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2455", "10010E00", "EFFECTS/FX3/AUTO WAH/FILTER MODE", choices_AUTO_WAH_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2456", "10010E01", "EFFECTS/FX3/AUTO WAH/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2457", "10010E01", "EFFECTS/FX3/AUTO WAH/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2458", "10010E02", "EFFECTS/FX3/AUTO WAH/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2459", "10010E03", "EFFECTS/FX3/AUTO WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2460", "10010E04", "EFFECTS/FX3/AUTO WAH/FREQUENCY", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2461", "10010E05", "EFFECTS/FX3/AUTO WAH/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2462", "10010E06", "EFFECTS/FX3/AUTO WAH/WAVEFORM", choices_AUTO_WAH_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2463", "10010E07", "EFFECTS/FX3/AUTO WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2464", "10010F01", "EFFECTS/FX3/CHORUS/MODE", choices_FX_CHORUS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2465", "10010F02", "EFFECTS/FX3/CHORUS/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2466", "10010F02", "EFFECTS/FX3/CHORUS/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2467", "10010F03", "EFFECTS/FX3/CHORUS/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2468", "10010F04", "EFFECTS/FX3/CHORUS/PRE-DELAY", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2469", "10010F05", "EFFECTS/FX3/CHORUS/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2470", "10010F06", "EFFECTS/FX3/CHORUS/WAVEFORM", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2471", "10010F07", "EFFECTS/FX3/CHORUS/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2472", "10010F08", "EFFECTS/FX3/CHORUS/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2473", "10010F09", "EFFECTS/FX3/CHORUS/DUAL/RATE 1 BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2474", "10010F09", "EFFECTS/FX3/CHORUS/DUAL/RATE 1", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2475", "10010F0A", "EFFECTS/FX3/CHORUS/DUAL/DEPTH 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2476", "10010F0B", "EFFECTS/FX3/CHORUS/DUAL/PRE-DELAY 1", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2477", "10010F0C", "EFFECTS/FX3/CHORUS/DUAL/EFFECT LEVEL 1", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2478", "10010F0D", "EFFECTS/FX3/CHORUS/DUAL/WAVEFORM 1", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2479", "10010F0E", "EFFECTS/FX3/CHORUS/DUAL/LOW CUT 1", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2480", "10010F0F", "EFFECTS/FX3/CHORUS/DUAL/HIGH CUT 1", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2481", "10010F10", "EFFECTS/FX3/CHORUS/DUAL/RATE 2 BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2482", "10010F10", "EFFECTS/FX3/CHORUS/DUAL/RATE 2", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2483", "10010F11", "EFFECTS/FX3/CHORUS/DUAL/DEPTH 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2484", "10010F12", "EFFECTS/FX3/CHORUS/DUAL/PRE-DELAY 2", choices_PRE_DELAY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2485", "10010F13", "EFFECTS/FX3/CHORUS/DUAL/EFFECT LEVEL 2", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2486", "10010F14", "EFFECTS/FX3/CHORUS/DUAL/WAVEFORM 2", choices_FX_CHORUS_WAVEFORM, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2487", "10010F15", "EFFECTS/FX3/CHORUS/DUAL/LOW CUT 2", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2488", "10010F16", "EFFECTS/FX3/CHORUS/DUAL/HIGH CUT 2", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2489", "10010F17", "EFFECTS/FX3/CHORUS/DUAL/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2490", "10010F18", "EFFECTS/FX3/CHORUS/DUAL/OUTPUT MODE", choices_OUTPUT_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2491", "10011000", "EFFECTS/FX3/CLASSIC-VIBE/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2492", "10011000", "EFFECTS/FX3/CLASSIC-VIBE/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2493", "10011001", "EFFECTS/FX3/CLASSIC-VIBE/DEPTH", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2494", "10011002", "EFFECTS/FX3/CLASSIC-VIBE/EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2495", "10011101", "EFFECTS/FX3/COMPRESSOR/TYPE", choices_CMP_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2496", "10011102", "EFFECTS/FX3/COMPRESSOR/SUSTAIN", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2497", "10011103", "EFFECTS/FX3/COMPRESSOR/ATTACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2498", "10011104", "EFFECTS/FX3/COMPRESSOR/EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2499", "10011105", "EFFECTS/FX3/COMPRESSOR/DIRECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2500", "10011106", "EFFECTS/FX3/COMPRESSOR/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2501", "10011200", "EFFECTS/FX3/DEFRETTER/SENS", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2502", "10011201", "EFFECTS/FX3/DEFRETTER/DEPTH", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2503", "10011202", "EFFECTS/FX3/DEFRETTER/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2504", "10011203", "EFFECTS/FX3/DEFRETTER/EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2505", "10011204", "EFFECTS/FX3/DEFRETTER/ATTACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2506", "10011205", "EFFECTS/FX3/DEFRETTER/RESONANCE", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2507", "10011206", "EFFECTS/FX3/DEFRETTER/DIRECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2508", "10011300", "EFFECTS/FX3/DEFRETTER BASS/SENS", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2509", "10011301", "EFFECTS/FX3/DEFRETTER BASS/ATTACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2510", "10011302", "EFFECTS/FX3/DEFRETTER BASS/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2511", "10011303", "EFFECTS/FX3/DEFRETTER BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2512", "10011304", "EFFECTS/FX3/DEFRETTER BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2513", "10011401", "EFFECTS/FX3/DELAY/TYPE", choices_FX_DELAY_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2514", "10011402", "EFFECTS/FX3/DELAY/TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2515", "10011402", "EFFECTS/FX3/DELAY/TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2516", "10011406", "EFFECTS/FX3/DELAY/FEEDBACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2517", "10011407", "EFFECTS/FX3/DELAY/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2518", "10011408", "EFFECTS/FX3/DELAY/EFFECT LEVEL", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("2519", "10011409", "EFFECTS/FX3/DELAY/DIRECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2520", "1001140A", "EFFECTS/FX3/DELAY/DUAL/D1 TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2521", "1001140A", "EFFECTS/FX3/DELAY/DUAL/D1 TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2522", "1001140E", "EFFECTS/FX3/DELAY/DUAL/D1 FEEDBACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2523", "1001140F", "EFFECTS/FX3/DELAY/DUAL/D1 HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2524", "10011410", "EFFECTS/FX3/DELAY/DUAL/D1 EFFECT LEVEL", {}, SINGLE, 1, 0, 120, 0, 0);
-        addParameter("2525", "10011411", "EFFECTS/FX3/DELAY/DUAL/D2 TIME BPM", choices_TIME_BPM, DUALBPM, 4, 1, 2018, 1, 2000);
-        addParameter("2526", "10011411", "EFFECTS/FX3/DELAY/DUAL/D2 TIME", {}, DUALTIME, 4, 1, 2018, 1, 2000);
-        addParameter("2527", "10011415", "EFFECTS/FX3/DELAY/DUAL/D2 FEEDBACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2528", "10011416", "EFFECTS/FX3/DELAY/DUAL/D2 HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2529", "10011417", "EFFECTS/FX3/DELAY/DUAL/D2 EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2530", "10011418", "EFFECTS/FX3/DELAY/MOD/MOD RATE", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2531", "10011419", "EFFECTS/FX3/DELAY/MOD/MOD DEPTH", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2532", "1001141A", "EFFECTS/FX3/DELAY/WARP TWIST/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2533", "1001141B", "EFFECTS/FX3/DELAY/TWIST/MODE", choices_TWIST_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2534", "1001141C", "EFFECTS/FX3/DELAY/TWIST/RISE TIME", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2535", "1001141D", "EFFECTS/FX3/DELAY/TWIST/FALL TIME", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2536", "1001141E", "EFFECTS/FX3/DELAY/TWIST/FADE TIME", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2537", "1001141F", "EFFECTS/FX3/DELAY/PAN/TAP TIME", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2538", "10011420", "EFFECTS/FX3/DELAY/CARRY OVER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2539", "10011500", "EFFECTS/FX3/FLANGER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2540", "10011500", "EFFECTS/FX3/FLANGER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2541", "10011501", "EFFECTS/FX3/FLANGER/DEPTH", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2542", "10011502", "EFFECTS/FX3/FLANGER/RESONANCE", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2543", "10011503", "EFFECTS/FX3/FLANGER/MANUAL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2544", "10011504", "EFFECTS/FX3/FLANGER/SEPARATION", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2545", "10011505", "EFFECTS/FX3/FLANGER/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2546", "10011506", "EFFECTS/FX3/FLANGER/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2547", "10011507", "EFFECTS/FX3/FLANGER/EFFECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2548", "10011508", "EFFECTS/FX3/FLANGER/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2549", "10011600", "EFFECTS/FX3/FLANGER BASS/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2550", "10011600", "EFFECTS/FX3/FLANGER BASS/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2551", "10011601", "EFFECTS/FX3/FLANGER BASS/DEPTH", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2552", "10011602", "EFFECTS/FX3/FLANGER BASS/RESONANCE", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2553", "10011603", "EFFECTS/FX3/FLANGER BASS/MANUAL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2554", "10011604", "EFFECTS/FX3/FLANGER BASS/SEPARATION", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2555", "10011605", "EFFECTS/FX3/FLANGER BASS/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2556", "10011606", "EFFECTS/FX3/FLANGER BASS/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2557", "10011607", "EFFECTS/FX3/FLANGER BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2558", "10011608", "EFFECTS/FX3/FLANGER BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2559", "10011700", "EFFECTS/FX3/FOOT VOLUME/VOLUME MIN", {}, SINGLE, 4, 0, 318, 0, 0);
-        addParameter("2560", "10011704", "EFFECTS/FX3/FOOT VOLUME/VOLUME MAX", {}, SINGLE, 4, 0, 318, 0, 0);
-        addParameter("2561", "10011708", "EFFECTS/FX3/FOOT VOLUME/PEDAL POSITION", {}, SINGLE, 4, 0, 318, 0, 0);
-        addParameter("2562", "1001170C", "EFFECTS/FX3/FOOT VOLUME/VOLUME CURVE", choices_VOLUME_CURVE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2563", "10011800", "EFFECTS/FX3/GRAPHIC EQ/100Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2564", "10011801", "EFFECTS/FX3/GRAPHIC EQ/200Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2565", "10011802", "EFFECTS/FX3/GRAPHIC EQ/400Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2566", "10011803", "EFFECTS/FX3/GRAPHIC EQ/800Hz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2567", "10011804", "EFFECTS/FX3/GRAPHIC EQ/1.6kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2568", "10011805", "EFFECTS/FX3/GRAPHIC EQ/3.2kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2569", "10011806", "EFFECTS/FX3/GRAPHIC EQ/6.4kHz", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2570", "10011807", "EFFECTS/FX3/GRAPHIC EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2571", "10011900", "EFFECTS/FX3/HARMONIST/VOICE", choices_HARMONIST_VOICE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2572", "10011901", "EFFECTS/FX3/HARMONIST/HR1:HARMONY", choices_HARMONIST_HARMONY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2573", "10011902", "EFFECTS/FX3/HARMONIST/HR2:HARMONY", choices_HARMONIST_HARMONY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2574", "10011903", "EFFECTS/FX3/HARMONIST/HR1:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2575", "10011904", "EFFECTS/FX3/HARMONIST/HR1:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2576", "10011904", "EFFECTS/FX3/HARMONIST/HR1:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2577", "10011908", "EFFECTS/FX3/HARMONIST/HR1:FEEDBACK", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2578", "10011909", "EFFECTS/FX3/HARMONIST/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2579", "1001190A", "EFFECTS/FX3/HARMONIST/HR2:LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
-        addParameter("2580", "1001190B", "EFFECTS/FX3/HARMONIST/HR2:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2581", "1001190B", "EFFECTS/FX3/HARMONIST/HR2:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2582", "1001190F", "EFFECTS/FX3/HARMONIST/USER1/HR1:0", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2583", "10011910", "EFFECTS/FX3/HARMONIST/USER1/HR1:1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2584", "10011911", "EFFECTS/FX3/HARMONIST/USER1/HR1:2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2585", "10011912", "EFFECTS/FX3/HARMONIST/USER1/HR1:3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2586", "10011913", "EFFECTS/FX3/HARMONIST/USER1/HR1:4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2587", "10011914", "EFFECTS/FX3/HARMONIST/USER1/HR1:5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2588", "10011915", "EFFECTS/FX3/HARMONIST/USER1/HR1:6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2589", "10011916", "EFFECTS/FX3/HARMONIST/USER1/HR1:7", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2590", "10011917", "EFFECTS/FX3/HARMONIST/USER1/HR1:8", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2591", "10011918", "EFFECTS/FX3/HARMONIST/USER1/HR1:9", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2592", "10011919", "EFFECTS/FX3/HARMONIST/USER1/HR1:10", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2593", "1001191A", "EFFECTS/FX3/HARMONIST/USER1/HR1:11", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2594", "1001191B", "EFFECTS/FX3/HARMONIST/USER2/HR2:0", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2595", "1001191C", "EFFECTS/FX3/HARMONIST/USER2/HR2:1", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2596", "1001191D", "EFFECTS/FX3/HARMONIST/USER2/HR2:2", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2597", "1001191E", "EFFECTS/FX3/HARMONIST/USER2/HR2:3", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2598", "1001191F", "EFFECTS/FX3/HARMONIST/USER2/HR2:4", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2599", "10011920", "EFFECTS/FX3/HARMONIST/USER2/HR2:5", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2600", "10011921", "EFFECTS/FX3/HARMONIST/USER2/HR2:6", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2601", "10011922", "EFFECTS/FX3/HARMONIST/USER2/HR2:7", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2602", "10011923", "EFFECTS/FX3/HARMONIST/USER2/HR2:8", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2603", "10011924", "EFFECTS/FX3/HARMONIST/USER2/HR2:9", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2604", "10011925", "EFFECTS/FX3/HARMONIST/USER2/HR2:10", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2605", "10011926", "EFFECTS/FX3/HARMONIST/USER2/HR2:11", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2606", "10011A00", "EFFECTS/FX3/HUMANIZER/MODE", choices_HUMANIZER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2607", "10011A01", "EFFECTS/FX3/HUMANIZER/VOWEL1", choices_HUMANIZER_VOWEL, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2608", "10011A02", "EFFECTS/FX3/HUMANIZER/VOWEL2", choices_HUMANIZER_VOWEL, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2609", "10011A03", "EFFECTS/FX3/HUMANIZER/PICKING/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2610", "10011A04", "EFFECTS/FX3/HUMANIZER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2611", "10011A04", "EFFECTS/FX3/HUMANIZER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2612", "10011A05", "EFFECTS/FX3/HUMANIZER/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2613", "10011A06", "EFFECTS/FX3/HUMANIZER/AUTO/MANUAL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2614", "10011A07", "EFFECTS/FX3/HUMANIZER/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2615", "10011B00", "EFFECTS/FX3/ISOLATOR/BAND", choices_ISOLATOR_BAND, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2616", "10011B01", "EFFECTS/FX3/ISOLATOR/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2617", "10011B01", "EFFECTS/FX3/ISOLATOR/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2618", "10011B02", "EFFECTS/FX3/ISOLATOR/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2619", "10011B03", "EFFECTS/FX3/ISOLATOR/BAND LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2620", "10011C00", "EFFECTS/FX3/LIMITER/TYPE", choices_LIMITER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2621", "10011C01", "EFFECTS/FX3/LIMITER/THRESHOLD", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2622", "10011C02", "EFFECTS/FX3/LIMITER/RATIO", choices_LIMITER_RATIO, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2623", "10011C03", "EFFECTS/FX3/LIMITER/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2624", "10011C04", "EFFECTS/FX3/LIMITER/ATTACK", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2625", "10011C05", "EFFECTS/FX3/LIMITER/RELEASE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2626", "10011D00", "EFFECTS/FX3/LO-FI/BIT DEPTH", choices_LO_FI_BIT_DEPTH, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2627", "10011D01", "EFFECTS/FX3/LO-FI/SAMPLE RATE", choices_LO_FI_SAMPLE_RATE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2628", "10011D02", "EFFECTS/FX3/LO-FI/BALANCE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2629", "10011E00", "EFFECTS/FX3/OCTAVE/-2OCT", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2630", "10011E01", "EFFECTS/FX3/OCTAVE/-1OCT", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2631", "10011E02", "EFFECTS/FX3/OCTAVE/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2632", "10011F00", "EFFECTS/FX3/OCTAVE BASS/-2OCT", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2633", "10011F01", "EFFECTS/FX3/OCTAVE BASS/-1OCT", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2634", "10011F02", "EFFECTS/FX3/OCTAVE BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2635", "10012000", "EFFECTS/FX3/PAN/TYPE", choices_PAN_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2636", "10012001", "EFFECTS/FX3/PAN/WAVE SHAPE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2637", "10012002", "EFFECTS/FX3/PAN/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2638", "10012002", "EFFECTS/FX3/PAN/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2639", "10012003", "EFFECTS/FX3/PAN/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2640", "10012004", "EFFECTS/FX3/PAN/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2641", "10012005", "EFFECTS/FX3/PAN/POSITION", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2642", "10012101", "EFFECTS/FX3/PARAMETRIC EQ/LOW GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2643", "10012102", "EFFECTS/FX3/PARAMETRIC EQ/HIGH GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2644", "10012103", "EFFECTS/FX3/PARAMETRIC EQ/LOW-MID FREQ", choices_LOW_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2645", "10012104", "EFFECTS/FX3/PARAMETRIC EQ/LOW-MID Q", choices_LOW_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2646", "10012105", "EFFECTS/FX3/PARAMETRIC EQ/LOW-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2647", "10012106", "EFFECTS/FX3/PARAMETRIC EQ/HIGH-MID FREQ", choices_HIGH_MID_FREQ, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2648", "10012107", "EFFECTS/FX3/PARAMETRIC EQ/HIGH-MID Q", choices_HIGH_MID_Q, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2649", "10012108", "EFFECTS/FX3/PARAMETRIC EQ/HIGH-MID GAIN", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2650", "10012109", "EFFECTS/FX3/PARAMETRIC EQ/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2651", "1001210A", "EFFECTS/FX3/PARAMETRIC EQ/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2652", "1001210B", "EFFECTS/FX3/PARAMETRIC EQ/LEVEL", choices_M20_P20, SINGLE, 1, 12, 52, 32, 0);
-        addParameter("2653", "10012200", "EFFECTS/FX3/PEDAL BEND/PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2654", "10012201", "EFFECTS/FX3/PEDAL BEND/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2655", "10012202", "EFFECTS/FX3/PEDAL BEND/PEDAL POSITION", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2656", "10012206", "EFFECTS/FX3/PEDAL BEND/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2657", "10012300", "EFFECTS/FX3/PHASER/TYPE", choices_PHASER_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2658", "10012301", "EFFECTS/FX3/PHASER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2659", "10012301", "EFFECTS/FX3/PHASER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2660", "10012302", "EFFECTS/FX3/PHASER/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2661", "10012303", "EFFECTS/FX3/PHASER/RESONANCE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2662", "10012304", "EFFECTS/FX3/PHASER/MANUAL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2663", "10012305", "EFFECTS/FX3/PHASER/STEP RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2664", "10012305", "EFFECTS/FX3/PHASER/STEP RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2665", "10012306", "EFFECTS/FX3/PHASER/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2666", "10012307", "EFFECTS/FX3/PHASER/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2667", "10012400", "EFFECTS/FX3/PITCH SHIFTER/VOICE", choices_PS_VOICE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2668", "10012401", "EFFECTS/FX3/PITCH SHIFTER/PS1:PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2669", "10012402", "EFFECTS/FX3/PITCH SHIFTER/PS2:PITCH", choices_M24_P24, SINGLE, 1, 8, 56, 32, 0);
-        addParameter("2670", "10012403", "EFFECTS/FX3/PITCH SHIFTER/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2671", "10012404", "EFFECTS/FX3/PITCH SHIFTER/PS1:MODE", choices_PS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2672", "10012405", "EFFECTS/FX3/PITCH SHIFTER/PS1:FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2673", "10012406", "EFFECTS/FX3/PITCH SHIFTER/PS1:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2674", "10012406", "EFFECTS/FX3/PITCH SHIFTER/PS1:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2675", "1001240A", "EFFECTS/FX3/PITCH SHIFTER/PS1:LEVEL", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2676", "1001240B", "EFFECTS/FX3/PITCH SHIFTER/PS1:FEEDBACK", {}, SINGLE, 1, 0, 318, 0, 0);
-        addParameter("2677", "1001240C", "EFFECTS/FX3/PITCH SHIFTER/2VOICES/PS2:MODE", choices_PS_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2678", "1001240D", "EFFECTS/FX3/PITCH SHIFTER/2VOICES/PS2:FINE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2679", "1001240E", "EFFECTS/FX3/PITCH SHIFTER/2VOICES/PS2:PRE-DELAY BPM", choices_TIME_BPM, DUALBPM, 4, 0, 318, 0, 300);
-        addParameter("2680", "1001240E", "EFFECTS/FX3/PITCH SHIFTER/2VOICES/PS2:PRE-DELAY", {}, DUALTIME, 4, 0, 318, 0, 300);
-        addParameter("2681", "10012412", "EFFECTS/FX3/PITCH SHIFTER/2VOICES/PS2:LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2682", "10012501", "EFFECTS/FX3/REVERB/TYPE", choices_REVERB_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2683", "10012502", "EFFECTS/FX3/REVERB/TIME", choices_REVERB_TIME, SINGLE, 1, 1, 100, 1, 0);
-        addParameter("2684", "10012503", "EFFECTS/FX3/REVERB/CARRY OVER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2685", "10012504", "EFFECTS/FX3/REVERB/PRE-DELAY", {}, SINGLE, 4, 0, 500, 0, 0);
-        addParameter("2686", "10012508", "EFFECTS/FX3/REVERB/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2687", "10012509", "EFFECTS/FX3/REVERB/LOW CUT", choices_LOW_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2688", "1001250A", "EFFECTS/FX3/REVERB/HIGH CUT", choices_HIGH_CUT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2689", "1001250B", "EFFECTS/FX3/REVERB/DENSITY", {}, SINGLE, 1, 1, 10, 1, 0);
-        addParameter("2690", "1001250C", "EFFECTS/FX3/REVERB/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2691", "1001250D", "EFFECTS/FX3/REVERB/SPRING/SPRING SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2692", "10012600", "EFFECTS/FX3/RING MOD/INTELLIGENT", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2693", "10012601", "EFFECTS/FX3/RING MOD/FREQUENCY", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2694", "10012602", "EFFECTS/FX3/RING MOD/FREQ MOD RATE BPM", choices_TIME_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2695", "10012602", "EFFECTS/FX3/RING MOD/FREQ MOD RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2696", "10012603", "EFFECTS/FX3/RING MOD/FREQ MOD DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2697", "10012604", "EFFECTS/FX3/RING MOD/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2698", "10012605", "EFFECTS/FX3/RING MOD/DIRECT LEVE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2699", "10012700", "EFFECTS/FX3/ROTARY/SPEED SELECT", choices_SPEED_SELECT, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2700", "10012701", "EFFECTS/FX3/ROTARY/RATE SLOW BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2701", "10012701", "EFFECTS/FX3/ROTARY/RATE SLOW", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2702", "10012702", "EFFECTS/FX3/ROTARY/RATE FAST BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2703", "10012702", "EFFECTS/FX3/ROTARY/RATE FAST", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2704", "10012703", "EFFECTS/FX3/ROTARY/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2705", "10012704", "EFFECTS/FX3/ROTARY/RISE TIME", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2706", "10012705", "EFFECTS/FX3/ROTARY/FALL TIME", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2707", "10012706", "EFFECTS/FX3/ROTARY/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2708", "10012707", "EFFECTS/FX3/ROTARY/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2709", "10012800", "EFFECTS/FX3/SITAR SIM/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2710", "10012801", "EFFECTS/FX3/SITAR SIM/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2711", "10012802", "EFFECTS/FX3/SITAR SIM/TONE", choices_M50_P50, SINGLE, 1, 14, 114, 64, 0);
-        addParameter("2712", "10012803", "EFFECTS/FX3/SITAR SIM/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2713", "10012804", "EFFECTS/FX3/SITAR SIM/RESONANCE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2714", "10012805", "EFFECTS/FX3/SITAR SIM/BUZZ", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2715", "10012806", "EFFECTS/FX3/SITAR SIM/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2716", "10012900", "EFFECTS/FX3/SLICER/PATTERN", choices_SLICER_PATTERN, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2717", "10012901", "EFFECTS/FX3/SLICER/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2718", "10012901", "EFFECTS/FX3/SLICER/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2719", "10012902", "EFFECTS/FX3/SLICER/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2720", "10012903", "EFFECTS/FX3/SLICER/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2721", "10012904", "EFFECTS/FX3/SLICER/ATTACK", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2722", "10012905", "EFFECTS/FX3/SLICER/DUTY", {}, SINGLE, 1, 1, 99, 1, 0);
-        addParameter("2723", "10012906", "EFFECTS/FX3/SLICER/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2724", "10012A00", "EFFECTS/FX3/SLOW GEAR/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2725", "10012A01", "EFFECTS/FX3/SLOW GEAR/RISE TIME", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2726", "10012A02", "EFFECTS/FX3/SLOW GEAR/LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2727", "10012B00", "EFFECTS/FX3/SLOW GEAR BASS/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2728", "10012B01", "EFFECTS/FX3/SLOW GEAR BASS/RISE TIME", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2729", "10012B02", "EFFECTS/FX3/SLOW GEAR BASS/LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2730", "10012C00", "EFFECTS/FX3/SOUND HOLD/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2731", "10012C01", "EFFECTS/FX3/SOUND HOLD/RISE TIME", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2732", "10012C02", "EFFECTS/FX3/SOUND HOLD/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2733", "10012D00", "EFFECTS/FX3/TOUCH WAH/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2734", "10012D01", "EFFECTS/FX3/TOUCH WAH/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2735", "10012D02", "EFFECTS/FX3/TOUCH WAH/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2736", "10012D03", "EFFECTS/FX3/TOUCH WAH/FREQUENCY", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2737", "10012D04", "EFFECTS/FX3/TOUCH WAH/RESONANCE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2738", "10012D05", "EFFECTS/FX3/TOUCH WAH/DECAY", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2739", "10012D06", "EFFECTS/FX3/TOUCH WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2740", "10012D07", "EFFECTS/FX3/TOUCH WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2741", "10012E00", "EFFECTS/FX3/TOUCH WAH BASS/FILTER MODE", choices_FILTER_MODE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2742", "10012E01", "EFFECTS/FX3/TOUCH WAH BASS/POLARITY", choices_POLARITY, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2743", "10012E02", "EFFECTS/FX3/TOUCH WAH BASS/SENS", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2744", "10012E03", "EFFECTS/FX3/TOUCH WAH BASS/FREQUENCY", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2745", "10012E04", "EFFECTS/FX3/TOUCH WAH BASS/RESONANCE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2746", "10012E05", "EFFECTS/FX3/TOUCH WAH BASS/DECAY", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2747", "10012E06", "EFFECTS/FX3/TOUCH WAH BASS/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2748", "10012E07", "EFFECTS/FX3/TOUCH WAH BASS/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2749", "10012F00", "EFFECTS/FX3/TREMOLO/WAVE SHAPE", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2750", "10012F01", "EFFECTS/FX3/TREMOLO/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2751", "10012F01", "EFFECTS/FX3/TREMOLO/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2752", "10012F02", "EFFECTS/FX3/TREMOLO/DEPTH", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2753", "10012F03", "EFFECTS/FX3/TREMOLO/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2754", "10012F04", "EFFECTS/FX3/TREMOLO/DIRECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2755", "10013000", "EFFECTS/FX3/VIBRATO/RATE BPM", choices_RATE_BPM, DUALBPM, 1, 0, 118, 0, 100);
-        addParameter("2756", "10013000", "EFFECTS/FX3/VIBRATO/RATE", {}, DUALTIME, 1, 0, 118, 0, 100);
-        addParameter("2757", "10013001", "EFFECTS/FX3/VIBRATO/DEPTH", {}, SINGLE, 1, 0, 1000, 0, 0);
-        addParameter("2758", "10013002", "EFFECTS/FX3/VIBRATO/TRIGGER", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2759", "10013003", "EFFECTS/FX3/VIBRATO/RISE TIME", {}, SINGLE, 1, 0, 1000, 0, 0);
-        addParameter("2760", "10013004", "EFFECTS/FX3/VIBRATO/EFFECT LEVEL", {}, SINGLE, 1, 0, 1000, 0, 0);
-        addParameter("2761", "10013005", "EFFECTS/FX3/VIBRATO/DIRECT LEVEL", {}, SINGLE, 1, 0, 1000, 0, 0);
-        addParameter("2762", "10013100", "EFFECTS/FX3/WAH/TYPE", choices_WAH_TYPE, SINGLE, 1, 0, 0, 0, 0);
-        addParameter("2763", "10013101", "EFFECTS/FX3/WAH/EFFECT LEVEL", {}, SINGLE, 1, 0, 118, 0, 0);
-        addParameter("2764", "10013102", "EFFECTS/FX3/WAH/PEDAL POSITION", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2765", "10013106", "EFFECTS/FX3/WAH/PEDAL MIN", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2766", "1001310A", "EFFECTS/FX3/WAH/PEDAL MAX", {}, SINGLE, 4, 0, 1000, 0, 0);
-        addParameter("2767", "1001310E", "EFFECTS/FX3/WAH/DIRECT LEVEL", {}, SINGLE, 1, 0, 100, 0, 0);
+        addBlock("FX1", "EFFECTS/FX1/", 1811, 319, "10004000");
+
+        // FX2 and FX3 have the structure of FX1 at their own base address
+        addBlockInstance("FX2", "EFFECTS/FX2/", "FX1", "10006600");
+        addBlockInstance("FX3", "EFFECTS/FX3/", "FX1", "10010C00");
         addParameter("2768", "00011000", "CTL/CONTROL FUNCTION/NUM1 FUNCTION", choices_NUM_FUNCTION, SINGLE, 1, 0, 0, 0, 0);
         addParameter("2769", "00011001", "CTL/CONTROL FUNCTION/NUM1 MODE", choices_CTL_CONTROL_MODE, SINGLE, 1, 0, 0, 0, 0);
         addParameter("2770", "00011002", "CTL/CONTROL FUNCTION/NUM2 FUNCTION", choices_NUM_FUNCTION, SINGLE, 1, 0, 0, 0, 0);
@@ -3186,18 +1480,46 @@ public:
         addParameter("3043", "7F000002", "SYSTEM/TUNER/ON_OFF", choices_ON_OFF, SINGLE, 1, 0, 0, 0, 0);
         addParameter("3044", "00010000", "SYSTEM/PATCH NUMBER", choices_PATCHNUMBER, SINGLE, 4, 0, 0, 0, 0);
         // End of SY1000 Parameter definition
+        mSharedChoices.clear();
     }
 
     // Enum and Data struct for returning parameter data
     enum ParameterType { SINGLE, DUALTIME, DUALBPM, REGISTER, REGISTERBIT };
 
+    // Choice texts of a parameter. All rows with the same choice list, and the block instances of a row, share
+    // one immutable array, a row only holds a reference to it.
+    class Choices
+    {
+    public:
+
+        Choices() = default;
+        Choices(const juce::StringArray& choices)
+            : mChoices(choices.isEmpty() ? nullptr : std::make_shared<const juce::StringArray>(choices))
+        {
+        }
+
+        int size() const                                { return mChoices != nullptr ? mChoices->size() : 0; }
+        juce::String operator[](int index) const        { return mChoices != nullptr ? (*mChoices)[index] : juce::String(); }
+        int indexOf(const juce::String& text) const     { return mChoices != nullptr ? mChoices->indexOf(text) : -1; }
+
+        operator const juce::StringArray&() const
+        {
+            static const juce::StringArray empty;
+            return mChoices != nullptr ? *mChoices : empty;
+        }
+
+    private:
+
+        std::shared_ptr<const juce::StringArray> mChoices;
+    };
+
     // Parameter data structure 
     struct Data
     {
         juce::String parameterID = "";
         juce::String hexAddress = "";
         juce::String parameterName = "";
-        juce::StringArray choices = { };
+        Choices choices;
         ParameterType parameterType = ParameterType::SINGLE;
         int dataBytes = 0;
         int minValue = 0;
@@ -3215,7 +1537,7 @@ public:
     };
 
     
-    std::size_t size()
+    std::size_t size() const
     {
         return mParameter.size();
     }
@@ -3262,6 +1584,62 @@ public:
         return false;
     }
 
+    // Direct access by table index (the parameterID of every entry is its index)
+    const Data& getParameterData(int parameterIndex) const
+    {
+        return mParameter[parameterIndex];
+    }
+
+    // A block of parameters that exists several times on the device (INST1/2/3, FX1/2/3).
+    // The instances share the structure of their template: parameter n of every instance has the same
+    // address offset, width, range and choices.
+    struct Block
+    {
+        juce::String name = "";             // e.g. "INST2"
+        juce::String namePrefix = "";       // e.g. "INST2/"
+        juce::String templateName = "";     // name of the block the instance was created from
+        int firstIndex = 0;
+        int numParameters = 0;
+        juce::uint32 baseAddress = 0;       // 4 address bytes of 7 bit, e.g. 0x10002000
+    };
+
+    const std::vector<Block>& getBlocks() const
+    {
+        return mBlocks;
+    }
+
+    const Block* getBlock(const juce::String& name) const
+    {
+        for (auto& block : mBlocks)
+        {
+            if (block.name == name)
+                return &block;
+        }
+        return nullptr;
+    }
+
+    // Block that contains the parameter, nullptr if it is not part of a block
+    const Block* getBlock(int parameterIndex) const
+    {
+        for (auto& block : mBlocks)
+        {
+            if (parameterIndex >= block.firstIndex && parameterIndex < block.firstIndex + block.numParameters)
+                return &block;
+        }
+        return nullptr;
+    }
+
+    // 4 address bytes of 7 bit <-> linear address, e.g. the address after 0x1000157F is 0x10001600
+    static juce::uint32 toLinearAddress(juce::uint32 address)
+    {
+        return ((address >> 24) & 0x7F) << 21 | ((address >> 16) & 0x7F) << 14 | ((address >> 8) & 0x7F) << 7 | (address & 0x7F);
+    }
+
+    static juce::uint32 fromLinearAddress(juce::uint32 linearAddress)
+    {
+        return ((linearAddress >> 21) & 0x7F) << 24 | ((linearAddress >> 14) & 0x7F) << 16 | ((linearAddress >> 7) & 0x7F) << 8 | (linearAddress & 0x7F);
+    }
+
 
     bool getParameterData(juce::String hexAddress, int dataBytes, ParameterType parameterType, Data& parameterData)
     {
@@ -3282,14 +1660,23 @@ private:
     
         
     std::vector<Data> mParameter;
+    std::vector<Block> mBlocks;
+    // Shared Choices of the choices_XXX lists of the constructor, only used while the table is built
+    std::map<const juce::StringArray*, Choices> mSharedChoices;
 
-    void addParameter(juce::String parameterID, juce::String hexAddress, juce::String parameterName, juce::StringArray choices, ParameterType parameterType, int dataBytes, int minValue, int maxValue, int defaultValue, int maxtimeValue)
+    void addParameter(juce::String parameterID, juce::String hexAddress, juce::String parameterName, const juce::StringArray& choices, ParameterType parameterType, int dataBytes, int minValue, int maxValue, int defaultValue, int maxtimeValue)
     {
         Data newParameter;
         newParameter.parameterID = parameterID;
         newParameter.hexAddress = hexAddress;
         newParameter.parameterName = parameterName;
-        newParameter.choices = choices;
+        if (!choices.isEmpty())
+        {
+            auto sharedChoices = mSharedChoices.find(&choices);
+            if (sharedChoices == mSharedChoices.end())
+                sharedChoices = mSharedChoices.emplace(&choices, Choices(choices)).first;
+            newParameter.choices = sharedChoices->second;
+        }
         newParameter.parameterType = parameterType;
         newParameter.dataBytes = dataBytes;
         newParameter.minValue = minValue;
@@ -3300,5 +1687,56 @@ private:
         mParameter.push_back(newParameter);
 
     };
+
+    // Marks already added parameters as a block template
+    void addBlock(juce::String name, juce::String namePrefix, int firstIndex, int numParameters, juce::String baseHexAddress)
+    {
+        Block block;
+        block.name = name;
+        block.namePrefix = namePrefix;
+        block.templateName = name;
+        block.firstIndex = firstIndex;
+        block.numParameters = numParameters;
+        block.baseAddress = (juce::uint32)baseHexAddress.getHexValue32();
+        mBlocks.push_back(block);
+    }
+
+    // Appends the parameters of the template block again, moved to baseHexAddress and renamed to namePrefix.
+    // Only ID, address and name are new, the choices are shared with the template rows.
+    void addBlockInstance(juce::String name, juce::String namePrefix, juce::String templateName, juce::String baseHexAddress)
+    {
+        const Block* source = getBlock(templateName);
+        jassert(source != nullptr);
+
+        Block block = *source;
+        block.name = name;
+        block.namePrefix = namePrefix;
+        block.templateName = templateName;
+        block.firstIndex = (int)mParameter.size();
+        block.baseAddress = (juce::uint32)baseHexAddress.getHexValue32();
+        juce::uint32 addressOffset = toLinearAddress(block.baseAddress) - toLinearAddress(source->baseAddress);
+
+        for (int i = 0; i < block.numParameters; i++)
+        {
+            Data newParameter = mParameter[(size_t)(source->firstIndex + i)];
+            juce::uint32 address = fromLinearAddress(toLinearAddress((juce::uint32)newParameter.hexAddress.getHexValue32()) + addressOffset);
+            newParameter.parameterID = juce::String(block.firstIndex + i);
+            newParameter.hexAddress = juce::String::toHexString((juce::int64)address).paddedLeft('0', 8).toUpperCase();
+            newParameter.parameterName = namePrefix + newParameter.parameterName.substring(source->namePrefix.length());
+            mParameter.push_back(newParameter);
+        }
+        mBlocks.push_back(block);
+    }
+
+    void setBlockDefaultValue(juce::String blockName, juce::String leafName, int defaultValue)
+    {
+        const Block* block = getBlock(blockName);
+        jassert(block != nullptr);
+        for (int i = block->firstIndex; i < block->firstIndex + block->numParameters; i++)
+        {
+            if (mParameter[(size_t)i].parameterName == block->namePrefix + leafName)
+                mParameter[(size_t)i].defaultValue = defaultValue;
+        }
+    }
     
 };
\ No newline at end of file
@@ -1,3047 +0,0 @@
-#pragma once
-sliderAttachment_0 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "0", slider_0);
-sliderAttachment_1 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1", slider_1);
-sliderAttachment_2 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2", slider_2);
-sliderAttachment_3 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3", slider_3);
-sliderAttachment_4 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "4", slider_4);
-sliderAttachment_5 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "5", slider_5);
-sliderAttachment_6 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "6", slider_6);
-sliderAttachment_7 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "7", slider_7);
-sliderAttachment_8 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "8", slider_8);
-sliderAttachment_9 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "9", slider_9);
-sliderAttachment_10 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "10", slider_10);
-sliderAttachment_11 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "11", slider_11);
-sliderAttachment_12 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "12", slider_12);
-sliderAttachment_13 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "13", slider_13);
-sliderAttachment_14 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "14", slider_14);
-sliderAttachment_15 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "15", slider_15);
-sliderAttachment_16 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "16", slider_16);
-sliderAttachment_17 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "17", slider_17);
-sliderAttachment_18 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "18", slider_18);
-sliderAttachment_19 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "19", slider_19);
-sliderAttachment_20 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "20", slider_20);
-sliderAttachment_21 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "21", slider_21);
-sliderAttachment_22 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "22", slider_22);
-sliderAttachment_23 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "23", slider_23);
-sliderAttachment_24 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "24", slider_24);
-sliderAttachment_25 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "25", slider_25);
-sliderAttachment_26 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "26", slider_26);
-sliderAttachment_27 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "27", slider_27);
-sliderAttachment_28 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "28", slider_28);
-sliderAttachment_29 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "29", slider_29);
-sliderAttachment_30 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "30", slider_30);
-sliderAttachment_31 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "31", slider_31);
-sliderAttachment_32 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "32", slider_32);
-sliderAttachment_33 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "33", slider_33);
-sliderAttachment_34 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "34", slider_34);
-sliderAttachment_35 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "35", slider_35);
-sliderAttachment_36 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "36", slider_36);
-sliderAttachment_37 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "37", slider_37);
-sliderAttachment_38 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "38", slider_38);
-sliderAttachment_39 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "39", slider_39);
-sliderAttachment_40 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "40", slider_40);
-sliderAttachment_41 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "41", slider_41);
-sliderAttachment_42 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "42", slider_42);
-sliderAttachment_43 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "43", slider_43);
-sliderAttachment_44 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "44", slider_44);
-sliderAttachment_45 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "45", slider_45);
-sliderAttachment_46 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "46", slider_46);
-sliderAttachment_47 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "47", slider_47);
-sliderAttachment_48 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "48", slider_48);
-sliderAttachment_49 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "49", slider_49);
-sliderAttachment_50 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "50", slider_50);
-sliderAttachment_51 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "51", slider_51);
-sliderAttachment_52 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "52", slider_52);
-sliderAttachment_53 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "53", slider_53);
-sliderAttachment_54 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "54", slider_54);
-sliderAttachment_55 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "55", slider_55);
-sliderAttachment_56 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "56", slider_56);
-sliderAttachment_57 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "57", slider_57);
-sliderAttachment_58 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "58", slider_58);
-sliderAttachment_59 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "59", slider_59);
-sliderAttachment_60 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "60", slider_60);
-sliderAttachment_61 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "61", slider_61);
-sliderAttachment_62 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "62", slider_62);
-sliderAttachment_63 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "63", slider_63);
-sliderAttachment_64 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "64", slider_64);
-sliderAttachment_65 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "65", slider_65);
-sliderAttachment_66 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "66", slider_66);
-sliderAttachment_67 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "67", slider_67);
-sliderAttachment_68 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "68", slider_68);
-sliderAttachment_69 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "69", slider_69);
-sliderAttachment_70 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "70", slider_70);
-sliderAttachment_71 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "71", slider_71);
-sliderAttachment_72 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "72", slider_72);
-sliderAttachment_73 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "73", slider_73);
-sliderAttachment_74 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "74", slider_74);
-sliderAttachment_75 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "75", slider_75);
-sliderAttachment_76 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "76", slider_76);
-sliderAttachment_77 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "77", slider_77);
-sliderAttachment_78 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "78", slider_78);
-sliderAttachment_79 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "79", slider_79);
-sliderAttachment_80 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "80", slider_80);
-sliderAttachment_81 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "81", slider_81);
-sliderAttachment_82 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "82", slider_82);
-sliderAttachment_83 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "83", slider_83);
-sliderAttachment_84 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "84", slider_84);
-sliderAttachment_85 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "85", slider_85);
-sliderAttachment_86 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "86", slider_86);
-sliderAttachment_87 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "87", slider_87);
-sliderAttachment_88 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "88", slider_88);
-sliderAttachment_89 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "89", slider_89);
-sliderAttachment_90 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "90", slider_90);
-sliderAttachment_91 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "91", slider_91);
-sliderAttachment_92 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "92", slider_92);
-sliderAttachment_93 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "93", slider_93);
-sliderAttachment_94 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "94", slider_94);
-sliderAttachment_95 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "95", slider_95);
-sliderAttachment_96 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "96", slider_96);
-sliderAttachment_97 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "97", slider_97);
-sliderAttachment_98 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "98", slider_98);
-sliderAttachment_99 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "99", slider_99);
-sliderAttachment_100 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "100", slider_100);
-sliderAttachment_101 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "101", slider_101);
-sliderAttachment_102 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "102", slider_102);
-sliderAttachment_103 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "103", slider_103);
-sliderAttachment_104 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "104", slider_104);
-sliderAttachment_105 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "105", slider_105);
-sliderAttachment_106 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "106", slider_106);
-sliderAttachment_107 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "107", slider_107);
-sliderAttachment_108 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "108", slider_108);
-sliderAttachment_109 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "109", slider_109);
-sliderAttachment_110 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "110", slider_110);
-sliderAttachment_111 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "111", slider_111);
-sliderAttachment_112 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "112", slider_112);
-sliderAttachment_113 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "113", slider_113);
-sliderAttachment_114 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "114", slider_114);
-sliderAttachment_115 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "115", slider_115);
-sliderAttachment_116 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "116", slider_116);
-sliderAttachment_117 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "117", slider_117);
-sliderAttachment_118 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "118", slider_118);
-sliderAttachment_119 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "119", slider_119);
-sliderAttachment_120 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "120", slider_120);
-sliderAttachment_121 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "121", slider_121);
-sliderAttachment_122 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "122", slider_122);
-sliderAttachment_123 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "123", slider_123);
-sliderAttachment_124 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "124", slider_124);
-sliderAttachment_125 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "125", slider_125);
-sliderAttachment_126 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "126", slider_126);
-sliderAttachment_127 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "127", slider_127);
-sliderAttachment_128 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "128", slider_128);
-sliderAttachment_129 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "129", slider_129);
-sliderAttachment_130 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "130", slider_130);
-sliderAttachment_131 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "131", slider_131);
-sliderAttachment_132 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "132", slider_132);
-sliderAttachment_133 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "133", slider_133);
-sliderAttachment_134 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "134", slider_134);
-sliderAttachment_135 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "135", slider_135);
-sliderAttachment_136 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "136", slider_136);
-sliderAttachment_137 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "137", slider_137);
-sliderAttachment_138 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "138", slider_138);
-sliderAttachment_139 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "139", slider_139);
-sliderAttachment_140 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "140", slider_140);
-sliderAttachment_141 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "141", slider_141);
-sliderAttachment_142 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "142", slider_142);
-sliderAttachment_143 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "143", slider_143);
-sliderAttachment_144 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "144", slider_144);
-sliderAttachment_145 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "145", slider_145);
-sliderAttachment_146 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "146", slider_146);
-sliderAttachment_147 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "147", slider_147);
-sliderAttachment_148 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "148", slider_148);
-sliderAttachment_149 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "149", slider_149);
-sliderAttachment_150 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "150", slider_150);
-sliderAttachment_151 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "151", slider_151);
-sliderAttachment_152 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "152", slider_152);
-sliderAttachment_153 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "153", slider_153);
-sliderAttachment_154 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "154", slider_154);
-sliderAttachment_155 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "155", slider_155);
-sliderAttachment_156 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "156", slider_156);
-sliderAttachment_157 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "157", slider_157);
-sliderAttachment_158 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "158", slider_158);
-sliderAttachment_159 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "159", slider_159);
-sliderAttachment_160 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "160", slider_160);
-sliderAttachment_161 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "161", slider_161);
-sliderAttachment_162 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "162", slider_162);
-sliderAttachment_163 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "163", slider_163);
-sliderAttachment_164 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "164", slider_164);
-sliderAttachment_165 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "165", slider_165);
-sliderAttachment_166 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "166", slider_166);
-sliderAttachment_167 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "167", slider_167);
-sliderAttachment_168 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "168", slider_168);
-sliderAttachment_169 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "169", slider_169);
-sliderAttachment_170 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "170", slider_170);
-sliderAttachment_171 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "171", slider_171);
-sliderAttachment_172 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "172", slider_172);
-sliderAttachment_173 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "173", slider_173);
-sliderAttachment_174 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "174", slider_174);
-sliderAttachment_175 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "175", slider_175);
-sliderAttachment_176 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "176", slider_176);
-sliderAttachment_177 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "177", slider_177);
-sliderAttachment_178 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "178", slider_178);
-sliderAttachment_179 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "179", slider_179);
-sliderAttachment_180 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "180", slider_180);
-sliderAttachment_181 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "181", slider_181);
-sliderAttachment_182 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "182", slider_182);
-sliderAttachment_183 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "183", slider_183);
-sliderAttachment_184 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "184", slider_184);
-sliderAttachment_185 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "185", slider_185);
-sliderAttachment_186 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "186", slider_186);
-sliderAttachment_187 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "187", slider_187);
-sliderAttachment_188 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "188", slider_188);
-sliderAttachment_189 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "189", slider_189);
-sliderAttachment_190 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "190", slider_190);
-sliderAttachment_191 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "191", slider_191);
-sliderAttachment_192 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "192", slider_192);
-sliderAttachment_193 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "193", slider_193);
-sliderAttachment_194 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "194", slider_194);
-sliderAttachment_195 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "195", slider_195);
-sliderAttachment_196 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "196", slider_196);
-sliderAttachment_197 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "197", slider_197);
-sliderAttachment_198 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "198", slider_198);
-sliderAttachment_199 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "199", slider_199);
-sliderAttachment_200 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "200", slider_200);
-sliderAttachment_201 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "201", slider_201);
-sliderAttachment_202 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "202", slider_202);
-sliderAttachment_203 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "203", slider_203);
-sliderAttachment_204 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "204", slider_204);
-sliderAttachment_205 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "205", slider_205);
-sliderAttachment_206 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "206", slider_206);
-sliderAttachment_207 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "207", slider_207);
-sliderAttachment_208 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "208", slider_208);
-sliderAttachment_209 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "209", slider_209);
-sliderAttachment_210 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "210", slider_210);
-sliderAttachment_211 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "211", slider_211);
-sliderAttachment_212 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "212", slider_212);
-sliderAttachment_213 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "213", slider_213);
-sliderAttachment_214 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "214", slider_214);
-sliderAttachment_215 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "215", slider_215);
-sliderAttachment_216 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "216", slider_216);
-sliderAttachment_217 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "217", slider_217);
-sliderAttachment_218 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "218", slider_218);
-sliderAttachment_219 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "219", slider_219);
-sliderAttachment_220 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "220", slider_220);
-sliderAttachment_221 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "221", slider_221);
-sliderAttachment_222 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "222", slider_222);
-sliderAttachment_223 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "223", slider_223);
-sliderAttachment_224 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "224", slider_224);
-sliderAttachment_225 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "225", slider_225);
-sliderAttachment_226 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "226", slider_226);
-sliderAttachment_227 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "227", slider_227);
-sliderAttachment_228 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "228", slider_228);
-sliderAttachment_229 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "229", slider_229);
-sliderAttachment_230 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "230", slider_230);
-sliderAttachment_231 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "231", slider_231);
-sliderAttachment_232 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "232", slider_232);
-sliderAttachment_233 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "233", slider_233);
-sliderAttachment_234 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "234", slider_234);
-sliderAttachment_235 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "235", slider_235);
-sliderAttachment_236 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "236", slider_236);
-sliderAttachment_237 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "237", slider_237);
-sliderAttachment_238 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "238", slider_238);
-sliderAttachment_239 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "239", slider_239);
-sliderAttachment_240 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "240", slider_240);
-sliderAttachment_241 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "241", slider_241);
-sliderAttachment_242 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "242", slider_242);
-sliderAttachment_243 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "243", slider_243);
-sliderAttachment_244 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "244", slider_244);
-sliderAttachment_245 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "245", slider_245);
-sliderAttachment_246 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "246", slider_246);
-sliderAttachment_247 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "247", slider_247);
-sliderAttachment_248 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "248", slider_248);
-sliderAttachment_249 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "249", slider_249);
-sliderAttachment_250 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "250", slider_250);
-sliderAttachment_251 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "251", slider_251);
-sliderAttachment_252 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "252", slider_252);
-sliderAttachment_253 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "253", slider_253);
-sliderAttachment_254 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "254", slider_254);
-sliderAttachment_255 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "255", slider_255);
-sliderAttachment_256 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "256", slider_256);
-sliderAttachment_257 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "257", slider_257);
-sliderAttachment_258 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "258", slider_258);
-sliderAttachment_259 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "259", slider_259);
-sliderAttachment_260 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "260", slider_260);
-sliderAttachment_261 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "261", slider_261);
-sliderAttachment_262 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "262", slider_262);
-sliderAttachment_263 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "263", slider_263);
-sliderAttachment_264 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "264", slider_264);
-sliderAttachment_265 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "265", slider_265);
-sliderAttachment_266 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "266", slider_266);
-sliderAttachment_267 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "267", slider_267);
-sliderAttachment_268 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "268", slider_268);
-sliderAttachment_269 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "269", slider_269);
-sliderAttachment_270 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "270", slider_270);
-sliderAttachment_271 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "271", slider_271);
-sliderAttachment_272 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "272", slider_272);
-sliderAttachment_273 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "273", slider_273);
-sliderAttachment_274 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "274", slider_274);
-sliderAttachment_275 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "275", slider_275);
-sliderAttachment_276 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "276", slider_276);
-sliderAttachment_277 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "277", slider_277);
-sliderAttachment_278 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "278", slider_278);
-sliderAttachment_279 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "279", slider_279);
-sliderAttachment_280 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "280", slider_280);
-sliderAttachment_281 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "281", slider_281);
-sliderAttachment_282 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "282", slider_282);
-sliderAttachment_283 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "283", slider_283);
-sliderAttachment_284 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "284", slider_284);
-sliderAttachment_285 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "285", slider_285);
-sliderAttachment_286 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "286", slider_286);
-sliderAttachment_287 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "287", slider_287);
-sliderAttachment_288 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "288", slider_288);
-sliderAttachment_289 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "289", slider_289);
-sliderAttachment_290 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "290", slider_290);
-sliderAttachment_291 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "291", slider_291);
-sliderAttachment_292 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "292", slider_292);
-sliderAttachment_293 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "293", slider_293);
-sliderAttachment_294 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "294", slider_294);
-sliderAttachment_295 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "295", slider_295);
-sliderAttachment_296 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "296", slider_296);
-sliderAttachment_297 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "297", slider_297);
-sliderAttachment_298 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "298", slider_298);
-sliderAttachment_299 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "299", slider_299);
-sliderAttachment_300 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "300", slider_300);
-sliderAttachment_301 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "301", slider_301);
-sliderAttachment_302 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "302", slider_302);
-sliderAttachment_303 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "303", slider_303);
-sliderAttachment_304 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "304", slider_304);
-sliderAttachment_305 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "305", slider_305);
-sliderAttachment_306 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "306", slider_306);
-sliderAttachment_307 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "307", slider_307);
-sliderAttachment_308 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "308", slider_308);
-sliderAttachment_309 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "309", slider_309);
-sliderAttachment_310 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "310", slider_310);
-sliderAttachment_311 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "311", slider_311);
-sliderAttachment_312 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "312", slider_312);
-sliderAttachment_313 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "313", slider_313);
-sliderAttachment_314 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "314", slider_314);
-sliderAttachment_315 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "315", slider_315);
-sliderAttachment_316 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "316", slider_316);
-sliderAttachment_317 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "317", slider_317);
-sliderAttachment_318 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "318", slider_318);
-sliderAttachment_319 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "319", slider_319);
-sliderAttachment_320 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "320", slider_320);
-sliderAttachment_321 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "321", slider_321);
-sliderAttachment_322 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "322", slider_322);
-sliderAttachment_323 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "323", slider_323);
-sliderAttachment_324 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "324", slider_324);
-sliderAttachment_325 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "325", slider_325);
-sliderAttachment_326 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "326", slider_326);
-sliderAttachment_327 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "327", slider_327);
-sliderAttachment_328 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "328", slider_328);
-sliderAttachment_329 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "329", slider_329);
-sliderAttachment_330 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "330", slider_330);
-sliderAttachment_331 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "331", slider_331);
-sliderAttachment_332 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "332", slider_332);
-sliderAttachment_333 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "333", slider_333);
-sliderAttachment_334 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "334", slider_334);
-sliderAttachment_335 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "335", slider_335);
-sliderAttachment_336 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "336", slider_336);
-sliderAttachment_337 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "337", slider_337);
-sliderAttachment_338 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "338", slider_338);
-sliderAttachment_339 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "339", slider_339);
-sliderAttachment_340 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "340", slider_340);
-sliderAttachment_341 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "341", slider_341);
-sliderAttachment_342 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "342", slider_342);
-sliderAttachment_343 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "343", slider_343);
-sliderAttachment_344 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "344", slider_344);
-sliderAttachment_345 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "345", slider_345);
-sliderAttachment_346 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "346", slider_346);
-sliderAttachment_347 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "347", slider_347);
-sliderAttachment_348 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "348", slider_348);
-sliderAttachment_349 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "349", slider_349);
-sliderAttachment_350 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "350", slider_350);
-sliderAttachment_351 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "351", slider_351);
-sliderAttachment_352 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "352", slider_352);
-sliderAttachment_353 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "353", slider_353);
-sliderAttachment_354 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "354", slider_354);
-sliderAttachment_355 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "355", slider_355);
-sliderAttachment_356 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "356", slider_356);
-sliderAttachment_357 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "357", slider_357);
-sliderAttachment_358 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "358", slider_358);
-sliderAttachment_359 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "359", slider_359);
-sliderAttachment_360 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "360", slider_360);
-sliderAttachment_361 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "361", slider_361);
-sliderAttachment_362 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "362", slider_362);
-sliderAttachment_363 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "363", slider_363);
-sliderAttachment_364 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "364", slider_364);
-sliderAttachment_365 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "365", slider_365);
-sliderAttachment_366 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "366", slider_366);
-sliderAttachment_367 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "367", slider_367);
-sliderAttachment_368 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "368", slider_368);
-sliderAttachment_369 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "369", slider_369);
-sliderAttachment_370 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "370", slider_370);
-sliderAttachment_371 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "371", slider_371);
-sliderAttachment_372 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "372", slider_372);
-sliderAttachment_373 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "373", slider_373);
-sliderAttachment_374 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "374", slider_374);
-sliderAttachment_375 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "375", slider_375);
-sliderAttachment_376 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "376", slider_376);
-sliderAttachment_377 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "377", slider_377);
-sliderAttachment_378 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "378", slider_378);
-sliderAttachment_379 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "379", slider_379);
-sliderAttachment_380 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "380", slider_380);
-sliderAttachment_381 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "381", slider_381);
-sliderAttachment_382 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "382", slider_382);
-sliderAttachment_383 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "383", slider_383);
-sliderAttachment_384 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "384", slider_384);
-sliderAttachment_385 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "385", slider_385);
-sliderAttachment_386 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "386", slider_386);
-sliderAttachment_387 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "387", slider_387);
-sliderAttachment_388 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "388", slider_388);
-sliderAttachment_389 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "389", slider_389);
-sliderAttachment_390 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "390", slider_390);
-sliderAttachment_391 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "391", slider_391);
-sliderAttachment_392 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "392", slider_392);
-sliderAttachment_393 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "393", slider_393);
-sliderAttachment_394 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "394", slider_394);
-sliderAttachment_395 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "395", slider_395);
-sliderAttachment_396 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "396", slider_396);
-sliderAttachment_397 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "397", slider_397);
-sliderAttachment_398 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "398", slider_398);
-sliderAttachment_399 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "399", slider_399);
-sliderAttachment_400 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "400", slider_400);
-sliderAttachment_401 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "401", slider_401);
-sliderAttachment_402 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "402", slider_402);
-sliderAttachment_403 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "403", slider_403);
-sliderAttachment_404 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "404", slider_404);
-sliderAttachment_405 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "405", slider_405);
-sliderAttachment_406 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "406", slider_406);
-sliderAttachment_407 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "407", slider_407);
-sliderAttachment_408 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "408", slider_408);
-sliderAttachment_409 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "409", slider_409);
-sliderAttachment_410 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "410", slider_410);
-sliderAttachment_411 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "411", slider_411);
-sliderAttachment_412 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "412", slider_412);
-sliderAttachment_413 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "413", slider_413);
-sliderAttachment_414 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "414", slider_414);
-sliderAttachment_415 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "415", slider_415);
-sliderAttachment_416 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "416", slider_416);
-sliderAttachment_417 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "417", slider_417);
-sliderAttachment_418 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "418", slider_418);
-sliderAttachment_419 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "419", slider_419);
-sliderAttachment_420 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "420", slider_420);
-sliderAttachment_421 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "421", slider_421);
-sliderAttachment_422 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "422", slider_422);
-sliderAttachment_423 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "423", slider_423);
-sliderAttachment_424 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "424", slider_424);
-sliderAttachment_425 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "425", slider_425);
-sliderAttachment_426 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "426", slider_426);
-sliderAttachment_427 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "427", slider_427);
-sliderAttachment_428 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "428", slider_428);
-sliderAttachment_429 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "429", slider_429);
-sliderAttachment_430 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "430", slider_430);
-sliderAttachment_431 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "431", slider_431);
-sliderAttachment_432 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "432", slider_432);
-sliderAttachment_433 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "433", slider_433);
-sliderAttachment_434 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "434", slider_434);
-sliderAttachment_435 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "435", slider_435);
-sliderAttachment_436 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "436", slider_436);
-sliderAttachment_437 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "437", slider_437);
-sliderAttachment_438 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "438", slider_438);
-sliderAttachment_439 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "439", slider_439);
-sliderAttachment_440 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "440", slider_440);
-sliderAttachment_441 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "441", slider_441);
-sliderAttachment_442 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "442", slider_442);
-sliderAttachment_443 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "443", slider_443);
-sliderAttachment_444 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "444", slider_444);
-sliderAttachment_445 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "445", slider_445);
-sliderAttachment_446 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "446", slider_446);
-sliderAttachment_447 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "447", slider_447);
-sliderAttachment_448 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "448", slider_448);
-sliderAttachment_449 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "449", slider_449);
-sliderAttachment_450 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "450", slider_450);
-sliderAttachment_451 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "451", slider_451);
-sliderAttachment_452 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "452", slider_452);
-sliderAttachment_453 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "453", slider_453);
-sliderAttachment_454 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "454", slider_454);
-sliderAttachment_455 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "455", slider_455);
-sliderAttachment_456 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "456", slider_456);
-sliderAttachment_457 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "457", slider_457);
-sliderAttachment_458 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "458", slider_458);
-sliderAttachment_459 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "459", slider_459);
-sliderAttachment_460 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "460", slider_460);
-sliderAttachment_461 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "461", slider_461);
-sliderAttachment_462 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "462", slider_462);
-sliderAttachment_463 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "463", slider_463);
-sliderAttachment_464 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "464", slider_464);
-sliderAttachment_465 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "465", slider_465);
-sliderAttachment_466 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "466", slider_466);
-sliderAttachment_467 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "467", slider_467);
-sliderAttachment_468 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "468", slider_468);
-sliderAttachment_469 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "469", slider_469);
-sliderAttachment_470 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "470", slider_470);
-sliderAttachment_471 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "471", slider_471);
-sliderAttachment_472 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "472", slider_472);
-sliderAttachment_473 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "473", slider_473);
-sliderAttachment_474 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "474", slider_474);
-sliderAttachment_475 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "475", slider_475);
-sliderAttachment_476 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "476", slider_476);
-sliderAttachment_477 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "477", slider_477);
-sliderAttachment_478 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "478", slider_478);
-sliderAttachment_479 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "479", slider_479);
-sliderAttachment_480 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "480", slider_480);
-sliderAttachment_481 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "481", slider_481);
-sliderAttachment_482 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "482", slider_482);
-sliderAttachment_483 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "483", slider_483);
-sliderAttachment_484 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "484", slider_484);
-sliderAttachment_485 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "485", slider_485);
-sliderAttachment_486 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "486", slider_486);
-sliderAttachment_487 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "487", slider_487);
-sliderAttachment_488 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "488", slider_488);
-sliderAttachment_489 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "489", slider_489);
-sliderAttachment_490 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "490", slider_490);
-sliderAttachment_491 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "491", slider_491);
-sliderAttachment_492 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "492", slider_492);
-sliderAttachment_493 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "493", slider_493);
-sliderAttachment_494 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "494", slider_494);
-sliderAttachment_495 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "495", slider_495);
-sliderAttachment_496 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "496", slider_496);
-sliderAttachment_497 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "497", slider_497);
-sliderAttachment_498 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "498", slider_498);
-sliderAttachment_499 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "499", slider_499);
-sliderAttachment_500 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "500", slider_500);
-sliderAttachment_501 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "501", slider_501);
-sliderAttachment_502 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "502", slider_502);
-sliderAttachment_503 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "503", slider_503);
-sliderAttachment_504 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "504", slider_504);
-sliderAttachment_505 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "505", slider_505);
-sliderAttachment_506 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "506", slider_506);
-sliderAttachment_507 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "507", slider_507);
-sliderAttachment_508 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "508", slider_508);
-sliderAttachment_509 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "509", slider_509);
-sliderAttachment_510 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "510", slider_510);
-sliderAttachment_511 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "511", slider_511);
-sliderAttachment_512 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "512", slider_512);
-sliderAttachment_513 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "513", slider_513);
-sliderAttachment_514 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "514", slider_514);
-sliderAttachment_515 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "515", slider_515);
-sliderAttachment_516 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "516", slider_516);
-sliderAttachment_517 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "517", slider_517);
-sliderAttachment_518 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "518", slider_518);
-sliderAttachment_519 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "519", slider_519);
-sliderAttachment_520 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "520", slider_520);
-sliderAttachment_521 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "521", slider_521);
-sliderAttachment_522 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "522", slider_522);
-sliderAttachment_523 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "523", slider_523);
-sliderAttachment_524 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "524", slider_524);
-sliderAttachment_525 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "525", slider_525);
-sliderAttachment_526 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "526", slider_526);
-sliderAttachment_527 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "527", slider_527);
-sliderAttachment_528 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "528", slider_528);
-sliderAttachment_529 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "529", slider_529);
-sliderAttachment_530 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "530", slider_530);
-sliderAttachment_531 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "531", slider_531);
-sliderAttachment_532 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "532", slider_532);
-sliderAttachment_533 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "533", slider_533);
-sliderAttachment_534 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "534", slider_534);
-sliderAttachment_535 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "535", slider_535);
-sliderAttachment_536 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "536", slider_536);
-sliderAttachment_537 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "537", slider_537);
-sliderAttachment_538 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "538", slider_538);
-sliderAttachment_539 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "539", slider_539);
-sliderAttachment_540 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "540", slider_540);
-sliderAttachment_541 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "541", slider_541);
-sliderAttachment_542 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "542", slider_542);
-sliderAttachment_543 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "543", slider_543);
-sliderAttachment_544 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "544", slider_544);
-sliderAttachment_545 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "545", slider_545);
-sliderAttachment_546 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "546", slider_546);
-sliderAttachment_547 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "547", slider_547);
-sliderAttachment_548 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "548", slider_548);
-sliderAttachment_549 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "549", slider_549);
-sliderAttachment_550 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "550", slider_550);
-sliderAttachment_551 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "551", slider_551);
-sliderAttachment_552 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "552", slider_552);
-sliderAttachment_553 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "553", slider_553);
-sliderAttachment_554 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "554", slider_554);
-sliderAttachment_555 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "555", slider_555);
-sliderAttachment_556 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "556", slider_556);
-sliderAttachment_557 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "557", slider_557);
-sliderAttachment_558 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "558", slider_558);
-sliderAttachment_559 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "559", slider_559);
-sliderAttachment_560 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "560", slider_560);
-sliderAttachment_561 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "561", slider_561);
-sliderAttachment_562 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "562", slider_562);
-sliderAttachment_563 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "563", slider_563);
-sliderAttachment_564 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "564", slider_564);
-sliderAttachment_565 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "565", slider_565);
-sliderAttachment_566 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "566", slider_566);
-sliderAttachment_567 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "567", slider_567);
-sliderAttachment_568 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "568", slider_568);
-sliderAttachment_569 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "569", slider_569);
-sliderAttachment_570 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "570", slider_570);
-sliderAttachment_571 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "571", slider_571);
-sliderAttachment_572 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "572", slider_572);
-sliderAttachment_573 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "573", slider_573);
-sliderAttachment_574 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "574", slider_574);
-sliderAttachment_575 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "575", slider_575);
-sliderAttachment_576 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "576", slider_576);
-sliderAttachment_577 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "577", slider_577);
-sliderAttachment_578 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "578", slider_578);
-sliderAttachment_579 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "579", slider_579);
-sliderAttachment_580 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "580", slider_580);
-sliderAttachment_581 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "581", slider_581);
-sliderAttachment_582 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "582", slider_582);
-sliderAttachment_583 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "583", slider_583);
-sliderAttachment_584 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "584", slider_584);
-sliderAttachment_585 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "585", slider_585);
-sliderAttachment_586 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "586", slider_586);
-sliderAttachment_587 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "587", slider_587);
-sliderAttachment_588 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "588", slider_588);
-sliderAttachment_589 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "589", slider_589);
-sliderAttachment_590 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "590", slider_590);
-sliderAttachment_591 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "591", slider_591);
-sliderAttachment_592 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "592", slider_592);
-sliderAttachment_593 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "593", slider_593);
-sliderAttachment_594 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "594", slider_594);
-sliderAttachment_595 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "595", slider_595);
-sliderAttachment_596 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "596", slider_596);
-sliderAttachment_597 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "597", slider_597);
-sliderAttachment_598 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "598", slider_598);
-sliderAttachment_599 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "599", slider_599);
-sliderAttachment_600 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "600", slider_600);
-sliderAttachment_601 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "601", slider_601);
-sliderAttachment_602 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "602", slider_602);
-sliderAttachment_603 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "603", slider_603);
-sliderAttachment_604 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "604", slider_604);
-sliderAttachment_605 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "605", slider_605);
-sliderAttachment_606 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "606", slider_606);
-sliderAttachment_607 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "607", slider_607);
-sliderAttachment_608 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "608", slider_608);
-sliderAttachment_609 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "609", slider_609);
-sliderAttachment_610 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "610", slider_610);
-sliderAttachment_611 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "611", slider_611);
-sliderAttachment_612 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "612", slider_612);
-sliderAttachment_613 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "613", slider_613);
-sliderAttachment_614 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "614", slider_614);
-sliderAttachment_615 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "615", slider_615);
-sliderAttachment_616 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "616", slider_616);
-sliderAttachment_617 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "617", slider_617);
-sliderAttachment_618 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "618", slider_618);
-sliderAttachment_619 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "619", slider_619);
-sliderAttachment_620 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "620", slider_620);
-sliderAttachment_621 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "621", slider_621);
-sliderAttachment_622 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "622", slider_622);
-sliderAttachment_623 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "623", slider_623);
-sliderAttachment_624 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "624", slider_624);
-sliderAttachment_625 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "625", slider_625);
-sliderAttachment_626 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "626", slider_626);
-sliderAttachment_627 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "627", slider_627);
-sliderAttachment_628 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "628", slider_628);
-sliderAttachment_629 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "629", slider_629);
-sliderAttachment_630 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "630", slider_630);
-sliderAttachment_631 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "631", slider_631);
-sliderAttachment_632 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "632", slider_632);
-sliderAttachment_633 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "633", slider_633);
-sliderAttachment_634 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "634", slider_634);
-sliderAttachment_635 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "635", slider_635);
-sliderAttachment_636 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "636", slider_636);
-sliderAttachment_637 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "637", slider_637);
-sliderAttachment_638 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "638", slider_638);
-sliderAttachment_639 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "639", slider_639);
-sliderAttachment_640 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "640", slider_640);
-sliderAttachment_641 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "641", slider_641);
-sliderAttachment_642 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "642", slider_642);
-sliderAttachment_643 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "643", slider_643);
-sliderAttachment_644 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "644", slider_644);
-sliderAttachment_645 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "645", slider_645);
-sliderAttachment_646 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "646", slider_646);
-sliderAttachment_647 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "647", slider_647);
-sliderAttachment_648 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "648", slider_648);
-sliderAttachment_649 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "649", slider_649);
-sliderAttachment_650 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "650", slider_650);
-sliderAttachment_651 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "651", slider_651);
-sliderAttachment_652 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "652", slider_652);
-sliderAttachment_653 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "653", slider_653);
-sliderAttachment_654 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "654", slider_654);
-sliderAttachment_655 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "655", slider_655);
-sliderAttachment_656 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "656", slider_656);
-sliderAttachment_657 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "657", slider_657);
-sliderAttachment_658 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "658", slider_658);
-sliderAttachment_659 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "659", slider_659);
-sliderAttachment_660 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "660", slider_660);
-sliderAttachment_661 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "661", slider_661);
-sliderAttachment_662 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "662", slider_662);
-sliderAttachment_663 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "663", slider_663);
-sliderAttachment_664 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "664", slider_664);
-sliderAttachment_665 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "665", slider_665);
-sliderAttachment_666 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "666", slider_666);
-sliderAttachment_667 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "667", slider_667);
-sliderAttachment_668 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "668", slider_668);
-sliderAttachment_669 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "669", slider_669);
-sliderAttachment_670 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "670", slider_670);
-sliderAttachment_671 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "671", slider_671);
-sliderAttachment_672 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "672", slider_672);
-sliderAttachment_673 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "673", slider_673);
-sliderAttachment_674 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "674", slider_674);
-sliderAttachment_675 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "675", slider_675);
-sliderAttachment_676 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "676", slider_676);
-sliderAttachment_677 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "677", slider_677);
-sliderAttachment_678 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "678", slider_678);
-sliderAttachment_679 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "679", slider_679);
-sliderAttachment_680 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "680", slider_680);
-sliderAttachment_681 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "681", slider_681);
-sliderAttachment_682 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "682", slider_682);
-sliderAttachment_683 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "683", slider_683);
-sliderAttachment_684 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "684", slider_684);
-sliderAttachment_685 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "685", slider_685);
-sliderAttachment_686 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "686", slider_686);
-sliderAttachment_687 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "687", slider_687);
-sliderAttachment_688 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "688", slider_688);
-sliderAttachment_689 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "689", slider_689);
-sliderAttachment_690 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "690", slider_690);
-sliderAttachment_691 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "691", slider_691);
-sliderAttachment_692 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "692", slider_692);
-sliderAttachment_693 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "693", slider_693);
-sliderAttachment_694 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "694", slider_694);
-sliderAttachment_695 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "695", slider_695);
-sliderAttachment_696 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "696", slider_696);
-sliderAttachment_697 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "697", slider_697);
-sliderAttachment_698 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "698", slider_698);
-sliderAttachment_699 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "699", slider_699);
-sliderAttachment_700 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "700", slider_700);
-sliderAttachment_701 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "701", slider_701);
-sliderAttachment_702 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "702", slider_702);
-sliderAttachment_703 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "703", slider_703);
-sliderAttachment_704 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "704", slider_704);
-sliderAttachment_705 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "705", slider_705);
-sliderAttachment_706 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "706", slider_706);
-sliderAttachment_707 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "707", slider_707);
-sliderAttachment_708 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "708", slider_708);
-sliderAttachment_709 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "709", slider_709);
-sliderAttachment_710 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "710", slider_710);
-sliderAttachment_711 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "711", slider_711);
-sliderAttachment_712 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "712", slider_712);
-sliderAttachment_713 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "713", slider_713);
-sliderAttachment_714 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "714", slider_714);
-sliderAttachment_715 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "715", slider_715);
-sliderAttachment_716 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "716", slider_716);
-sliderAttachment_717 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "717", slider_717);
-sliderAttachment_718 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "718", slider_718);
-sliderAttachment_719 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "719", slider_719);
-sliderAttachment_720 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "720", slider_720);
-sliderAttachment_721 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "721", slider_721);
-sliderAttachment_722 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "722", slider_722);
-sliderAttachment_723 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "723", slider_723);
-sliderAttachment_724 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "724", slider_724);
-sliderAttachment_725 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "725", slider_725);
-sliderAttachment_726 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "726", slider_726);
-sliderAttachment_727 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "727", slider_727);
-sliderAttachment_728 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "728", slider_728);
-sliderAttachment_729 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "729", slider_729);
-sliderAttachment_730 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "730", slider_730);
-sliderAttachment_731 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "731", slider_731);
-sliderAttachment_732 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "732", slider_732);
-sliderAttachment_733 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "733", slider_733);
-sliderAttachment_734 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "734", slider_734);
-sliderAttachment_735 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "735", slider_735);
-sliderAttachment_736 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "736", slider_736);
-sliderAttachment_737 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "737", slider_737);
-sliderAttachment_738 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "738", slider_738);
-sliderAttachment_739 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "739", slider_739);
-sliderAttachment_740 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "740", slider_740);
-sliderAttachment_741 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "741", slider_741);
-sliderAttachment_742 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "742", slider_742);
-sliderAttachment_743 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "743", slider_743);
-sliderAttachment_744 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "744", slider_744);
-sliderAttachment_745 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "745", slider_745);
-sliderAttachment_746 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "746", slider_746);
-sliderAttachment_747 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "747", slider_747);
-sliderAttachment_748 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "748", slider_748);
-sliderAttachment_749 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "749", slider_749);
-sliderAttachment_750 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "750", slider_750);
-sliderAttachment_751 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "751", slider_751);
-sliderAttachment_752 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "752", slider_752);
-sliderAttachment_753 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "753", slider_753);
-sliderAttachment_754 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "754", slider_754);
-sliderAttachment_755 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "755", slider_755);
-sliderAttachment_756 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "756", slider_756);
-sliderAttachment_757 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "757", slider_757);
-sliderAttachment_758 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "758", slider_758);
-sliderAttachment_759 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "759", slider_759);
-sliderAttachment_760 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "760", slider_760);
-sliderAttachment_761 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "761", slider_761);
-sliderAttachment_762 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "762", slider_762);
-sliderAttachment_763 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "763", slider_763);
-sliderAttachment_764 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "764", slider_764);
-sliderAttachment_765 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "765", slider_765);
-sliderAttachment_766 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "766", slider_766);
-sliderAttachment_767 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "767", slider_767);
-sliderAttachment_768 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "768", slider_768);
-sliderAttachment_769 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "769", slider_769);
-sliderAttachment_770 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "770", slider_770);
-sliderAttachment_771 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "771", slider_771);
-sliderAttachment_772 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "772", slider_772);
-sliderAttachment_773 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "773", slider_773);
-sliderAttachment_774 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "774", slider_774);
-sliderAttachment_775 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "775", slider_775);
-sliderAttachment_776 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "776", slider_776);
-sliderAttachment_777 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "777", slider_777);
-sliderAttachment_778 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "778", slider_778);
-sliderAttachment_779 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "779", slider_779);
-sliderAttachment_780 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "780", slider_780);
-sliderAttachment_781 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "781", slider_781);
-sliderAttachment_782 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "782", slider_782);
-sliderAttachment_783 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "783", slider_783);
-sliderAttachment_784 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "784", slider_784);
-sliderAttachment_785 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "785", slider_785);
-sliderAttachment_786 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "786", slider_786);
-sliderAttachment_787 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "787", slider_787);
-sliderAttachment_788 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "788", slider_788);
-sliderAttachment_789 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "789", slider_789);
-sliderAttachment_790 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "790", slider_790);
-sliderAttachment_791 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "791", slider_791);
-sliderAttachment_792 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "792", slider_792);
-sliderAttachment_793 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "793", slider_793);
-sliderAttachment_794 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "794", slider_794);
-sliderAttachment_795 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "795", slider_795);
-sliderAttachment_796 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "796", slider_796);
-sliderAttachment_797 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "797", slider_797);
-sliderAttachment_798 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "798", slider_798);
-sliderAttachment_799 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "799", slider_799);
-sliderAttachment_800 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "800", slider_800);
-sliderAttachment_801 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "801", slider_801);
-sliderAttachment_802 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "802", slider_802);
-sliderAttachment_803 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "803", slider_803);
-sliderAttachment_804 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "804", slider_804);
-sliderAttachment_805 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "805", slider_805);
-sliderAttachment_806 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "806", slider_806);
-sliderAttachment_807 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "807", slider_807);
-sliderAttachment_808 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "808", slider_808);
-sliderAttachment_809 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "809", slider_809);
-sliderAttachment_810 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "810", slider_810);
-sliderAttachment_811 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "811", slider_811);
-sliderAttachment_812 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "812", slider_812);
-sliderAttachment_813 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "813", slider_813);
-sliderAttachment_814 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "814", slider_814);
-sliderAttachment_815 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "815", slider_815);
-sliderAttachment_816 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "816", slider_816);
-sliderAttachment_817 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "817", slider_817);
-sliderAttachment_818 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "818", slider_818);
-sliderAttachment_819 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "819", slider_819);
-sliderAttachment_820 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "820", slider_820);
-sliderAttachment_821 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "821", slider_821);
-sliderAttachment_822 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "822", slider_822);
-sliderAttachment_823 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "823", slider_823);
-sliderAttachment_824 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "824", slider_824);
-sliderAttachment_825 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "825", slider_825);
-sliderAttachment_826 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "826", slider_826);
-sliderAttachment_827 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "827", slider_827);
-sliderAttachment_828 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "828", slider_828);
-sliderAttachment_829 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "829", slider_829);
-sliderAttachment_830 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "830", slider_830);
-sliderAttachment_831 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "831", slider_831);
-sliderAttachment_832 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "832", slider_832);
-sliderAttachment_833 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "833", slider_833);
-sliderAttachment_834 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "834", slider_834);
-sliderAttachment_835 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "835", slider_835);
-sliderAttachment_836 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "836", slider_836);
-sliderAttachment_837 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "837", slider_837);
-sliderAttachment_838 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "838", slider_838);
-sliderAttachment_839 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "839", slider_839);
-sliderAttachment_840 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "840", slider_840);
-sliderAttachment_841 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "841", slider_841);
-sliderAttachment_842 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "842", slider_842);
-sliderAttachment_843 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "843", slider_843);
-sliderAttachment_844 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "844", slider_844);
-sliderAttachment_845 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "845", slider_845);
-sliderAttachment_846 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "846", slider_846);
-sliderAttachment_847 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "847", slider_847);
-sliderAttachment_848 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "848", slider_848);
-sliderAttachment_849 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "849", slider_849);
-sliderAttachment_850 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "850", slider_850);
-sliderAttachment_851 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "851", slider_851);
-sliderAttachment_852 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "852", slider_852);
-sliderAttachment_853 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "853", slider_853);
-sliderAttachment_854 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "854", slider_854);
-sliderAttachment_855 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "855", slider_855);
-sliderAttachment_856 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "856", slider_856);
-sliderAttachment_857 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "857", slider_857);
-sliderAttachment_858 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "858", slider_858);
-sliderAttachment_859 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "859", slider_859);
-sliderAttachment_860 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "860", slider_860);
-sliderAttachment_861 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "861", slider_861);
-sliderAttachment_862 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "862", slider_862);
-sliderAttachment_863 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "863", slider_863);
-sliderAttachment_864 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "864", slider_864);
-sliderAttachment_865 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "865", slider_865);
-sliderAttachment_866 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "866", slider_866);
-sliderAttachment_867 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "867", slider_867);
-sliderAttachment_868 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "868", slider_868);
-sliderAttachment_869 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "869", slider_869);
-sliderAttachment_870 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "870", slider_870);
-sliderAttachment_871 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "871", slider_871);
-sliderAttachment_872 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "872", slider_872);
-sliderAttachment_873 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "873", slider_873);
-sliderAttachment_874 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "874", slider_874);
-sliderAttachment_875 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "875", slider_875);
-sliderAttachment_876 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "876", slider_876);
-sliderAttachment_877 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "877", slider_877);
-sliderAttachment_878 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "878", slider_878);
-sliderAttachment_879 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "879", slider_879);
-sliderAttachment_880 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "880", slider_880);
-sliderAttachment_881 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "881", slider_881);
-sliderAttachment_882 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "882", slider_882);
-sliderAttachment_883 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "883", slider_883);
-sliderAttachment_884 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "884", slider_884);
-sliderAttachment_885 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "885", slider_885);
-sliderAttachment_886 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "886", slider_886);
-sliderAttachment_887 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "887", slider_887);
-sliderAttachment_888 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "888", slider_888);
-sliderAttachment_889 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "889", slider_889);
-sliderAttachment_890 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "890", slider_890);
-sliderAttachment_891 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "891", slider_891);
-sliderAttachment_892 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "892", slider_892);
-sliderAttachment_893 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "893", slider_893);
-sliderAttachment_894 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "894", slider_894);
-sliderAttachment_895 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "895", slider_895);
-sliderAttachment_896 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "896", slider_896);
-sliderAttachment_897 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "897", slider_897);
-sliderAttachment_898 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "898", slider_898);
-sliderAttachment_899 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "899", slider_899);
-sliderAttachment_900 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "900", slider_900);
-sliderAttachment_901 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "901", slider_901);
-sliderAttachment_902 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "902", slider_902);
-sliderAttachment_903 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "903", slider_903);
-sliderAttachment_904 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "904", slider_904);
-sliderAttachment_905 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "905", slider_905);
-sliderAttachment_906 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "906", slider_906);
-sliderAttachment_907 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "907", slider_907);
-sliderAttachment_908 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "908", slider_908);
-sliderAttachment_909 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "909", slider_909);
-sliderAttachment_910 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "910", slider_910);
-sliderAttachment_911 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "911", slider_911);
-sliderAttachment_912 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "912", slider_912);
-sliderAttachment_913 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "913", slider_913);
-sliderAttachment_914 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "914", slider_914);
-sliderAttachment_915 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "915", slider_915);
-sliderAttachment_916 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "916", slider_916);
-sliderAttachment_917 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "917", slider_917);
-sliderAttachment_918 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "918", slider_918);
-sliderAttachment_919 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "919", slider_919);
-sliderAttachment_920 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "920", slider_920);
-sliderAttachment_921 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "921", slider_921);
-sliderAttachment_922 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "922", slider_922);
-sliderAttachment_923 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "923", slider_923);
-sliderAttachment_924 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "924", slider_924);
-sliderAttachment_925 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "925", slider_925);
-sliderAttachment_926 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "926", slider_926);
-sliderAttachment_927 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "927", slider_927);
-sliderAttachment_928 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "928", slider_928);
-sliderAttachment_929 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "929", slider_929);
-sliderAttachment_930 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "930", slider_930);
-sliderAttachment_931 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "931", slider_931);
-sliderAttachment_932 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "932", slider_932);
-sliderAttachment_933 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "933", slider_933);
-sliderAttachment_934 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "934", slider_934);
-sliderAttachment_935 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "935", slider_935);
-sliderAttachment_936 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "936", slider_936);
-sliderAttachment_937 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "937", slider_937);
-sliderAttachment_938 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "938", slider_938);
-sliderAttachment_939 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "939", slider_939);
-sliderAttachment_940 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "940", slider_940);
-sliderAttachment_941 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "941", slider_941);
-sliderAttachment_942 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "942", slider_942);
-sliderAttachment_943 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "943", slider_943);
-sliderAttachment_944 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "944", slider_944);
-sliderAttachment_945 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "945", slider_945);
-sliderAttachment_946 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "946", slider_946);
-sliderAttachment_947 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "947", slider_947);
-sliderAttachment_948 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "948", slider_948);
-sliderAttachment_949 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "949", slider_949);
-sliderAttachment_950 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "950", slider_950);
-sliderAttachment_951 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "951", slider_951);
-sliderAttachment_952 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "952", slider_952);
-sliderAttachment_953 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "953", slider_953);
-sliderAttachment_954 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "954", slider_954);
-sliderAttachment_955 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "955", slider_955);
-sliderAttachment_956 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "956", slider_956);
-sliderAttachment_957 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "957", slider_957);
-sliderAttachment_958 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "958", slider_958);
-sliderAttachment_959 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "959", slider_959);
-sliderAttachment_960 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "960", slider_960);
-sliderAttachment_961 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "961", slider_961);
-sliderAttachment_962 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "962", slider_962);
-sliderAttachment_963 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "963", slider_963);
-sliderAttachment_964 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "964", slider_964);
-sliderAttachment_965 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "965", slider_965);
-sliderAttachment_966 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "966", slider_966);
-sliderAttachment_967 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "967", slider_967);
-sliderAttachment_968 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "968", slider_968);
-sliderAttachment_969 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "969", slider_969);
-sliderAttachment_970 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "970", slider_970);
-sliderAttachment_971 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "971", slider_971);
-sliderAttachment_972 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "972", slider_972);
-sliderAttachment_973 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "973", slider_973);
-sliderAttachment_974 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "974", slider_974);
-sliderAttachment_975 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "975", slider_975);
-sliderAttachment_976 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "976", slider_976);
-sliderAttachment_977 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "977", slider_977);
-sliderAttachment_978 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "978", slider_978);
-sliderAttachment_979 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "979", slider_979);
-sliderAttachment_980 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "980", slider_980);
-sliderAttachment_981 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "981", slider_981);
-sliderAttachment_982 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "982", slider_982);
-sliderAttachment_983 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "983", slider_983);
-sliderAttachment_984 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "984", slider_984);
-sliderAttachment_985 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "985", slider_985);
-sliderAttachment_986 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "986", slider_986);
-sliderAttachment_987 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "987", slider_987);
-sliderAttachment_988 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "988", slider_988);
-sliderAttachment_989 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "989", slider_989);
-sliderAttachment_990 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "990", slider_990);
-sliderAttachment_991 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "991", slider_991);
-sliderAttachment_992 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "992", slider_992);
-sliderAttachment_993 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "993", slider_993);
-sliderAttachment_994 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "994", slider_994);
-sliderAttachment_995 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "995", slider_995);
-sliderAttachment_996 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "996", slider_996);
-sliderAttachment_997 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "997", slider_997);
-sliderAttachment_998 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "998", slider_998);
-sliderAttachment_999 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "999", slider_999);
-sliderAttachment_1000 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1000", slider_1000);
-sliderAttachment_1001 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1001", slider_1001);
-sliderAttachment_1002 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1002", slider_1002);
-sliderAttachment_1003 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1003", slider_1003);
-sliderAttachment_1004 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1004", slider_1004);
-sliderAttachment_1005 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1005", slider_1005);
-sliderAttachment_1006 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1006", slider_1006);
-sliderAttachment_1007 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1007", slider_1007);
-sliderAttachment_1008 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1008", slider_1008);
-sliderAttachment_1009 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1009", slider_1009);
-sliderAttachment_1010 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1010", slider_1010);
-sliderAttachment_1011 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1011", slider_1011);
-sliderAttachment_1012 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1012", slider_1012);
-sliderAttachment_1013 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1013", slider_1013);
-sliderAttachment_1014 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1014", slider_1014);
-sliderAttachment_1015 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1015", slider_1015);
-sliderAttachment_1016 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1016", slider_1016);
-sliderAttachment_1017 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1017", slider_1017);
-sliderAttachment_1018 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1018", slider_1018);
-sliderAttachment_1019 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1019", slider_1019);
-sliderAttachment_1020 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1020", slider_1020);
-sliderAttachment_1021 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1021", slider_1021);
-sliderAttachment_1022 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1022", slider_1022);
-sliderAttachment_1023 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1023", slider_1023);
-sliderAttachment_1024 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1024", slider_1024);
-sliderAttachment_1025 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1025", slider_1025);
-sliderAttachment_1026 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1026", slider_1026);
-sliderAttachment_1027 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1027", slider_1027);
-sliderAttachment_1028 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1028", slider_1028);
-sliderAttachment_1029 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1029", slider_1029);
-sliderAttachment_1030 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1030", slider_1030);
-sliderAttachment_1031 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1031", slider_1031);
-sliderAttachment_1032 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1032", slider_1032);
-sliderAttachment_1033 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1033", slider_1033);
-sliderAttachment_1034 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1034", slider_1034);
-sliderAttachment_1035 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1035", slider_1035);
-sliderAttachment_1036 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1036", slider_1036);
-sliderAttachment_1037 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1037", slider_1037);
-sliderAttachment_1038 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1038", slider_1038);
-sliderAttachment_1039 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1039", slider_1039);
-sliderAttachment_1040 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1040", slider_1040);
-sliderAttachment_1041 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1041", slider_1041);
-sliderAttachment_1042 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1042", slider_1042);
-sliderAttachment_1043 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1043", slider_1043);
-sliderAttachment_1044 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1044", slider_1044);
-sliderAttachment_1045 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1045", slider_1045);
-sliderAttachment_1046 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1046", slider_1046);
-sliderAttachment_1047 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1047", slider_1047);
-sliderAttachment_1048 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1048", slider_1048);
-sliderAttachment_1049 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1049", slider_1049);
-sliderAttachment_1050 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1050", slider_1050);
-sliderAttachment_1051 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1051", slider_1051);
-sliderAttachment_1052 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1052", slider_1052);
-sliderAttachment_1053 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1053", slider_1053);
-sliderAttachment_1054 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1054", slider_1054);
-sliderAttachment_1055 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1055", slider_1055);
-sliderAttachment_1056 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1056", slider_1056);
-sliderAttachment_1057 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1057", slider_1057);
-sliderAttachment_1058 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1058", slider_1058);
-sliderAttachment_1059 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1059", slider_1059);
-sliderAttachment_1060 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1060", slider_1060);
-sliderAttachment_1061 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1061", slider_1061);
-sliderAttachment_1062 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1062", slider_1062);
-sliderAttachment_1063 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1063", slider_1063);
-sliderAttachment_1064 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1064", slider_1064);
-sliderAttachment_1065 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1065", slider_1065);
-sliderAttachment_1066 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1066", slider_1066);
-sliderAttachment_1067 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1067", slider_1067);
-sliderAttachment_1068 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1068", slider_1068);
-sliderAttachment_1069 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1069", slider_1069);
-sliderAttachment_1070 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1070", slider_1070);
-sliderAttachment_1071 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1071", slider_1071);
-sliderAttachment_1072 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1072", slider_1072);
-sliderAttachment_1073 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1073", slider_1073);
-sliderAttachment_1074 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1074", slider_1074);
-sliderAttachment_1075 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1075", slider_1075);
-sliderAttachment_1076 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1076", slider_1076);
-sliderAttachment_1077 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1077", slider_1077);
-sliderAttachment_1078 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1078", slider_1078);
-sliderAttachment_1079 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1079", slider_1079);
-sliderAttachment_1080 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1080", slider_1080);
-sliderAttachment_1081 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1081", slider_1081);
-sliderAttachment_1082 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1082", slider_1082);
-sliderAttachment_1083 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1083", slider_1083);
-sliderAttachment_1084 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1084", slider_1084);
-sliderAttachment_1085 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1085", slider_1085);
-sliderAttachment_1086 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1086", slider_1086);
-sliderAttachment_1087 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1087", slider_1087);
-sliderAttachment_1088 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1088", slider_1088);
-sliderAttachment_1089 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1089", slider_1089);
-sliderAttachment_1090 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1090", slider_1090);
-sliderAttachment_1091 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1091", slider_1091);
-sliderAttachment_1092 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1092", slider_1092);
-sliderAttachment_1093 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1093", slider_1093);
-sliderAttachment_1094 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1094", slider_1094);
-sliderAttachment_1095 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1095", slider_1095);
-sliderAttachment_1096 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1096", slider_1096);
-sliderAttachment_1097 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1097", slider_1097);
-sliderAttachment_1098 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1098", slider_1098);
-sliderAttachment_1099 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1099", slider_1099);
-sliderAttachment_1100 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1100", slider_1100);
-sliderAttachment_1101 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1101", slider_1101);
-sliderAttachment_1102 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1102", slider_1102);
-sliderAttachment_1103 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1103", slider_1103);
-sliderAttachment_1104 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1104", slider_1104);
-sliderAttachment_1105 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1105", slider_1105);
-sliderAttachment_1106 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1106", slider_1106);
-sliderAttachment_1107 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1107", slider_1107);
-sliderAttachment_1108 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1108", slider_1108);
-sliderAttachment_1109 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1109", slider_1109);
-sliderAttachment_1110 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1110", slider_1110);
-sliderAttachment_1111 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1111", slider_1111);
-sliderAttachment_1112 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1112", slider_1112);
-sliderAttachment_1113 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1113", slider_1113);
-sliderAttachment_1114 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1114", slider_1114);
-sliderAttachment_1115 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1115", slider_1115);
-sliderAttachment_1116 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1116", slider_1116);
-sliderAttachment_1117 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1117", slider_1117);
-sliderAttachment_1118 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1118", slider_1118);
-sliderAttachment_1119 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1119", slider_1119);
-sliderAttachment_1120 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1120", slider_1120);
-sliderAttachment_1121 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1121", slider_1121);
-sliderAttachment_1122 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1122", slider_1122);
-sliderAttachment_1123 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1123", slider_1123);
-sliderAttachment_1124 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1124", slider_1124);
-sliderAttachment_1125 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1125", slider_1125);
-sliderAttachment_1126 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1126", slider_1126);
-sliderAttachment_1127 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1127", slider_1127);
-sliderAttachment_1128 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1128", slider_1128);
-sliderAttachment_1129 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1129", slider_1129);
-sliderAttachment_1130 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1130", slider_1130);
-sliderAttachment_1131 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1131", slider_1131);
-sliderAttachment_1132 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1132", slider_1132);
-sliderAttachment_1133 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1133", slider_1133);
-sliderAttachment_1134 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1134", slider_1134);
-sliderAttachment_1135 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1135", slider_1135);
-sliderAttachment_1136 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1136", slider_1136);
-sliderAttachment_1137 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1137", slider_1137);
-sliderAttachment_1138 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1138", slider_1138);
-sliderAttachment_1139 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1139", slider_1139);
-sliderAttachment_1140 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1140", slider_1140);
-sliderAttachment_1141 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1141", slider_1141);
-sliderAttachment_1142 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1142", slider_1142);
-sliderAttachment_1143 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1143", slider_1143);
-sliderAttachment_1144 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1144", slider_1144);
-sliderAttachment_1145 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1145", slider_1145);
-sliderAttachment_1146 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1146", slider_1146);
-sliderAttachment_1147 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1147", slider_1147);
-sliderAttachment_1148 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1148", slider_1148);
-sliderAttachment_1149 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1149", slider_1149);
-sliderAttachment_1150 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1150", slider_1150);
-sliderAttachment_1151 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1151", slider_1151);
-sliderAttachment_1152 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1152", slider_1152);
-sliderAttachment_1153 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1153", slider_1153);
-sliderAttachment_1154 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1154", slider_1154);
-sliderAttachment_1155 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1155", slider_1155);
-sliderAttachment_1156 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1156", slider_1156);
-sliderAttachment_1157 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1157", slider_1157);
-sliderAttachment_1158 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1158", slider_1158);
-sliderAttachment_1159 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1159", slider_1159);
-sliderAttachment_1160 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1160", slider_1160);
-sliderAttachment_1161 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1161", slider_1161);
-sliderAttachment_1162 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1162", slider_1162);
-sliderAttachment_1163 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1163", slider_1163);
-sliderAttachment_1164 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1164", slider_1164);
-sliderAttachment_1165 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1165", slider_1165);
-sliderAttachment_1166 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1166", slider_1166);
-sliderAttachment_1167 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1167", slider_1167);
-sliderAttachment_1168 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1168", slider_1168);
-sliderAttachment_1169 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1169", slider_1169);
-sliderAttachment_1170 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1170", slider_1170);
-sliderAttachment_1171 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1171", slider_1171);
-sliderAttachment_1172 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1172", slider_1172);
-sliderAttachment_1173 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1173", slider_1173);
-sliderAttachment_1174 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1174", slider_1174);
-sliderAttachment_1175 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1175", slider_1175);
-sliderAttachment_1176 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1176", slider_1176);
-sliderAttachment_1177 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1177", slider_1177);
-sliderAttachment_1178 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1178", slider_1178);
-sliderAttachment_1179 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1179", slider_1179);
-sliderAttachment_1180 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1180", slider_1180);
-sliderAttachment_1181 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1181", slider_1181);
-sliderAttachment_1182 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1182", slider_1182);
-sliderAttachment_1183 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1183", slider_1183);
-sliderAttachment_1184 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1184", slider_1184);
-sliderAttachment_1185 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1185", slider_1185);
-sliderAttachment_1186 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1186", slider_1186);
-sliderAttachment_1187 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1187", slider_1187);
-sliderAttachment_1188 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1188", slider_1188);
-sliderAttachment_1189 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1189", slider_1189);
-sliderAttachment_1190 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1190", slider_1190);
-sliderAttachment_1191 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1191", slider_1191);
-sliderAttachment_1192 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1192", slider_1192);
-sliderAttachment_1193 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1193", slider_1193);
-sliderAttachment_1194 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1194", slider_1194);
-sliderAttachment_1195 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1195", slider_1195);
-sliderAttachment_1196 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1196", slider_1196);
-sliderAttachment_1197 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1197", slider_1197);
-sliderAttachment_1198 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1198", slider_1198);
-sliderAttachment_1199 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1199", slider_1199);
-sliderAttachment_1200 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1200", slider_1200);
-sliderAttachment_1201 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1201", slider_1201);
-sliderAttachment_1202 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1202", slider_1202);
-sliderAttachment_1203 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1203", slider_1203);
-sliderAttachment_1204 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1204", slider_1204);
-sliderAttachment_1205 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1205", slider_1205);
-sliderAttachment_1206 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1206", slider_1206);
-sliderAttachment_1207 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1207", slider_1207);
-sliderAttachment_1208 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1208", slider_1208);
-sliderAttachment_1209 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1209", slider_1209);
-sliderAttachment_1210 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1210", slider_1210);
-sliderAttachment_1211 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1211", slider_1211);
-sliderAttachment_1212 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1212", slider_1212);
-sliderAttachment_1213 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1213", slider_1213);
-sliderAttachment_1214 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1214", slider_1214);
-sliderAttachment_1215 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1215", slider_1215);
-sliderAttachment_1216 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1216", slider_1216);
-sliderAttachment_1217 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1217", slider_1217);
-sliderAttachment_1218 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1218", slider_1218);
-sliderAttachment_1219 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1219", slider_1219);
-sliderAttachment_1220 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1220", slider_1220);
-sliderAttachment_1221 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1221", slider_1221);
-sliderAttachment_1222 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1222", slider_1222);
-sliderAttachment_1223 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1223", slider_1223);
-sliderAttachment_1224 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1224", slider_1224);
-sliderAttachment_1225 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1225", slider_1225);
-sliderAttachment_1226 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1226", slider_1226);
-sliderAttachment_1227 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1227", slider_1227);
-sliderAttachment_1228 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1228", slider_1228);
-sliderAttachment_1229 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1229", slider_1229);
-sliderAttachment_1230 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1230", slider_1230);
-sliderAttachment_1231 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1231", slider_1231);
-sliderAttachment_1232 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1232", slider_1232);
-sliderAttachment_1233 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1233", slider_1233);
-sliderAttachment_1234 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1234", slider_1234);
-sliderAttachment_1235 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1235", slider_1235);
-sliderAttachment_1236 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1236", slider_1236);
-sliderAttachment_1237 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1237", slider_1237);
-sliderAttachment_1238 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1238", slider_1238);
-sliderAttachment_1239 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1239", slider_1239);
-sliderAttachment_1240 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1240", slider_1240);
-sliderAttachment_1241 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1241", slider_1241);
-sliderAttachment_1242 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1242", slider_1242);
-sliderAttachment_1243 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1243", slider_1243);
-sliderAttachment_1244 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1244", slider_1244);
-sliderAttachment_1245 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1245", slider_1245);
-sliderAttachment_1246 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1246", slider_1246);
-sliderAttachment_1247 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1247", slider_1247);
-sliderAttachment_1248 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1248", slider_1248);
-sliderAttachment_1249 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1249", slider_1249);
-sliderAttachment_1250 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1250", slider_1250);
-sliderAttachment_1251 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1251", slider_1251);
-sliderAttachment_1252 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1252", slider_1252);
-sliderAttachment_1253 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1253", slider_1253);
-sliderAttachment_1254 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1254", slider_1254);
-sliderAttachment_1255 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1255", slider_1255);
-sliderAttachment_1256 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1256", slider_1256);
-sliderAttachment_1257 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1257", slider_1257);
-sliderAttachment_1258 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1258", slider_1258);
-sliderAttachment_1259 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1259", slider_1259);
-sliderAttachment_1260 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1260", slider_1260);
-sliderAttachment_1261 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1261", slider_1261);
-sliderAttachment_1262 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1262", slider_1262);
-sliderAttachment_1263 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1263", slider_1263);
-sliderAttachment_1264 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1264", slider_1264);
-sliderAttachment_1265 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1265", slider_1265);
-sliderAttachment_1266 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1266", slider_1266);
-sliderAttachment_1267 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1267", slider_1267);
-sliderAttachment_1268 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1268", slider_1268);
-sliderAttachment_1269 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1269", slider_1269);
-sliderAttachment_1270 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1270", slider_1270);
-sliderAttachment_1271 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1271", slider_1271);
-sliderAttachment_1272 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1272", slider_1272);
-sliderAttachment_1273 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1273", slider_1273);
-sliderAttachment_1274 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1274", slider_1274);
-sliderAttachment_1275 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1275", slider_1275);
-sliderAttachment_1276 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1276", slider_1276);
-sliderAttachment_1277 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1277", slider_1277);
-sliderAttachment_1278 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1278", slider_1278);
-sliderAttachment_1279 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1279", slider_1279);
-sliderAttachment_1280 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1280", slider_1280);
-sliderAttachment_1281 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1281", slider_1281);
-sliderAttachment_1282 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1282", slider_1282);
-sliderAttachment_1283 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1283", slider_1283);
-sliderAttachment_1284 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1284", slider_1284);
-sliderAttachment_1285 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1285", slider_1285);
-sliderAttachment_1286 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1286", slider_1286);
-sliderAttachment_1287 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1287", slider_1287);
-sliderAttachment_1288 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1288", slider_1288);
-sliderAttachment_1289 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1289", slider_1289);
-sliderAttachment_1290 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1290", slider_1290);
-sliderAttachment_1291 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1291", slider_1291);
-sliderAttachment_1292 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1292", slider_1292);
-sliderAttachment_1293 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1293", slider_1293);
-sliderAttachment_1294 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1294", slider_1294);
-sliderAttachment_1295 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1295", slider_1295);
-sliderAttachment_1296 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1296", slider_1296);
-sliderAttachment_1297 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1297", slider_1297);
-sliderAttachment_1298 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1298", slider_1298);
-sliderAttachment_1299 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1299", slider_1299);
-sliderAttachment_1300 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1300", slider_1300);
-sliderAttachment_1301 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1301", slider_1301);
-sliderAttachment_1302 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1302", slider_1302);
-sliderAttachment_1303 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1303", slider_1303);
-sliderAttachment_1304 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1304", slider_1304);
-sliderAttachment_1305 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1305", slider_1305);
-sliderAttachment_1306 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1306", slider_1306);
-sliderAttachment_1307 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1307", slider_1307);
-sliderAttachment_1308 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1308", slider_1308);
-sliderAttachment_1309 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1309", slider_1309);
-sliderAttachment_1310 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1310", slider_1310);
-sliderAttachment_1311 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1311", slider_1311);
-sliderAttachment_1312 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1312", slider_1312);
-sliderAttachment_1313 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1313", slider_1313);
-sliderAttachment_1314 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1314", slider_1314);
-sliderAttachment_1315 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1315", slider_1315);
-sliderAttachment_1316 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1316", slider_1316);
-sliderAttachment_1317 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1317", slider_1317);
-sliderAttachment_1318 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1318", slider_1318);
-sliderAttachment_1319 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1319", slider_1319);
-sliderAttachment_1320 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1320", slider_1320);
-sliderAttachment_1321 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1321", slider_1321);
-sliderAttachment_1322 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1322", slider_1322);
-sliderAttachment_1323 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1323", slider_1323);
-sliderAttachment_1324 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1324", slider_1324);
-sliderAttachment_1325 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1325", slider_1325);
-sliderAttachment_1326 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1326", slider_1326);
-sliderAttachment_1327 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1327", slider_1327);
-sliderAttachment_1328 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1328", slider_1328);
-sliderAttachment_1329 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1329", slider_1329);
-sliderAttachment_1330 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1330", slider_1330);
-sliderAttachment_1331 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1331", slider_1331);
-sliderAttachment_1332 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1332", slider_1332);
-sliderAttachment_1333 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1333", slider_1333);
-sliderAttachment_1334 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1334", slider_1334);
-sliderAttachment_1335 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1335", slider_1335);
-sliderAttachment_1336 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1336", slider_1336);
-sliderAttachment_1337 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1337", slider_1337);
-sliderAttachment_1338 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1338", slider_1338);
-sliderAttachment_1339 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1339", slider_1339);
-sliderAttachment_1340 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1340", slider_1340);
-sliderAttachment_1341 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1341", slider_1341);
-sliderAttachment_1342 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1342", slider_1342);
-sliderAttachment_1343 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1343", slider_1343);
-sliderAttachment_1344 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1344", slider_1344);
-sliderAttachment_1345 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1345", slider_1345);
-sliderAttachment_1346 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1346", slider_1346);
-sliderAttachment_1347 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1347", slider_1347);
-sliderAttachment_1348 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1348", slider_1348);
-sliderAttachment_1349 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1349", slider_1349);
-sliderAttachment_1350 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1350", slider_1350);
-sliderAttachment_1351 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1351", slider_1351);
-sliderAttachment_1352 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1352", slider_1352);
-sliderAttachment_1353 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1353", slider_1353);
-sliderAttachment_1354 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1354", slider_1354);
-sliderAttachment_1355 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1355", slider_1355);
-sliderAttachment_1356 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1356", slider_1356);
-sliderAttachment_1357 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1357", slider_1357);
-sliderAttachment_1358 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1358", slider_1358);
-sliderAttachment_1359 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1359", slider_1359);
-sliderAttachment_1360 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1360", slider_1360);
-sliderAttachment_1361 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1361", slider_1361);
-sliderAttachment_1362 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1362", slider_1362);
-sliderAttachment_1363 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1363", slider_1363);
-sliderAttachment_1364 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1364", slider_1364);
-sliderAttachment_1365 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1365", slider_1365);
-sliderAttachment_1366 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1366", slider_1366);
-sliderAttachment_1367 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1367", slider_1367);
-sliderAttachment_1368 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1368", slider_1368);
-sliderAttachment_1369 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1369", slider_1369);
-sliderAttachment_1370 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1370", slider_1370);
-sliderAttachment_1371 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1371", slider_1371);
-sliderAttachment_1372 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1372", slider_1372);
-sliderAttachment_1373 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1373", slider_1373);
-sliderAttachment_1374 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1374", slider_1374);
-sliderAttachment_1375 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1375", slider_1375);
-sliderAttachment_1376 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1376", slider_1376);
-sliderAttachment_1377 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1377", slider_1377);
-sliderAttachment_1378 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1378", slider_1378);
-sliderAttachment_1379 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1379", slider_1379);
-sliderAttachment_1380 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1380", slider_1380);
-sliderAttachment_1381 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1381", slider_1381);
-sliderAttachment_1382 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1382", slider_1382);
-sliderAttachment_1383 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1383", slider_1383);
-sliderAttachment_1384 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1384", slider_1384);
-sliderAttachment_1385 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1385", slider_1385);
-sliderAttachment_1386 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1386", slider_1386);
-sliderAttachment_1387 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1387", slider_1387);
-sliderAttachment_1388 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1388", slider_1388);
-sliderAttachment_1389 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1389", slider_1389);
-sliderAttachment_1390 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1390", slider_1390);
-sliderAttachment_1391 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1391", slider_1391);
-sliderAttachment_1392 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1392", slider_1392);
-sliderAttachment_1393 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1393", slider_1393);
-sliderAttachment_1394 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1394", slider_1394);
-sliderAttachment_1395 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1395", slider_1395);
-sliderAttachment_1396 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1396", slider_1396);
-sliderAttachment_1397 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1397", slider_1397);
-sliderAttachment_1398 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1398", slider_1398);
-sliderAttachment_1399 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1399", slider_1399);
-sliderAttachment_1400 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1400", slider_1400);
-sliderAttachment_1401 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1401", slider_1401);
-sliderAttachment_1402 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1402", slider_1402);
-sliderAttachment_1403 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1403", slider_1403);
-sliderAttachment_1404 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1404", slider_1404);
-sliderAttachment_1405 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1405", slider_1405);
-sliderAttachment_1406 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1406", slider_1406);
-sliderAttachment_1407 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1407", slider_1407);
-sliderAttachment_1408 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1408", slider_1408);
-sliderAttachment_1409 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1409", slider_1409);
-sliderAttachment_1410 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1410", slider_1410);
-sliderAttachment_1411 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1411", slider_1411);
-sliderAttachment_1412 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1412", slider_1412);
-sliderAttachment_1413 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1413", slider_1413);
-sliderAttachment_1414 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1414", slider_1414);
-sliderAttachment_1415 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1415", slider_1415);
-sliderAttachment_1416 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1416", slider_1416);
-sliderAttachment_1417 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1417", slider_1417);
-sliderAttachment_1418 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1418", slider_1418);
-sliderAttachment_1419 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1419", slider_1419);
-sliderAttachment_1420 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1420", slider_1420);
-sliderAttachment_1421 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1421", slider_1421);
-sliderAttachment_1422 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1422", slider_1422);
-sliderAttachment_1423 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1423", slider_1423);
-sliderAttachment_1424 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1424", slider_1424);
-sliderAttachment_1425 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1425", slider_1425);
-sliderAttachment_1426 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1426", slider_1426);
-sliderAttachment_1427 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1427", slider_1427);
-sliderAttachment_1428 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1428", slider_1428);
-sliderAttachment_1429 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1429", slider_1429);
-sliderAttachment_1430 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1430", slider_1430);
-sliderAttachment_1431 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1431", slider_1431);
-sliderAttachment_1432 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1432", slider_1432);
-sliderAttachment_1433 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1433", slider_1433);
-sliderAttachment_1434 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1434", slider_1434);
-sliderAttachment_1435 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1435", slider_1435);
-sliderAttachment_1436 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1436", slider_1436);
-sliderAttachment_1437 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1437", slider_1437);
-sliderAttachment_1438 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1438", slider_1438);
-sliderAttachment_1439 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1439", slider_1439);
-sliderAttachment_1440 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1440", slider_1440);
-sliderAttachment_1441 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1441", slider_1441);
-sliderAttachment_1442 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1442", slider_1442);
-sliderAttachment_1443 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1443", slider_1443);
-sliderAttachment_1444 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1444", slider_1444);
-sliderAttachment_1445 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1445", slider_1445);
-sliderAttachment_1446 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1446", slider_1446);
-sliderAttachment_1447 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1447", slider_1447);
-sliderAttachment_1448 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1448", slider_1448);
-sliderAttachment_1449 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1449", slider_1449);
-sliderAttachment_1450 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1450", slider_1450);
-sliderAttachment_1451 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1451", slider_1451);
-sliderAttachment_1452 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1452", slider_1452);
-sliderAttachment_1453 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1453", slider_1453);
-sliderAttachment_1454 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1454", slider_1454);
-sliderAttachment_1455 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1455", slider_1455);
-sliderAttachment_1456 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1456", slider_1456);
-sliderAttachment_1457 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1457", slider_1457);
-sliderAttachment_1458 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1458", slider_1458);
-sliderAttachment_1459 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1459", slider_1459);
-sliderAttachment_1460 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1460", slider_1460);
-sliderAttachment_1461 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1461", slider_1461);
-sliderAttachment_1462 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1462", slider_1462);
-sliderAttachment_1463 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1463", slider_1463);
-sliderAttachment_1464 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1464", slider_1464);
-sliderAttachment_1465 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1465", slider_1465);
-sliderAttachment_1466 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1466", slider_1466);
-sliderAttachment_1467 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1467", slider_1467);
-sliderAttachment_1468 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1468", slider_1468);
-sliderAttachment_1469 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1469", slider_1469);
-sliderAttachment_1470 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1470", slider_1470);
-sliderAttachment_1471 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1471", slider_1471);
-sliderAttachment_1472 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1472", slider_1472);
-sliderAttachment_1473 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1473", slider_1473);
-sliderAttachment_1474 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1474", slider_1474);
-sliderAttachment_1475 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1475", slider_1475);
-sliderAttachment_1476 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1476", slider_1476);
-sliderAttachment_1477 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1477", slider_1477);
-sliderAttachment_1478 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1478", slider_1478);
-sliderAttachment_1479 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1479", slider_1479);
-sliderAttachment_1480 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1480", slider_1480);
-sliderAttachment_1481 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1481", slider_1481);
-sliderAttachment_1482 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1482", slider_1482);
-sliderAttachment_1483 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1483", slider_1483);
-sliderAttachment_1484 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1484", slider_1484);
-sliderAttachment_1485 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1485", slider_1485);
-sliderAttachment_1486 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1486", slider_1486);
-sliderAttachment_1487 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1487", slider_1487);
-sliderAttachment_1488 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1488", slider_1488);
-sliderAttachment_1489 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1489", slider_1489);
-sliderAttachment_1490 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1490", slider_1490);
-sliderAttachment_1491 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1491", slider_1491);
-sliderAttachment_1492 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1492", slider_1492);
-sliderAttachment_1493 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1493", slider_1493);
-sliderAttachment_1494 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1494", slider_1494);
-sliderAttachment_1495 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1495", slider_1495);
-sliderAttachment_1496 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1496", slider_1496);
-sliderAttachment_1497 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1497", slider_1497);
-sliderAttachment_1498 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1498", slider_1498);
-sliderAttachment_1499 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1499", slider_1499);
-sliderAttachment_1500 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1500", slider_1500);
-sliderAttachment_1501 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1501", slider_1501);
-sliderAttachment_1502 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1502", slider_1502);
-sliderAttachment_1503 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1503", slider_1503);
-sliderAttachment_1504 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1504", slider_1504);
-sliderAttachment_1505 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1505", slider_1505);
-sliderAttachment_1506 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1506", slider_1506);
-sliderAttachment_1507 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1507", slider_1507);
-sliderAttachment_1508 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1508", slider_1508);
-sliderAttachment_1509 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1509", slider_1509);
-sliderAttachment_1510 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1510", slider_1510);
-sliderAttachment_1511 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1511", slider_1511);
-sliderAttachment_1512 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1512", slider_1512);
-sliderAttachment_1513 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1513", slider_1513);
-sliderAttachment_1514 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1514", slider_1514);
-sliderAttachment_1515 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1515", slider_1515);
-sliderAttachment_1516 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1516", slider_1516);
-sliderAttachment_1517 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1517", slider_1517);
-sliderAttachment_1518 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1518", slider_1518);
-sliderAttachment_1519 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1519", slider_1519);
-sliderAttachment_1520 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1520", slider_1520);
-sliderAttachment_1521 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1521", slider_1521);
-sliderAttachment_1522 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1522", slider_1522);
-sliderAttachment_1523 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1523", slider_1523);
-sliderAttachment_1524 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1524", slider_1524);
-sliderAttachment_1525 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1525", slider_1525);
-sliderAttachment_1526 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1526", slider_1526);
-sliderAttachment_1527 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1527", slider_1527);
-sliderAttachment_1528 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1528", slider_1528);
-sliderAttachment_1529 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1529", slider_1529);
-sliderAttachment_1530 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1530", slider_1530);
-sliderAttachment_1531 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1531", slider_1531);
-sliderAttachment_1532 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1532", slider_1532);
-sliderAttachment_1533 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1533", slider_1533);
-sliderAttachment_1534 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1534", slider_1534);
-sliderAttachment_1535 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1535", slider_1535);
-sliderAttachment_1536 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1536", slider_1536);
-sliderAttachment_1537 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1537", slider_1537);
-sliderAttachment_1538 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1538", slider_1538);
-sliderAttachment_1539 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1539", slider_1539);
-sliderAttachment_1540 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1540", slider_1540);
-sliderAttachment_1541 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1541", slider_1541);
-sliderAttachment_1542 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1542", slider_1542);
-sliderAttachment_1543 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1543", slider_1543);
-sliderAttachment_1544 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1544", slider_1544);
-sliderAttachment_1545 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1545", slider_1545);
-sliderAttachment_1546 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1546", slider_1546);
-sliderAttachment_1547 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1547", slider_1547);
-sliderAttachment_1548 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1548", slider_1548);
-sliderAttachment_1549 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1549", slider_1549);
-sliderAttachment_1550 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1550", slider_1550);
-sliderAttachment_1551 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1551", slider_1551);
-sliderAttachment_1552 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1552", slider_1552);
-sliderAttachment_1553 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1553", slider_1553);
-sliderAttachment_1554 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1554", slider_1554);
-sliderAttachment_1555 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1555", slider_1555);
-sliderAttachment_1556 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1556", slider_1556);
-sliderAttachment_1557 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1557", slider_1557);
-sliderAttachment_1558 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1558", slider_1558);
-sliderAttachment_1559 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1559", slider_1559);
-sliderAttachment_1560 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1560", slider_1560);
-sliderAttachment_1561 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1561", slider_1561);
-sliderAttachment_1562 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1562", slider_1562);
-sliderAttachment_1563 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1563", slider_1563);
-sliderAttachment_1564 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1564", slider_1564);
-sliderAttachment_1565 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1565", slider_1565);
-sliderAttachment_1566 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1566", slider_1566);
-sliderAttachment_1567 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1567", slider_1567);
-sliderAttachment_1568 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1568", slider_1568);
-sliderAttachment_1569 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1569", slider_1569);
-sliderAttachment_1570 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1570", slider_1570);
-sliderAttachment_1571 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1571", slider_1571);
-sliderAttachment_1572 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1572", slider_1572);
-sliderAttachment_1573 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1573", slider_1573);
-sliderAttachment_1574 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1574", slider_1574);
-sliderAttachment_1575 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1575", slider_1575);
-sliderAttachment_1576 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1576", slider_1576);
-sliderAttachment_1577 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1577", slider_1577);
-sliderAttachment_1578 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1578", slider_1578);
-sliderAttachment_1579 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1579", slider_1579);
-sliderAttachment_1580 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1580", slider_1580);
-sliderAttachment_1581 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1581", slider_1581);
-sliderAttachment_1582 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1582", slider_1582);
-sliderAttachment_1583 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1583", slider_1583);
-sliderAttachment_1584 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1584", slider_1584);
-sliderAttachment_1585 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1585", slider_1585);
-sliderAttachment_1586 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1586", slider_1586);
-sliderAttachment_1587 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1587", slider_1587);
-sliderAttachment_1588 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1588", slider_1588);
-sliderAttachment_1589 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1589", slider_1589);
-sliderAttachment_1590 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1590", slider_1590);
-sliderAttachment_1591 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1591", slider_1591);
-sliderAttachment_1592 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1592", slider_1592);
-sliderAttachment_1593 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1593", slider_1593);
-sliderAttachment_1594 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1594", slider_1594);
-sliderAttachment_1595 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1595", slider_1595);
-sliderAttachment_1596 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1596", slider_1596);
-sliderAttachment_1597 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1597", slider_1597);
-sliderAttachment_1598 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1598", slider_1598);
-sliderAttachment_1599 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1599", slider_1599);
-sliderAttachment_1600 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1600", slider_1600);
-sliderAttachment_1601 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1601", slider_1601);
-sliderAttachment_1602 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1602", slider_1602);
-sliderAttachment_1603 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1603", slider_1603);
-sliderAttachment_1604 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1604", slider_1604);
-sliderAttachment_1605 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1605", slider_1605);
-sliderAttachment_1606 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1606", slider_1606);
-sliderAttachment_1607 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1607", slider_1607);
-sliderAttachment_1608 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1608", slider_1608);
-sliderAttachment_1609 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1609", slider_1609);
-sliderAttachment_1610 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1610", slider_1610);
-sliderAttachment_1611 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1611", slider_1611);
-sliderAttachment_1612 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1612", slider_1612);
-sliderAttachment_1613 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1613", slider_1613);
-sliderAttachment_1614 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1614", slider_1614);
-sliderAttachment_1615 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1615", slider_1615);
-sliderAttachment_1616 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1616", slider_1616);
-sliderAttachment_1617 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1617", slider_1617);
-sliderAttachment_1618 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1618", slider_1618);
-sliderAttachment_1619 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1619", slider_1619);
-sliderAttachment_1620 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1620", slider_1620);
-sliderAttachment_1621 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1621", slider_1621);
-sliderAttachment_1622 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1622", slider_1622);
-sliderAttachment_1623 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1623", slider_1623);
-sliderAttachment_1624 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1624", slider_1624);
-sliderAttachment_1625 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1625", slider_1625);
-sliderAttachment_1626 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1626", slider_1626);
-sliderAttachment_1627 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1627", slider_1627);
-sliderAttachment_1628 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1628", slider_1628);
-sliderAttachment_1629 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1629", slider_1629);
-sliderAttachment_1630 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1630", slider_1630);
-sliderAttachment_1631 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1631", slider_1631);
-sliderAttachment_1632 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1632", slider_1632);
-sliderAttachment_1633 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1633", slider_1633);
-sliderAttachment_1634 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1634", slider_1634);
-sliderAttachment_1635 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1635", slider_1635);
-sliderAttachment_1636 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1636", slider_1636);
-sliderAttachment_1637 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1637", slider_1637);
-sliderAttachment_1638 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1638", slider_1638);
-sliderAttachment_1639 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1639", slider_1639);
-sliderAttachment_1640 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1640", slider_1640);
-sliderAttachment_1641 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1641", slider_1641);
-sliderAttachment_1642 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1642", slider_1642);
-sliderAttachment_1643 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1643", slider_1643);
-sliderAttachment_1644 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1644", slider_1644);
-sliderAttachment_1645 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1645", slider_1645);
-sliderAttachment_1646 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1646", slider_1646);
-sliderAttachment_1647 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1647", slider_1647);
-sliderAttachment_1648 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1648", slider_1648);
-sliderAttachment_1649 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1649", slider_1649);
-sliderAttachment_1650 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1650", slider_1650);
-sliderAttachment_1651 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1651", slider_1651);
-sliderAttachment_1652 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1652", slider_1652);
-sliderAttachment_1653 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1653", slider_1653);
-sliderAttachment_1654 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1654", slider_1654);
-sliderAttachment_1655 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1655", slider_1655);
-sliderAttachment_1656 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1656", slider_1656);
-sliderAttachment_1657 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1657", slider_1657);
-sliderAttachment_1658 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1658", slider_1658);
-sliderAttachment_1659 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1659", slider_1659);
-sliderAttachment_1660 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1660", slider_1660);
-sliderAttachment_1661 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1661", slider_1661);
-sliderAttachment_1662 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1662", slider_1662);
-sliderAttachment_1663 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1663", slider_1663);
-sliderAttachment_1664 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1664", slider_1664);
-sliderAttachment_1665 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1665", slider_1665);
-sliderAttachment_1666 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1666", slider_1666);
-sliderAttachment_1667 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1667", slider_1667);
-sliderAttachment_1668 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1668", slider_1668);
-sliderAttachment_1669 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1669", slider_1669);
-sliderAttachment_1670 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1670", slider_1670);
-sliderAttachment_1671 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1671", slider_1671);
-sliderAttachment_1672 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1672", slider_1672);
-sliderAttachment_1673 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1673", slider_1673);
-sliderAttachment_1674 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1674", slider_1674);
-sliderAttachment_1675 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1675", slider_1675);
-sliderAttachment_1676 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1676", slider_1676);
-sliderAttachment_1677 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1677", slider_1677);
-sliderAttachment_1678 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1678", slider_1678);
-sliderAttachment_1679 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1679", slider_1679);
-sliderAttachment_1680 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1680", slider_1680);
-sliderAttachment_1681 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1681", slider_1681);
-sliderAttachment_1682 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1682", slider_1682);
-sliderAttachment_1683 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1683", slider_1683);
-sliderAttachment_1684 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1684", slider_1684);
-sliderAttachment_1685 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1685", slider_1685);
-sliderAttachment_1686 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1686", slider_1686);
-sliderAttachment_1687 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1687", slider_1687);
-sliderAttachment_1688 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1688", slider_1688);
-sliderAttachment_1689 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1689", slider_1689);
-sliderAttachment_1690 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1690", slider_1690);
-sliderAttachment_1691 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1691", slider_1691);
-sliderAttachment_1692 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1692", slider_1692);
-sliderAttachment_1693 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1693", slider_1693);
-sliderAttachment_1694 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1694", slider_1694);
-sliderAttachment_1695 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1695", slider_1695);
-sliderAttachment_1696 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1696", slider_1696);
-sliderAttachment_1697 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1697", slider_1697);
-sliderAttachment_1698 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1698", slider_1698);
-sliderAttachment_1699 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1699", slider_1699);
-sliderAttachment_1700 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1700", slider_1700);
-sliderAttachment_1701 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1701", slider_1701);
-sliderAttachment_1702 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1702", slider_1702);
-sliderAttachment_1703 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1703", slider_1703);
-sliderAttachment_1704 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1704", slider_1704);
-sliderAttachment_1705 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1705", slider_1705);
-sliderAttachment_1706 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1706", slider_1706);
-sliderAttachment_1707 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1707", slider_1707);
-sliderAttachment_1708 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1708", slider_1708);
-sliderAttachment_1709 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1709", slider_1709);
-sliderAttachment_1710 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1710", slider_1710);
-sliderAttachment_1711 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1711", slider_1711);
-sliderAttachment_1712 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1712", slider_1712);
-sliderAttachment_1713 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1713", slider_1713);
-sliderAttachment_1714 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1714", slider_1714);
-sliderAttachment_1715 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1715", slider_1715);
-sliderAttachment_1716 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1716", slider_1716);
-sliderAttachment_1717 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1717", slider_1717);
-sliderAttachment_1718 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1718", slider_1718);
-sliderAttachment_1719 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1719", slider_1719);
-sliderAttachment_1720 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1720", slider_1720);
-sliderAttachment_1721 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1721", slider_1721);
-sliderAttachment_1722 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1722", slider_1722);
-sliderAttachment_1723 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1723", slider_1723);
-sliderAttachment_1724 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1724", slider_1724);
-sliderAttachment_1725 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1725", slider_1725);
-sliderAttachment_1726 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1726", slider_1726);
-sliderAttachment_1727 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1727", slider_1727);
-sliderAttachment_1728 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1728", slider_1728);
-sliderAttachment_1729 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1729", slider_1729);
-sliderAttachment_1730 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1730", slider_1730);
-sliderAttachment_1731 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1731", slider_1731);
-sliderAttachment_1732 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1732", slider_1732);
-sliderAttachment_1733 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1733", slider_1733);
-sliderAttachment_1734 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1734", slider_1734);
-sliderAttachment_1735 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1735", slider_1735);
-sliderAttachment_1736 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1736", slider_1736);
-sliderAttachment_1737 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1737", slider_1737);
-sliderAttachment_1738 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1738", slider_1738);
-sliderAttachment_1739 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1739", slider_1739);
-sliderAttachment_1740 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1740", slider_1740);
-sliderAttachment_1741 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1741", slider_1741);
-sliderAttachment_1742 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1742", slider_1742);
-sliderAttachment_1743 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1743", slider_1743);
-sliderAttachment_1744 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1744", slider_1744);
-sliderAttachment_1745 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1745", slider_1745);
-sliderAttachment_1746 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1746", slider_1746);
-sliderAttachment_1747 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1747", slider_1747);
-sliderAttachment_1748 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1748", slider_1748);
-sliderAttachment_1749 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1749", slider_1749);
-sliderAttachment_1750 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1750", slider_1750);
-sliderAttachment_1751 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1751", slider_1751);
-sliderAttachment_1752 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1752", slider_1752);
-sliderAttachment_1753 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1753", slider_1753);
-sliderAttachment_1754 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1754", slider_1754);
-sliderAttachment_1755 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1755", slider_1755);
-sliderAttachment_1756 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1756", slider_1756);
-sliderAttachment_1757 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1757", slider_1757);
-sliderAttachment_1758 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1758", slider_1758);
-sliderAttachment_1759 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1759", slider_1759);
-sliderAttachment_1760 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1760", slider_1760);
-sliderAttachment_1761 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1761", slider_1761);
-sliderAttachment_1762 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1762", slider_1762);
-sliderAttachment_1763 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1763", slider_1763);
-sliderAttachment_1764 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1764", slider_1764);
-sliderAttachment_1765 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1765", slider_1765);
-sliderAttachment_1766 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1766", slider_1766);
-sliderAttachment_1767 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1767", slider_1767);
-sliderAttachment_1768 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1768", slider_1768);
-sliderAttachment_1769 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1769", slider_1769);
-sliderAttachment_1770 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1770", slider_1770);
-sliderAttachment_1771 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1771", slider_1771);
-sliderAttachment_1772 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1772", slider_1772);
-sliderAttachment_1773 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1773", slider_1773);
-sliderAttachment_1774 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1774", slider_1774);
-sliderAttachment_1775 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1775", slider_1775);
-sliderAttachment_1776 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1776", slider_1776);
-sliderAttachment_1777 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1777", slider_1777);
-sliderAttachment_1778 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1778", slider_1778);
-sliderAttachment_1779 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1779", slider_1779);
-sliderAttachment_1780 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1780", slider_1780);
-sliderAttachment_1781 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1781", slider_1781);
-sliderAttachment_1782 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1782", slider_1782);
-sliderAttachment_1783 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1783", slider_1783);
-sliderAttachment_1784 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1784", slider_1784);
-sliderAttachment_1785 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1785", slider_1785);
-sliderAttachment_1786 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1786", slider_1786);
-sliderAttachment_1787 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1787", slider_1787);
-sliderAttachment_1788 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1788", slider_1788);
-sliderAttachment_1789 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1789", slider_1789);
-sliderAttachment_1790 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1790", slider_1790);
-sliderAttachment_1791 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1791", slider_1791);
-sliderAttachment_1792 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1792", slider_1792);
-sliderAttachment_1793 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1793", slider_1793);
-sliderAttachment_1794 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1794", slider_1794);
-sliderAttachment_1795 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1795", slider_1795);
-sliderAttachment_1796 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1796", slider_1796);
-sliderAttachment_1797 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1797", slider_1797);
-sliderAttachment_1798 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1798", slider_1798);
-sliderAttachment_1799 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1799", slider_1799);
-sliderAttachment_1800 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1800", slider_1800);
-sliderAttachment_1801 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1801", slider_1801);
-sliderAttachment_1802 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1802", slider_1802);
-sliderAttachment_1803 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1803", slider_1803);
-sliderAttachment_1804 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1804", slider_1804);
-sliderAttachment_1805 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1805", slider_1805);
-sliderAttachment_1806 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1806", slider_1806);
-sliderAttachment_1807 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1807", slider_1807);
-sliderAttachment_1808 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1808", slider_1808);
-sliderAttachment_1809 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1809", slider_1809);
-sliderAttachment_1810 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1810", slider_1810);
-sliderAttachment_1811 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1811", slider_1811);
-sliderAttachment_1812 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1812", slider_1812);
-sliderAttachment_1813 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1813", slider_1813);
-sliderAttachment_1814 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1814", slider_1814);
-sliderAttachment_1815 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1815", slider_1815);
-sliderAttachment_1816 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1816", slider_1816);
-sliderAttachment_1817 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1817", slider_1817);
-sliderAttachment_1818 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1818", slider_1818);
-sliderAttachment_1819 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1819", slider_1819);
-sliderAttachment_1820 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1820", slider_1820);
-sliderAttachment_1821 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1821", slider_1821);
-sliderAttachment_1822 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1822", slider_1822);
-sliderAttachment_1823 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1823", slider_1823);
-sliderAttachment_1824 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1824", slider_1824);
-sliderAttachment_1825 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1825", slider_1825);
-sliderAttachment_1826 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1826", slider_1826);
-sliderAttachment_1827 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1827", slider_1827);
-sliderAttachment_1828 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1828", slider_1828);
-sliderAttachment_1829 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1829", slider_1829);
-sliderAttachment_1830 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1830", slider_1830);
-sliderAttachment_1831 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1831", slider_1831);
-sliderAttachment_1832 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1832", slider_1832);
-sliderAttachment_1833 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1833", slider_1833);
-sliderAttachment_1834 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1834", slider_1834);
-sliderAttachment_1835 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1835", slider_1835);
-sliderAttachment_1836 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1836", slider_1836);
-sliderAttachment_1837 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1837", slider_1837);
-sliderAttachment_1838 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1838", slider_1838);
-sliderAttachment_1839 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1839", slider_1839);
-sliderAttachment_1840 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1840", slider_1840);
-sliderAttachment_1841 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1841", slider_1841);
-sliderAttachment_1842 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1842", slider_1842);
-sliderAttachment_1843 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1843", slider_1843);
-sliderAttachment_1844 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1844", slider_1844);
-sliderAttachment_1845 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1845", slider_1845);
-sliderAttachment_1846 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1846", slider_1846);
-sliderAttachment_1847 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1847", slider_1847);
-sliderAttachment_1848 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1848", slider_1848);
-sliderAttachment_1849 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1849", slider_1849);
-sliderAttachment_1850 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1850", slider_1850);
-sliderAttachment_1851 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1851", slider_1851);
-sliderAttachment_1852 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1852", slider_1852);
-sliderAttachment_1853 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1853", slider_1853);
-sliderAttachment_1854 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1854", slider_1854);
-sliderAttachment_1855 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1855", slider_1855);
-sliderAttachment_1856 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1856", slider_1856);
-sliderAttachment_1857 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1857", slider_1857);
-sliderAttachment_1858 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1858", slider_1858);
-sliderAttachment_1859 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1859", slider_1859);
-sliderAttachment_1860 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1860", slider_1860);
-sliderAttachment_1861 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1861", slider_1861);
-sliderAttachment_1862 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1862", slider_1862);
-sliderAttachment_1863 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1863", slider_1863);
-sliderAttachment_1864 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1864", slider_1864);
-sliderAttachment_1865 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1865", slider_1865);
-sliderAttachment_1866 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1866", slider_1866);
-sliderAttachment_1867 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1867", slider_1867);
-sliderAttachment_1868 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1868", slider_1868);
-sliderAttachment_1869 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1869", slider_1869);
-sliderAttachment_1870 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1870", slider_1870);
-sliderAttachment_1871 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1871", slider_1871);
-sliderAttachment_1872 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1872", slider_1872);
-sliderAttachment_1873 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1873", slider_1873);
-sliderAttachment_1874 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1874", slider_1874);
-sliderAttachment_1875 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1875", slider_1875);
-sliderAttachment_1876 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1876", slider_1876);
-sliderAttachment_1877 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1877", slider_1877);
-sliderAttachment_1878 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1878", slider_1878);
-sliderAttachment_1879 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1879", slider_1879);
-sliderAttachment_1880 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1880", slider_1880);
-sliderAttachment_1881 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1881", slider_1881);
-sliderAttachment_1882 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1882", slider_1882);
-sliderAttachment_1883 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1883", slider_1883);
-sliderAttachment_1884 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1884", slider_1884);
-sliderAttachment_1885 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1885", slider_1885);
-sliderAttachment_1886 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1886", slider_1886);
-sliderAttachment_1887 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1887", slider_1887);
-sliderAttachment_1888 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1888", slider_1888);
-sliderAttachment_1889 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1889", slider_1889);
-sliderAttachment_1890 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1890", slider_1890);
-sliderAttachment_1891 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1891", slider_1891);
-sliderAttachment_1892 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1892", slider_1892);
-sliderAttachment_1893 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1893", slider_1893);
-sliderAttachment_1894 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1894", slider_1894);
-sliderAttachment_1895 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1895", slider_1895);
-sliderAttachment_1896 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1896", slider_1896);
-sliderAttachment_1897 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1897", slider_1897);
-sliderAttachment_1898 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1898", slider_1898);
-sliderAttachment_1899 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1899", slider_1899);
-sliderAttachment_1900 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1900", slider_1900);
-sliderAttachment_1901 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1901", slider_1901);
-sliderAttachment_1902 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1902", slider_1902);
-sliderAttachment_1903 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1903", slider_1903);
-sliderAttachment_1904 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1904", slider_1904);
-sliderAttachment_1905 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1905", slider_1905);
-sliderAttachment_1906 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1906", slider_1906);
-sliderAttachment_1907 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1907", slider_1907);
-sliderAttachment_1908 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1908", slider_1908);
-sliderAttachment_1909 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1909", slider_1909);
-sliderAttachment_1910 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1910", slider_1910);
-sliderAttachment_1911 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1911", slider_1911);
-sliderAttachment_1912 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1912", slider_1912);
-sliderAttachment_1913 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1913", slider_1913);
-sliderAttachment_1914 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1914", slider_1914);
-sliderAttachment_1915 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1915", slider_1915);
-sliderAttachment_1916 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1916", slider_1916);
-sliderAttachment_1917 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1917", slider_1917);
-sliderAttachment_1918 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1918", slider_1918);
-sliderAttachment_1919 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1919", slider_1919);
-sliderAttachment_1920 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1920", slider_1920);
-sliderAttachment_1921 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1921", slider_1921);
-sliderAttachment_1922 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1922", slider_1922);
-sliderAttachment_1923 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1923", slider_1923);
-sliderAttachment_1924 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1924", slider_1924);
-sliderAttachment_1925 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1925", slider_1925);
-sliderAttachment_1926 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1926", slider_1926);
-sliderAttachment_1927 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1927", slider_1927);
-sliderAttachment_1928 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1928", slider_1928);
-sliderAttachment_1929 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1929", slider_1929);
-sliderAttachment_1930 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1930", slider_1930);
-sliderAttachment_1931 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1931", slider_1931);
-sliderAttachment_1932 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1932", slider_1932);
-sliderAttachment_1933 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1933", slider_1933);
-sliderAttachment_1934 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1934", slider_1934);
-sliderAttachment_1935 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1935", slider_1935);
-sliderAttachment_1936 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1936", slider_1936);
-sliderAttachment_1937 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1937", slider_1937);
-sliderAttachment_1938 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1938", slider_1938);
-sliderAttachment_1939 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1939", slider_1939);
-sliderAttachment_1940 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1940", slider_1940);
-sliderAttachment_1941 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1941", slider_1941);
-sliderAttachment_1942 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1942", slider_1942);
-sliderAttachment_1943 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1943", slider_1943);
-sliderAttachment_1944 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1944", slider_1944);
-sliderAttachment_1945 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1945", slider_1945);
-sliderAttachment_1946 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1946", slider_1946);
-sliderAttachment_1947 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1947", slider_1947);
-sliderAttachment_1948 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1948", slider_1948);
-sliderAttachment_1949 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1949", slider_1949);
-sliderAttachment_1950 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1950", slider_1950);
-sliderAttachment_1951 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1951", slider_1951);
-sliderAttachment_1952 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1952", slider_1952);
-sliderAttachment_1953 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1953", slider_1953);
-sliderAttachment_1954 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1954", slider_1954);
-sliderAttachment_1955 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1955", slider_1955);
-sliderAttachment_1956 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1956", slider_1956);
-sliderAttachment_1957 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1957", slider_1957);
-sliderAttachment_1958 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1958", slider_1958);
-sliderAttachment_1959 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1959", slider_1959);
-sliderAttachment_1960 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1960", slider_1960);
-sliderAttachment_1961 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1961", slider_1961);
-sliderAttachment_1962 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1962", slider_1962);
-sliderAttachment_1963 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1963", slider_1963);
-sliderAttachment_1964 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1964", slider_1964);
-sliderAttachment_1965 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1965", slider_1965);
-sliderAttachment_1966 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1966", slider_1966);
-sliderAttachment_1967 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1967", slider_1967);
-sliderAttachment_1968 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1968", slider_1968);
-sliderAttachment_1969 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1969", slider_1969);
-sliderAttachment_1970 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1970", slider_1970);
-sliderAttachment_1971 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1971", slider_1971);
-sliderAttachment_1972 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1972", slider_1972);
-sliderAttachment_1973 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1973", slider_1973);
-sliderAttachment_1974 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1974", slider_1974);
-sliderAttachment_1975 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1975", slider_1975);
-sliderAttachment_1976 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1976", slider_1976);
-sliderAttachment_1977 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1977", slider_1977);
-sliderAttachment_1978 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1978", slider_1978);
-sliderAttachment_1979 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1979", slider_1979);
-sliderAttachment_1980 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1980", slider_1980);
-sliderAttachment_1981 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1981", slider_1981);
-sliderAttachment_1982 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1982", slider_1982);
-sliderAttachment_1983 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1983", slider_1983);
-sliderAttachment_1984 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1984", slider_1984);
-sliderAttachment_1985 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1985", slider_1985);
-sliderAttachment_1986 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1986", slider_1986);
-sliderAttachment_1987 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1987", slider_1987);
-sliderAttachment_1988 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1988", slider_1988);
-sliderAttachment_1989 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1989", slider_1989);
-sliderAttachment_1990 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1990", slider_1990);
-sliderAttachment_1991 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1991", slider_1991);
-sliderAttachment_1992 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1992", slider_1992);
-sliderAttachment_1993 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1993", slider_1993);
-sliderAttachment_1994 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1994", slider_1994);
-sliderAttachment_1995 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1995", slider_1995);
-sliderAttachment_1996 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1996", slider_1996);
-sliderAttachment_1997 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1997", slider_1997);
-sliderAttachment_1998 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1998", slider_1998);
-sliderAttachment_1999 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "1999", slider_1999);
-sliderAttachment_2000 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2000", slider_2000);
-sliderAttachment_2001 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2001", slider_2001);
-sliderAttachment_2002 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2002", slider_2002);
-sliderAttachment_2003 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2003", slider_2003);
-sliderAttachment_2004 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2004", slider_2004);
-sliderAttachment_2005 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2005", slider_2005);
-sliderAttachment_2006 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2006", slider_2006);
-sliderAttachment_2007 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2007", slider_2007);
-sliderAttachment_2008 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2008", slider_2008);
-sliderAttachment_2009 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2009", slider_2009);
-sliderAttachment_2010 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2010", slider_2010);
-sliderAttachment_2011 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2011", slider_2011);
-sliderAttachment_2012 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2012", slider_2012);
-sliderAttachment_2013 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2013", slider_2013);
-sliderAttachment_2014 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2014", slider_2014);
-sliderAttachment_2015 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2015", slider_2015);
-sliderAttachment_2016 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2016", slider_2016);
-sliderAttachment_2017 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2017", slider_2017);
-sliderAttachment_2018 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2018", slider_2018);
-sliderAttachment_2019 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2019", slider_2019);
-sliderAttachment_2020 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2020", slider_2020);
-sliderAttachment_2021 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2021", slider_2021);
-sliderAttachment_2022 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2022", slider_2022);
-sliderAttachment_2023 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2023", slider_2023);
-sliderAttachment_2024 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2024", slider_2024);
-sliderAttachment_2025 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2025", slider_2025);
-sliderAttachment_2026 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2026", slider_2026);
-sliderAttachment_2027 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2027", slider_2027);
-sliderAttachment_2028 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2028", slider_2028);
-sliderAttachment_2029 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2029", slider_2029);
-sliderAttachment_2030 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2030", slider_2030);
-sliderAttachment_2031 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2031", slider_2031);
-sliderAttachment_2032 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2032", slider_2032);
-sliderAttachment_2033 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2033", slider_2033);
-sliderAttachment_2034 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2034", slider_2034);
-sliderAttachment_2035 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2035", slider_2035);
-sliderAttachment_2036 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2036", slider_2036);
-sliderAttachment_2037 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2037", slider_2037);
-sliderAttachment_2038 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2038", slider_2038);
-sliderAttachment_2039 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2039", slider_2039);
-sliderAttachment_2040 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2040", slider_2040);
-sliderAttachment_2041 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2041", slider_2041);
-sliderAttachment_2042 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2042", slider_2042);
-sliderAttachment_2043 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2043", slider_2043);
-sliderAttachment_2044 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2044", slider_2044);
-sliderAttachment_2045 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2045", slider_2045);
-sliderAttachment_2046 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2046", slider_2046);
-sliderAttachment_2047 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2047", slider_2047);
-sliderAttachment_2048 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2048", slider_2048);
-sliderAttachment_2049 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2049", slider_2049);
-sliderAttachment_2050 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2050", slider_2050);
-sliderAttachment_2051 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2051", slider_2051);
-sliderAttachment_2052 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2052", slider_2052);
-sliderAttachment_2053 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2053", slider_2053);
-sliderAttachment_2054 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2054", slider_2054);
-sliderAttachment_2055 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2055", slider_2055);
-sliderAttachment_2056 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2056", slider_2056);
-sliderAttachment_2057 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2057", slider_2057);
-sliderAttachment_2058 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2058", slider_2058);
-sliderAttachment_2059 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2059", slider_2059);
-sliderAttachment_2060 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2060", slider_2060);
-sliderAttachment_2061 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2061", slider_2061);
-sliderAttachment_2062 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2062", slider_2062);
-sliderAttachment_2063 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2063", slider_2063);
-sliderAttachment_2064 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2064", slider_2064);
-sliderAttachment_2065 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2065", slider_2065);
-sliderAttachment_2066 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2066", slider_2066);
-sliderAttachment_2067 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2067", slider_2067);
-sliderAttachment_2068 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2068", slider_2068);
-sliderAttachment_2069 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2069", slider_2069);
-sliderAttachment_2070 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2070", slider_2070);
-sliderAttachment_2071 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2071", slider_2071);
-sliderAttachment_2072 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2072", slider_2072);
-sliderAttachment_2073 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2073", slider_2073);
-sliderAttachment_2074 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2074", slider_2074);
-sliderAttachment_2075 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2075", slider_2075);
-sliderAttachment_2076 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2076", slider_2076);
-sliderAttachment_2077 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2077", slider_2077);
-sliderAttachment_2078 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2078", slider_2078);
-sliderAttachment_2079 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2079", slider_2079);
-sliderAttachment_2080 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2080", slider_2080);
-sliderAttachment_2081 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2081", slider_2081);
-sliderAttachment_2082 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2082", slider_2082);
-sliderAttachment_2083 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2083", slider_2083);
-sliderAttachment_2084 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2084", slider_2084);
-sliderAttachment_2085 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2085", slider_2085);
-sliderAttachment_2086 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2086", slider_2086);
-sliderAttachment_2087 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2087", slider_2087);
-sliderAttachment_2088 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2088", slider_2088);
-sliderAttachment_2089 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2089", slider_2089);
-sliderAttachment_2090 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2090", slider_2090);
-sliderAttachment_2091 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2091", slider_2091);
-sliderAttachment_2092 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2092", slider_2092);
-sliderAttachment_2093 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2093", slider_2093);
-sliderAttachment_2094 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2094", slider_2094);
-sliderAttachment_2095 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2095", slider_2095);
-sliderAttachment_2096 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2096", slider_2096);
-sliderAttachment_2097 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2097", slider_2097);
-sliderAttachment_2098 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2098", slider_2098);
-sliderAttachment_2099 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2099", slider_2099);
-sliderAttachment_2100 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2100", slider_2100);
-sliderAttachment_2101 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2101", slider_2101);
-sliderAttachment_2102 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2102", slider_2102);
-sliderAttachment_2103 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2103", slider_2103);
-sliderAttachment_2104 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2104", slider_2104);
-sliderAttachment_2105 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2105", slider_2105);
-sliderAttachment_2106 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2106", slider_2106);
-sliderAttachment_2107 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2107", slider_2107);
-sliderAttachment_2108 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2108", slider_2108);
-sliderAttachment_2109 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2109", slider_2109);
-sliderAttachment_2110 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2110", slider_2110);
-sliderAttachment_2111 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2111", slider_2111);
-sliderAttachment_2112 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2112", slider_2112);
-sliderAttachment_2113 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2113", slider_2113);
-sliderAttachment_2114 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2114", slider_2114);
-sliderAttachment_2115 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2115", slider_2115);
-sliderAttachment_2116 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2116", slider_2116);
-sliderAttachment_2117 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2117", slider_2117);
-sliderAttachment_2118 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2118", slider_2118);
-sliderAttachment_2119 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2119", slider_2119);
-sliderAttachment_2120 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2120", slider_2120);
-sliderAttachment_2121 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2121", slider_2121);
-sliderAttachment_2122 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2122", slider_2122);
-sliderAttachment_2123 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2123", slider_2123);
-sliderAttachment_2124 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2124", slider_2124);
-sliderAttachment_2125 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2125", slider_2125);
-sliderAttachment_2126 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2126", slider_2126);
-sliderAttachment_2127 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2127", slider_2127);
-sliderAttachment_2128 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2128", slider_2128);
-sliderAttachment_2129 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2129", slider_2129);
-sliderAttachment_2130 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2130", slider_2130);
-sliderAttachment_2131 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2131", slider_2131);
-sliderAttachment_2132 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2132", slider_2132);
-sliderAttachment_2133 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2133", slider_2133);
-sliderAttachment_2134 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2134", slider_2134);
-sliderAttachment_2135 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2135", slider_2135);
-sliderAttachment_2136 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2136", slider_2136);
-sliderAttachment_2137 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2137", slider_2137);
-sliderAttachment_2138 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2138", slider_2138);
-sliderAttachment_2139 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2139", slider_2139);
-sliderAttachment_2140 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2140", slider_2140);
-sliderAttachment_2141 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2141", slider_2141);
-sliderAttachment_2142 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2142", slider_2142);
-sliderAttachment_2143 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2143", slider_2143);
-sliderAttachment_2144 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2144", slider_2144);
-sliderAttachment_2145 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2145", slider_2145);
-sliderAttachment_2146 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2146", slider_2146);
-sliderAttachment_2147 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2147", slider_2147);
-sliderAttachment_2148 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2148", slider_2148);
-sliderAttachment_2149 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2149", slider_2149);
-sliderAttachment_2150 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2150", slider_2150);
-sliderAttachment_2151 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2151", slider_2151);
-sliderAttachment_2152 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2152", slider_2152);
-sliderAttachment_2153 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2153", slider_2153);
-sliderAttachment_2154 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2154", slider_2154);
-sliderAttachment_2155 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2155", slider_2155);
-sliderAttachment_2156 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2156", slider_2156);
-sliderAttachment_2157 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2157", slider_2157);
-sliderAttachment_2158 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2158", slider_2158);
-sliderAttachment_2159 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2159", slider_2159);
-sliderAttachment_2160 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2160", slider_2160);
-sliderAttachment_2161 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2161", slider_2161);
-sliderAttachment_2162 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2162", slider_2162);
-sliderAttachment_2163 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2163", slider_2163);
-sliderAttachment_2164 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2164", slider_2164);
-sliderAttachment_2165 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2165", slider_2165);
-sliderAttachment_2166 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2166", slider_2166);
-sliderAttachment_2167 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2167", slider_2167);
-sliderAttachment_2168 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2168", slider_2168);
-sliderAttachment_2169 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2169", slider_2169);
-sliderAttachment_2170 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2170", slider_2170);
-sliderAttachment_2171 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2171", slider_2171);
-sliderAttachment_2172 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2172", slider_2172);
-sliderAttachment_2173 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2173", slider_2173);
-sliderAttachment_2174 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2174", slider_2174);
-sliderAttachment_2175 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2175", slider_2175);
-sliderAttachment_2176 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2176", slider_2176);
-sliderAttachment_2177 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2177", slider_2177);
-sliderAttachment_2178 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2178", slider_2178);
-sliderAttachment_2179 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2179", slider_2179);
-sliderAttachment_2180 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2180", slider_2180);
-sliderAttachment_2181 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2181", slider_2181);
-sliderAttachment_2182 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2182", slider_2182);
-sliderAttachment_2183 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2183", slider_2183);
-sliderAttachment_2184 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2184", slider_2184);
-sliderAttachment_2185 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2185", slider_2185);
-sliderAttachment_2186 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2186", slider_2186);
-sliderAttachment_2187 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2187", slider_2187);
-sliderAttachment_2188 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2188", slider_2188);
-sliderAttachment_2189 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2189", slider_2189);
-sliderAttachment_2190 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2190", slider_2190);
-sliderAttachment_2191 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2191", slider_2191);
-sliderAttachment_2192 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2192", slider_2192);
-sliderAttachment_2193 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2193", slider_2193);
-sliderAttachment_2194 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2194", slider_2194);
-sliderAttachment_2195 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2195", slider_2195);
-sliderAttachment_2196 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2196", slider_2196);
-sliderAttachment_2197 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2197", slider_2197);
-sliderAttachment_2198 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2198", slider_2198);
-sliderAttachment_2199 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2199", slider_2199);
-sliderAttachment_2200 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2200", slider_2200);
-sliderAttachment_2201 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2201", slider_2201);
-sliderAttachment_2202 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2202", slider_2202);
-sliderAttachment_2203 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2203", slider_2203);
-sliderAttachment_2204 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2204", slider_2204);
-sliderAttachment_2205 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2205", slider_2205);
-sliderAttachment_2206 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2206", slider_2206);
-sliderAttachment_2207 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2207", slider_2207);
-sliderAttachment_2208 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2208", slider_2208);
-sliderAttachment_2209 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2209", slider_2209);
-sliderAttachment_2210 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2210", slider_2210);
-sliderAttachment_2211 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2211", slider_2211);
-sliderAttachment_2212 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2212", slider_2212);
-sliderAttachment_2213 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2213", slider_2213);
-sliderAttachment_2214 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2214", slider_2214);
-sliderAttachment_2215 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2215", slider_2215);
-sliderAttachment_2216 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2216", slider_2216);
-sliderAttachment_2217 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2217", slider_2217);
-sliderAttachment_2218 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2218", slider_2218);
-sliderAttachment_2219 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2219", slider_2219);
-sliderAttachment_2220 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2220", slider_2220);
-sliderAttachment_2221 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2221", slider_2221);
-sliderAttachment_2222 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2222", slider_2222);
-sliderAttachment_2223 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2223", slider_2223);
-sliderAttachment_2224 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2224", slider_2224);
-sliderAttachment_2225 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2225", slider_2225);
-sliderAttachment_2226 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2226", slider_2226);
-sliderAttachment_2227 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2227", slider_2227);
-sliderAttachment_2228 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2228", slider_2228);
-sliderAttachment_2229 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2229", slider_2229);
-sliderAttachment_2230 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2230", slider_2230);
-sliderAttachment_2231 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2231", slider_2231);
-sliderAttachment_2232 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2232", slider_2232);
-sliderAttachment_2233 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2233", slider_2233);
-sliderAttachment_2234 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2234", slider_2234);
-sliderAttachment_2235 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2235", slider_2235);
-sliderAttachment_2236 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2236", slider_2236);
-sliderAttachment_2237 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2237", slider_2237);
-sliderAttachment_2238 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2238", slider_2238);
-sliderAttachment_2239 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2239", slider_2239);
-sliderAttachment_2240 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2240", slider_2240);
-sliderAttachment_2241 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2241", slider_2241);
-sliderAttachment_2242 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2242", slider_2242);
-sliderAttachment_2243 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2243", slider_2243);
-sliderAttachment_2244 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2244", slider_2244);
-sliderAttachment_2245 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2245", slider_2245);
-sliderAttachment_2246 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2246", slider_2246);
-sliderAttachment_2247 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2247", slider_2247);
-sliderAttachment_2248 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2248", slider_2248);
-sliderAttachment_2249 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2249", slider_2249);
-sliderAttachment_2250 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2250", slider_2250);
-sliderAttachment_2251 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2251", slider_2251);
-sliderAttachment_2252 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2252", slider_2252);
-sliderAttachment_2253 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2253", slider_2253);
-sliderAttachment_2254 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2254", slider_2254);
-sliderAttachment_2255 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2255", slider_2255);
-sliderAttachment_2256 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2256", slider_2256);
-sliderAttachment_2257 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2257", slider_2257);
-sliderAttachment_2258 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2258", slider_2258);
-sliderAttachment_2259 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2259", slider_2259);
-sliderAttachment_2260 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2260", slider_2260);
-sliderAttachment_2261 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2261", slider_2261);
-sliderAttachment_2262 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2262", slider_2262);
-sliderAttachment_2263 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2263", slider_2263);
-sliderAttachment_2264 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2264", slider_2264);
-sliderAttachment_2265 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2265", slider_2265);
-sliderAttachment_2266 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2266", slider_2266);
-sliderAttachment_2267 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2267", slider_2267);
-sliderAttachment_2268 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2268", slider_2268);
-sliderAttachment_2269 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2269", slider_2269);
-sliderAttachment_2270 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2270", slider_2270);
-sliderAttachment_2271 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2271", slider_2271);
-sliderAttachment_2272 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2272", slider_2272);
-sliderAttachment_2273 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2273", slider_2273);
-sliderAttachment_2274 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2274", slider_2274);
-sliderAttachment_2275 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2275", slider_2275);
-sliderAttachment_2276 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2276", slider_2276);
-sliderAttachment_2277 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2277", slider_2277);
-sliderAttachment_2278 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2278", slider_2278);
-sliderAttachment_2279 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2279", slider_2279);
-sliderAttachment_2280 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2280", slider_2280);
-sliderAttachment_2281 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2281", slider_2281);
-sliderAttachment_2282 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2282", slider_2282);
-sliderAttachment_2283 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2283", slider_2283);
-sliderAttachment_2284 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2284", slider_2284);
-sliderAttachment_2285 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2285", slider_2285);
-sliderAttachment_2286 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2286", slider_2286);
-sliderAttachment_2287 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2287", slider_2287);
-sliderAttachment_2288 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2288", slider_2288);
-sliderAttachment_2289 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2289", slider_2289);
-sliderAttachment_2290 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2290", slider_2290);
-sliderAttachment_2291 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2291", slider_2291);
-sliderAttachment_2292 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2292", slider_2292);
-sliderAttachment_2293 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2293", slider_2293);
-sliderAttachment_2294 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2294", slider_2294);
-sliderAttachment_2295 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2295", slider_2295);
-sliderAttachment_2296 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2296", slider_2296);
-sliderAttachment_2297 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2297", slider_2297);
-sliderAttachment_2298 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2298", slider_2298);
-sliderAttachment_2299 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2299", slider_2299);
-sliderAttachment_2300 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2300", slider_2300);
-sliderAttachment_2301 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2301", slider_2301);
-sliderAttachment_2302 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2302", slider_2302);
-sliderAttachment_2303 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2303", slider_2303);
-sliderAttachment_2304 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2304", slider_2304);
-sliderAttachment_2305 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2305", slider_2305);
-sliderAttachment_2306 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2306", slider_2306);
-sliderAttachment_2307 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2307", slider_2307);
-sliderAttachment_2308 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2308", slider_2308);
-sliderAttachment_2309 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2309", slider_2309);
-sliderAttachment_2310 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2310", slider_2310);
-sliderAttachment_2311 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2311", slider_2311);
-sliderAttachment_2312 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2312", slider_2312);
-sliderAttachment_2313 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2313", slider_2313);
-sliderAttachment_2314 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2314", slider_2314);
-sliderAttachment_2315 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2315", slider_2315);
-sliderAttachment_2316 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2316", slider_2316);
-sliderAttachment_2317 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2317", slider_2317);
-sliderAttachment_2318 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2318", slider_2318);
-sliderAttachment_2319 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2319", slider_2319);
-sliderAttachment_2320 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2320", slider_2320);
-sliderAttachment_2321 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2321", slider_2321);
-sliderAttachment_2322 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2322", slider_2322);
-sliderAttachment_2323 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2323", slider_2323);
-sliderAttachment_2324 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2324", slider_2324);
-sliderAttachment_2325 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2325", slider_2325);
-sliderAttachment_2326 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2326", slider_2326);
-sliderAttachment_2327 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2327", slider_2327);
-sliderAttachment_2328 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2328", slider_2328);
-sliderAttachment_2329 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2329", slider_2329);
-sliderAttachment_2330 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2330", slider_2330);
-sliderAttachment_2331 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2331", slider_2331);
-sliderAttachment_2332 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2332", slider_2332);
-sliderAttachment_2333 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2333", slider_2333);
-sliderAttachment_2334 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2334", slider_2334);
-sliderAttachment_2335 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2335", slider_2335);
-sliderAttachment_2336 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2336", slider_2336);
-sliderAttachment_2337 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2337", slider_2337);
-sliderAttachment_2338 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2338", slider_2338);
-sliderAttachment_2339 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2339", slider_2339);
-sliderAttachment_2340 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2340", slider_2340);
-sliderAttachment_2341 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2341", slider_2341);
-sliderAttachment_2342 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2342", slider_2342);
-sliderAttachment_2343 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2343", slider_2343);
-sliderAttachment_2344 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2344", slider_2344);
-sliderAttachment_2345 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2345", slider_2345);
-sliderAttachment_2346 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2346", slider_2346);
-sliderAttachment_2347 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2347", slider_2347);
-sliderAttachment_2348 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2348", slider_2348);
-sliderAttachment_2349 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2349", slider_2349);
-sliderAttachment_2350 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2350", slider_2350);
-sliderAttachment_2351 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2351", slider_2351);
-sliderAttachment_2352 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2352", slider_2352);
-sliderAttachment_2353 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2353", slider_2353);
-sliderAttachment_2354 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2354", slider_2354);
-sliderAttachment_2355 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2355", slider_2355);
-sliderAttachment_2356 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2356", slider_2356);
-sliderAttachment_2357 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2357", slider_2357);
-sliderAttachment_2358 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2358", slider_2358);
-sliderAttachment_2359 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2359", slider_2359);
-sliderAttachment_2360 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2360", slider_2360);
-sliderAttachment_2361 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2361", slider_2361);
-sliderAttachment_2362 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2362", slider_2362);
-sliderAttachment_2363 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2363", slider_2363);
-sliderAttachment_2364 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2364", slider_2364);
-sliderAttachment_2365 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2365", slider_2365);
-sliderAttachment_2366 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2366", slider_2366);
-sliderAttachment_2367 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2367", slider_2367);
-sliderAttachment_2368 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2368", slider_2368);
-sliderAttachment_2369 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2369", slider_2369);
-sliderAttachment_2370 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2370", slider_2370);
-sliderAttachment_2371 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2371", slider_2371);
-sliderAttachment_2372 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2372", slider_2372);
-sliderAttachment_2373 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2373", slider_2373);
-sliderAttachment_2374 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2374", slider_2374);
-sliderAttachment_2375 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2375", slider_2375);
-sliderAttachment_2376 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2376", slider_2376);
-sliderAttachment_2377 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2377", slider_2377);
-sliderAttachment_2378 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2378", slider_2378);
-sliderAttachment_2379 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2379", slider_2379);
-sliderAttachment_2380 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2380", slider_2380);
-sliderAttachment_2381 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2381", slider_2381);
-sliderAttachment_2382 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2382", slider_2382);
-sliderAttachment_2383 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2383", slider_2383);
-sliderAttachment_2384 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2384", slider_2384);
-sliderAttachment_2385 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2385", slider_2385);
-sliderAttachment_2386 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2386", slider_2386);
-sliderAttachment_2387 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2387", slider_2387);
-sliderAttachment_2388 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2388", slider_2388);
-sliderAttachment_2389 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2389", slider_2389);
-sliderAttachment_2390 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2390", slider_2390);
-sliderAttachment_2391 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2391", slider_2391);
-sliderAttachment_2392 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2392", slider_2392);
-sliderAttachment_2393 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2393", slider_2393);
-sliderAttachment_2394 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2394", slider_2394);
-sliderAttachment_2395 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2395", slider_2395);
-sliderAttachment_2396 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2396", slider_2396);
-sliderAttachment_2397 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2397", slider_2397);
-sliderAttachment_2398 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2398", slider_2398);
-sliderAttachment_2399 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2399", slider_2399);
-sliderAttachment_2400 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2400", slider_2400);
-sliderAttachment_2401 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2401", slider_2401);
-sliderAttachment_2402 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2402", slider_2402);
-sliderAttachment_2403 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2403", slider_2403);
-sliderAttachment_2404 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2404", slider_2404);
-sliderAttachment_2405 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2405", slider_2405);
-sliderAttachment_2406 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2406", slider_2406);
-sliderAttachment_2407 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2407", slider_2407);
-sliderAttachment_2408 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2408", slider_2408);
-sliderAttachment_2409 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2409", slider_2409);
-sliderAttachment_2410 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2410", slider_2410);
-sliderAttachment_2411 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2411", slider_2411);
-sliderAttachment_2412 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2412", slider_2412);
-sliderAttachment_2413 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2413", slider_2413);
-sliderAttachment_2414 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2414", slider_2414);
-sliderAttachment_2415 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2415", slider_2415);
-sliderAttachment_2416 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2416", slider_2416);
-sliderAttachment_2417 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2417", slider_2417);
-sliderAttachment_2418 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2418", slider_2418);
-sliderAttachment_2419 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2419", slider_2419);
-sliderAttachment_2420 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2420", slider_2420);
-sliderAttachment_2421 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2421", slider_2421);
-sliderAttachment_2422 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2422", slider_2422);
-sliderAttachment_2423 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2423", slider_2423);
-sliderAttachment_2424 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2424", slider_2424);
-sliderAttachment_2425 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2425", slider_2425);
-sliderAttachment_2426 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2426", slider_2426);
-sliderAttachment_2427 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2427", slider_2427);
-sliderAttachment_2428 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2428", slider_2428);
-sliderAttachment_2429 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2429", slider_2429);
-sliderAttachment_2430 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2430", slider_2430);
-sliderAttachment_2431 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2431", slider_2431);
-sliderAttachment_2432 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2432", slider_2432);
-sliderAttachment_2433 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2433", slider_2433);
-sliderAttachment_2434 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2434", slider_2434);
-sliderAttachment_2435 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2435", slider_2435);
-sliderAttachment_2436 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2436", slider_2436);
-sliderAttachment_2437 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2437", slider_2437);
-sliderAttachment_2438 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2438", slider_2438);
-sliderAttachment_2439 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2439", slider_2439);
-sliderAttachment_2440 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2440", slider_2440);
-sliderAttachment_2441 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2441", slider_2441);
-sliderAttachment_2442 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2442", slider_2442);
-sliderAttachment_2443 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2443", slider_2443);
-sliderAttachment_2444 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2444", slider_2444);
-sliderAttachment_2445 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2445", slider_2445);
-sliderAttachment_2446 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2446", slider_2446);
-sliderAttachment_2447 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2447", slider_2447);
-sliderAttachment_2448 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2448", slider_2448);
-sliderAttachment_2449 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2449", slider_2449);
-sliderAttachment_2450 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2450", slider_2450);
-sliderAttachment_2451 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2451", slider_2451);
-sliderAttachment_2452 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2452", slider_2452);
-sliderAttachment_2453 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2453", slider_2453);
-sliderAttachment_2454 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2454", slider_2454);
-sliderAttachment_2455 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2455", slider_2455);
-sliderAttachment_2456 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2456", slider_2456);
-sliderAttachment_2457 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2457", slider_2457);
-sliderAttachment_2458 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2458", slider_2458);
-sliderAttachment_2459 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2459", slider_2459);
-sliderAttachment_2460 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2460", slider_2460);
-sliderAttachment_2461 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2461", slider_2461);
-sliderAttachment_2462 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2462", slider_2462);
-sliderAttachment_2463 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2463", slider_2463);
-sliderAttachment_2464 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2464", slider_2464);
-sliderAttachment_2465 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2465", slider_2465);
-sliderAttachment_2466 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2466", slider_2466);
-sliderAttachment_2467 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2467", slider_2467);
-sliderAttachment_2468 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2468", slider_2468);
-sliderAttachment_2469 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2469", slider_2469);
-sliderAttachment_2470 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2470", slider_2470);
-sliderAttachment_2471 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2471", slider_2471);
-sliderAttachment_2472 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2472", slider_2472);
-sliderAttachment_2473 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2473", slider_2473);
-sliderAttachment_2474 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2474", slider_2474);
-sliderAttachment_2475 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2475", slider_2475);
-sliderAttachment_2476 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2476", slider_2476);
-sliderAttachment_2477 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2477", slider_2477);
-sliderAttachment_2478 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2478", slider_2478);
-sliderAttachment_2479 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2479", slider_2479);
-sliderAttachment_2480 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2480", slider_2480);
-sliderAttachment_2481 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2481", slider_2481);
-sliderAttachment_2482 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2482", slider_2482);
-sliderAttachment_2483 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2483", slider_2483);
-sliderAttachment_2484 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2484", slider_2484);
-sliderAttachment_2485 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2485", slider_2485);
-sliderAttachment_2486 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2486", slider_2486);
-sliderAttachment_2487 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2487", slider_2487);
-sliderAttachment_2488 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2488", slider_2488);
-sliderAttachment_2489 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2489", slider_2489);
-sliderAttachment_2490 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2490", slider_2490);
-sliderAttachment_2491 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2491", slider_2491);
-sliderAttachment_2492 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2492", slider_2492);
-sliderAttachment_2493 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2493", slider_2493);
-sliderAttachment_2494 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2494", slider_2494);
-sliderAttachment_2495 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2495", slider_2495);
-sliderAttachment_2496 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2496", slider_2496);
-sliderAttachment_2497 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2497", slider_2497);
-sliderAttachment_2498 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2498", slider_2498);
-sliderAttachment_2499 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2499", slider_2499);
-sliderAttachment_2500 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2500", slider_2500);
-sliderAttachment_2501 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2501", slider_2501);
-sliderAttachment_2502 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2502", slider_2502);
-sliderAttachment_2503 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2503", slider_2503);
-sliderAttachment_2504 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2504", slider_2504);
-sliderAttachment_2505 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2505", slider_2505);
-sliderAttachment_2506 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2506", slider_2506);
-sliderAttachment_2507 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2507", slider_2507);
-sliderAttachment_2508 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2508", slider_2508);
-sliderAttachment_2509 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2509", slider_2509);
-sliderAttachment_2510 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2510", slider_2510);
-sliderAttachment_2511 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2511", slider_2511);
-sliderAttachment_2512 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2512", slider_2512);
-sliderAttachment_2513 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2513", slider_2513);
-sliderAttachment_2514 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2514", slider_2514);
-sliderAttachment_2515 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2515", slider_2515);
-sliderAttachment_2516 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2516", slider_2516);
-sliderAttachment_2517 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2517", slider_2517);
-sliderAttachment_2518 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2518", slider_2518);
-sliderAttachment_2519 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2519", slider_2519);
-sliderAttachment_2520 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2520", slider_2520);
-sliderAttachment_2521 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2521", slider_2521);
-sliderAttachment_2522 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2522", slider_2522);
-sliderAttachment_2523 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2523", slider_2523);
-sliderAttachment_2524 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2524", slider_2524);
-sliderAttachment_2525 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2525", slider_2525);
-sliderAttachment_2526 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2526", slider_2526);
-sliderAttachment_2527 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2527", slider_2527);
-sliderAttachment_2528 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2528", slider_2528);
-sliderAttachment_2529 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2529", slider_2529);
-sliderAttachment_2530 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2530", slider_2530);
-sliderAttachment_2531 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2531", slider_2531);
-sliderAttachment_2532 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2532", slider_2532);
-sliderAttachment_2533 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2533", slider_2533);
-sliderAttachment_2534 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2534", slider_2534);
-sliderAttachment_2535 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2535", slider_2535);
-sliderAttachment_2536 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2536", slider_2536);
-sliderAttachment_2537 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2537", slider_2537);
-sliderAttachment_2538 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2538", slider_2538);
-sliderAttachment_2539 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2539", slider_2539);
-sliderAttachment_2540 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2540", slider_2540);
-sliderAttachment_2541 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2541", slider_2541);
-sliderAttachment_2542 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2542", slider_2542);
-sliderAttachment_2543 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2543", slider_2543);
-sliderAttachment_2544 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2544", slider_2544);
-sliderAttachment_2545 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2545", slider_2545);
-sliderAttachment_2546 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2546", slider_2546);
-sliderAttachment_2547 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2547", slider_2547);
-sliderAttachment_2548 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2548", slider_2548);
-sliderAttachment_2549 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2549", slider_2549);
-sliderAttachment_2550 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2550", slider_2550);
-sliderAttachment_2551 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2551", slider_2551);
-sliderAttachment_2552 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2552", slider_2552);
-sliderAttachment_2553 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2553", slider_2553);
-sliderAttachment_2554 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2554", slider_2554);
-sliderAttachment_2555 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2555", slider_2555);
-sliderAttachment_2556 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2556", slider_2556);
-sliderAttachment_2557 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2557", slider_2557);
-sliderAttachment_2558 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2558", slider_2558);
-sliderAttachment_2559 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2559", slider_2559);
-sliderAttachment_2560 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2560", slider_2560);
-sliderAttachment_2561 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2561", slider_2561);
-sliderAttachment_2562 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2562", slider_2562);
-sliderAttachment_2563 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2563", slider_2563);
-sliderAttachment_2564 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2564", slider_2564);
-sliderAttachment_2565 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2565", slider_2565);
-sliderAttachment_2566 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2566", slider_2566);
-sliderAttachment_2567 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2567", slider_2567);
-sliderAttachment_2568 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2568", slider_2568);
-sliderAttachment_2569 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2569", slider_2569);
-sliderAttachment_2570 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2570", slider_2570);
-sliderAttachment_2571 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2571", slider_2571);
-sliderAttachment_2572 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2572", slider_2572);
-sliderAttachment_2573 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2573", slider_2573);
-sliderAttachment_2574 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2574", slider_2574);
-sliderAttachment_2575 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2575", slider_2575);
-sliderAttachment_2576 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2576", slider_2576);
-sliderAttachment_2577 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2577", slider_2577);
-sliderAttachment_2578 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2578", slider_2578);
-sliderAttachment_2579 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2579", slider_2579);
-sliderAttachment_2580 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2580", slider_2580);
-sliderAttachment_2581 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2581", slider_2581);
-sliderAttachment_2582 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2582", slider_2582);
-sliderAttachment_2583 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2583", slider_2583);
-sliderAttachment_2584 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2584", slider_2584);
-sliderAttachment_2585 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2585", slider_2585);
-sliderAttachment_2586 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2586", slider_2586);
-sliderAttachment_2587 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2587", slider_2587);
-sliderAttachment_2588 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2588", slider_2588);
-sliderAttachment_2589 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2589", slider_2589);
-sliderAttachment_2590 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2590", slider_2590);
-sliderAttachment_2591 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2591", slider_2591);
-sliderAttachment_2592 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2592", slider_2592);
-sliderAttachment_2593 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2593", slider_2593);
-sliderAttachment_2594 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2594", slider_2594);
-sliderAttachment_2595 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2595", slider_2595);
-sliderAttachment_2596 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2596", slider_2596);
-sliderAttachment_2597 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2597", slider_2597);
-sliderAttachment_2598 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2598", slider_2598);
-sliderAttachment_2599 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2599", slider_2599);
-sliderAttachment_2600 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2600", slider_2600);
-sliderAttachment_2601 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2601", slider_2601);
-sliderAttachment_2602 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2602", slider_2602);
-sliderAttachment_2603 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2603", slider_2603);
-sliderAttachment_2604 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2604", slider_2604);
-sliderAttachment_2605 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2605", slider_2605);
-sliderAttachment_2606 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2606", slider_2606);
-sliderAttachment_2607 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2607", slider_2607);
-sliderAttachment_2608 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2608", slider_2608);
-sliderAttachment_2609 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2609", slider_2609);
-sliderAttachment_2610 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2610", slider_2610);
-sliderAttachment_2611 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2611", slider_2611);
-sliderAttachment_2612 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2612", slider_2612);
-sliderAttachment_2613 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2613", slider_2613);
-sliderAttachment_2614 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2614", slider_2614);
-sliderAttachment_2615 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2615", slider_2615);
-sliderAttachment_2616 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2616", slider_2616);
-sliderAttachment_2617 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2617", slider_2617);
-sliderAttachment_2618 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2618", slider_2618);
-sliderAttachment_2619 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2619", slider_2619);
-sliderAttachment_2620 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2620", slider_2620);
-sliderAttachment_2621 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2621", slider_2621);
-sliderAttachment_2622 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2622", slider_2622);
-sliderAttachment_2623 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2623", slider_2623);
-sliderAttachment_2624 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2624", slider_2624);
-sliderAttachment_2625 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2625", slider_2625);
-sliderAttachment_2626 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2626", slider_2626);
-sliderAttachment_2627 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2627", slider_2627);
-sliderAttachment_2628 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2628", slider_2628);
-sliderAttachment_2629 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2629", slider_2629);
-sliderAttachment_2630 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2630", slider_2630);
-sliderAttachment_2631 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2631", slider_2631);
-sliderAttachment_2632 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2632", slider_2632);
-sliderAttachment_2633 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2633", slider_2633);
-sliderAttachment_2634 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2634", slider_2634);
-sliderAttachment_2635 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2635", slider_2635);
-sliderAttachment_2636 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2636", slider_2636);
-sliderAttachment_2637 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2637", slider_2637);
-sliderAttachment_2638 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2638", slider_2638);
-sliderAttachment_2639 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2639", slider_2639);
-sliderAttachment_2640 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2640", slider_2640);
-sliderAttachment_2641 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2641", slider_2641);
-sliderAttachment_2642 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2642", slider_2642);
-sliderAttachment_2643 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2643", slider_2643);
-sliderAttachment_2644 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2644", slider_2644);
-sliderAttachment_2645 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2645", slider_2645);
-sliderAttachment_2646 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2646", slider_2646);
-sliderAttachment_2647 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2647", slider_2647);
-sliderAttachment_2648 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2648", slider_2648);
-sliderAttachment_2649 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2649", slider_2649);
-sliderAttachment_2650 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2650", slider_2650);
-sliderAttachment_2651 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2651", slider_2651);
-sliderAttachment_2652 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2652", slider_2652);
-sliderAttachment_2653 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2653", slider_2653);
-sliderAttachment_2654 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2654", slider_2654);
-sliderAttachment_2655 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2655", slider_2655);
-sliderAttachment_2656 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2656", slider_2656);
-sliderAttachment_2657 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2657", slider_2657);
-sliderAttachment_2658 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2658", slider_2658);
-sliderAttachment_2659 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2659", slider_2659);
-sliderAttachment_2660 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2660", slider_2660);
-sliderAttachment_2661 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2661", slider_2661);
-sliderAttachment_2662 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2662", slider_2662);
-sliderAttachment_2663 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2663", slider_2663);
-sliderAttachment_2664 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2664", slider_2664);
-sliderAttachment_2665 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2665", slider_2665);
-sliderAttachment_2666 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2666", slider_2666);
-sliderAttachment_2667 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2667", slider_2667);
-sliderAttachment_2668 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2668", slider_2668);
-sliderAttachment_2669 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2669", slider_2669);
-sliderAttachment_2670 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2670", slider_2670);
-sliderAttachment_2671 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2671", slider_2671);
-sliderAttachment_2672 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2672", slider_2672);
-sliderAttachment_2673 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2673", slider_2673);
-sliderAttachment_2674 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2674", slider_2674);
-sliderAttachment_2675 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2675", slider_2675);
-sliderAttachment_2676 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2676", slider_2676);
-sliderAttachment_2677 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2677", slider_2677);
-sliderAttachment_2678 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2678", slider_2678);
-sliderAttachment_2679 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2679", slider_2679);
-sliderAttachment_2680 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2680", slider_2680);
-sliderAttachment_2681 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2681", slider_2681);
-sliderAttachment_2682 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2682", slider_2682);
-sliderAttachment_2683 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2683", slider_2683);
-sliderAttachment_2684 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2684", slider_2684);
-sliderAttachment_2685 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2685", slider_2685);
-sliderAttachment_2686 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2686", slider_2686);
-sliderAttachment_2687 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2687", slider_2687);
-sliderAttachment_2688 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2688", slider_2688);
-sliderAttachment_2689 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2689", slider_2689);
-sliderAttachment_2690 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2690", slider_2690);
-sliderAttachment_2691 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2691", slider_2691);
-sliderAttachment_2692 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2692", slider_2692);
-sliderAttachment_2693 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2693", slider_2693);
-sliderAttachment_2694 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2694", slider_2694);
-sliderAttachment_2695 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2695", slider_2695);
-sliderAttachment_2696 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2696", slider_2696);
-sliderAttachment_2697 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2697", slider_2697);
-sliderAttachment_2698 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2698", slider_2698);
-sliderAttachment_2699 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2699", slider_2699);
-sliderAttachment_2700 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2700", slider_2700);
-sliderAttachment_2701 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2701", slider_2701);
-sliderAttachment_2702 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2702", slider_2702);
-sliderAttachment_2703 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2703", slider_2703);
-sliderAttachment_2704 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2704", slider_2704);
-sliderAttachment_2705 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2705", slider_2705);
-sliderAttachment_2706 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2706", slider_2706);
-sliderAttachment_2707 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2707", slider_2707);
-sliderAttachment_2708 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2708", slider_2708);
-sliderAttachment_2709 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2709", slider_2709);
-sliderAttachment_2710 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2710", slider_2710);
-sliderAttachment_2711 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2711", slider_2711);
-sliderAttachment_2712 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2712", slider_2712);
-sliderAttachment_2713 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2713", slider_2713);
-sliderAttachment_2714 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2714", slider_2714);
-sliderAttachment_2715 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2715", slider_2715);
-sliderAttachment_2716 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2716", slider_2716);
-sliderAttachment_2717 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2717", slider_2717);
-sliderAttachment_2718 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2718", slider_2718);
-sliderAttachment_2719 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2719", slider_2719);
-sliderAttachment_2720 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2720", slider_2720);
-sliderAttachment_2721 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2721", slider_2721);
-sliderAttachment_2722 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2722", slider_2722);
-sliderAttachment_2723 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2723", slider_2723);
-sliderAttachment_2724 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2724", slider_2724);
-sliderAttachment_2725 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2725", slider_2725);
-sliderAttachment_2726 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2726", slider_2726);
-sliderAttachment_2727 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2727", slider_2727);
-sliderAttachment_2728 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2728", slider_2728);
-sliderAttachment_2729 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2729", slider_2729);
-sliderAttachment_2730 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2730", slider_2730);
-sliderAttachment_2731 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2731", slider_2731);
-sliderAttachment_2732 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2732", slider_2732);
-sliderAttachment_2733 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2733", slider_2733);
-sliderAttachment_2734 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2734", slider_2734);
-sliderAttachment_2735 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2735", slider_2735);
-sliderAttachment_2736 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2736", slider_2736);
-sliderAttachment_2737 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2737", slider_2737);
-sliderAttachment_2738 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2738", slider_2738);
-sliderAttachment_2739 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2739", slider_2739);
-sliderAttachment_2740 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2740", slider_2740);
-sliderAttachment_2741 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2741", slider_2741);
-sliderAttachment_2742 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2742", slider_2742);
-sliderAttachment_2743 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2743", slider_2743);
-sliderAttachment_2744 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2744", slider_2744);
-sliderAttachment_2745 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2745", slider_2745);
-sliderAttachment_2746 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2746", slider_2746);
-sliderAttachment_2747 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2747", slider_2747);
-sliderAttachment_2748 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2748", slider_2748);
-sliderAttachment_2749 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2749", slider_2749);
-sliderAttachment_2750 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2750", slider_2750);
-sliderAttachment_2751 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2751", slider_2751);
-sliderAttachment_2752 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2752", slider_2752);
-sliderAttachment_2753 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2753", slider_2753);
-sliderAttachment_2754 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2754", slider_2754);
-sliderAttachment_2755 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2755", slider_2755);
-sliderAttachment_2756 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2756", slider_2756);
-sliderAttachment_2757 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2757", slider_2757);
-sliderAttachment_2758 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2758", slider_2758);
-sliderAttachment_2759 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2759", slider_2759);
-sliderAttachment_2760 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2760", slider_2760);
-sliderAttachment_2761 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2761", slider_2761);
-sliderAttachment_2762 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2762", slider_2762);
-sliderAttachment_2763 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2763", slider_2763);
-sliderAttachment_2764 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2764", slider_2764);
-sliderAttachment_2765 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2765", slider_2765);
-sliderAttachment_2766 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2766", slider_2766);
-sliderAttachment_2767 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2767", slider_2767);
-sliderAttachment_2768 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2768", slider_2768);
-sliderAttachment_2769 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2769", slider_2769);
-sliderAttachment_2770 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2770", slider_2770);
-sliderAttachment_2771 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2771", slider_2771);
-sliderAttachment_2772 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2772", slider_2772);
-sliderAttachment_2773 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2773", slider_2773);
-sliderAttachment_2774 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2774", slider_2774);
-sliderAttachment_2775 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2775", slider_2775);
-sliderAttachment_2776 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2776", slider_2776);
-sliderAttachment_2777 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2777", slider_2777);
-sliderAttachment_2778 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2778", slider_2778);
-sliderAttachment_2779 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2779", slider_2779);
-sliderAttachment_2780 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2780", slider_2780);
-sliderAttachment_2781 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2781", slider_2781);
-sliderAttachment_2782 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2782", slider_2782);
-sliderAttachment_2783 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2783", slider_2783);
-sliderAttachment_2784 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2784", slider_2784);
-sliderAttachment_2785 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2785", slider_2785);
-sliderAttachment_2786 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2786", slider_2786);
-sliderAttachment_2787 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2787", slider_2787);
-sliderAttachment_2788 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2788", slider_2788);
-sliderAttachment_2789 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2789", slider_2789);
-sliderAttachment_2790 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2790", slider_2790);
-sliderAttachment_2791 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2791", slider_2791);
-sliderAttachment_2792 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2792", slider_2792);
-sliderAttachment_2793 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2793", slider_2793);
-sliderAttachment_2794 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2794", slider_2794);
-sliderAttachment_2795 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2795", slider_2795);
-sliderAttachment_2796 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2796", slider_2796);
-sliderAttachment_2797 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2797", slider_2797);
-sliderAttachment_2798 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2798", slider_2798);
-sliderAttachment_2799 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2799", slider_2799);
-sliderAttachment_2800 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2800", slider_2800);
-sliderAttachment_2801 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2801", slider_2801);
-sliderAttachment_2802 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2802", slider_2802);
-sliderAttachment_2803 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2803", slider_2803);
-sliderAttachment_2804 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2804", slider_2804);
-sliderAttachment_2805 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2805", slider_2805);
-sliderAttachment_2806 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2806", slider_2806);
-sliderAttachment_2807 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2807", slider_2807);
-sliderAttachment_2808 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2808", slider_2808);
-sliderAttachment_2809 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2809", slider_2809);
-sliderAttachment_2810 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2810", slider_2810);
-sliderAttachment_2811 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2811", slider_2811);
-sliderAttachment_2812 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2812", slider_2812);
-sliderAttachment_2813 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2813", slider_2813);
-sliderAttachment_2814 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2814", slider_2814);
-sliderAttachment_2815 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2815", slider_2815);
-sliderAttachment_2816 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2816", slider_2816);
-sliderAttachment_2817 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2817", slider_2817);
-sliderAttachment_2818 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2818", slider_2818);
-sliderAttachment_2819 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2819", slider_2819);
-sliderAttachment_2820 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2820", slider_2820);
-sliderAttachment_2821 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2821", slider_2821);
-sliderAttachment_2822 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2822", slider_2822);
-sliderAttachment_2823 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2823", slider_2823);
-sliderAttachment_2824 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2824", slider_2824);
-sliderAttachment_2825 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2825", slider_2825);
-sliderAttachment_2826 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2826", slider_2826);
-sliderAttachment_2827 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2827", slider_2827);
-sliderAttachment_2828 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2828", slider_2828);
-sliderAttachment_2829 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2829", slider_2829);
-sliderAttachment_2830 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2830", slider_2830);
-sliderAttachment_2831 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2831", slider_2831);
-sliderAttachment_2832 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2832", slider_2832);
-sliderAttachment_2833 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2833", slider_2833);
-sliderAttachment_2834 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2834", slider_2834);
-sliderAttachment_2835 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2835", slider_2835);
-sliderAttachment_2836 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2836", slider_2836);
-sliderAttachment_2837 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2837", slider_2837);
-sliderAttachment_2838 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2838", slider_2838);
-sliderAttachment_2839 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2839", slider_2839);
-sliderAttachment_2840 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2840", slider_2840);
-sliderAttachment_2841 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2841", slider_2841);
-sliderAttachment_2842 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2842", slider_2842);
-sliderAttachment_2843 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2843", slider_2843);
-sliderAttachment_2844 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2844", slider_2844);
-sliderAttachment_2845 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2845", slider_2845);
-sliderAttachment_2846 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2846", slider_2846);
-sliderAttachment_2847 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2847", slider_2847);
-sliderAttachment_2848 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2848", slider_2848);
-sliderAttachment_2849 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2849", slider_2849);
-sliderAttachment_2850 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2850", slider_2850);
-sliderAttachment_2851 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2851", slider_2851);
-sliderAttachment_2852 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2852", slider_2852);
-sliderAttachment_2853 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2853", slider_2853);
-sliderAttachment_2854 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2854", slider_2854);
-sliderAttachment_2855 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2855", slider_2855);
-sliderAttachment_2856 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2856", slider_2856);
-sliderAttachment_2857 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2857", slider_2857);
-sliderAttachment_2858 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2858", slider_2858);
-sliderAttachment_2859 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2859", slider_2859);
-sliderAttachment_2860 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2860", slider_2860);
-sliderAttachment_2861 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2861", slider_2861);
-sliderAttachment_2862 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2862", slider_2862);
-sliderAttachment_2863 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2863", slider_2863);
-sliderAttachment_2864 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2864", slider_2864);
-sliderAttachment_2865 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2865", slider_2865);
-sliderAttachment_2866 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2866", slider_2866);
-sliderAttachment_2867 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2867", slider_2867);
-sliderAttachment_2868 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2868", slider_2868);
-sliderAttachment_2869 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2869", slider_2869);
-sliderAttachment_2870 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2870", slider_2870);
-sliderAttachment_2871 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2871", slider_2871);
-sliderAttachment_2872 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2872", slider_2872);
-sliderAttachment_2873 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2873", slider_2873);
-sliderAttachment_2874 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2874", slider_2874);
-sliderAttachment_2875 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2875", slider_2875);
-sliderAttachment_2876 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2876", slider_2876);
-sliderAttachment_2877 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2877", slider_2877);
-sliderAttachment_2878 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2878", slider_2878);
-sliderAttachment_2879 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2879", slider_2879);
-sliderAttachment_2880 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2880", slider_2880);
-sliderAttachment_2881 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2881", slider_2881);
-sliderAttachment_2882 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2882", slider_2882);
-sliderAttachment_2883 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2883", slider_2883);
-sliderAttachment_2884 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2884", slider_2884);
-sliderAttachment_2885 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2885", slider_2885);
-sliderAttachment_2886 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2886", slider_2886);
-sliderAttachment_2887 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2887", slider_2887);
-sliderAttachment_2888 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2888", slider_2888);
-sliderAttachment_2889 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2889", slider_2889);
-sliderAttachment_2890 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2890", slider_2890);
-sliderAttachment_2891 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2891", slider_2891);
-sliderAttachment_2892 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2892", slider_2892);
-sliderAttachment_2893 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2893", slider_2893);
-sliderAttachment_2894 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2894", slider_2894);
-sliderAttachment_2895 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2895", slider_2895);
-sliderAttachment_2896 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2896", slider_2896);
-sliderAttachment_2897 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2897", slider_2897);
-sliderAttachment_2898 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2898", slider_2898);
-sliderAttachment_2899 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2899", slider_2899);
-sliderAttachment_2900 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2900", slider_2900);
-sliderAttachment_2901 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2901", slider_2901);
-sliderAttachment_2902 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2902", slider_2902);
-sliderAttachment_2903 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2903", slider_2903);
-sliderAttachment_2904 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2904", slider_2904);
-sliderAttachment_2905 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2905", slider_2905);
-sliderAttachment_2906 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2906", slider_2906);
-sliderAttachment_2907 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2907", slider_2907);
-sliderAttachment_2908 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2908", slider_2908);
-sliderAttachment_2909 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2909", slider_2909);
-sliderAttachment_2910 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2910", slider_2910);
-sliderAttachment_2911 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2911", slider_2911);
-sliderAttachment_2912 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2912", slider_2912);
-sliderAttachment_2913 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2913", slider_2913);
-sliderAttachment_2914 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2914", slider_2914);
-sliderAttachment_2915 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2915", slider_2915);
-sliderAttachment_2916 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2916", slider_2916);
-sliderAttachment_2917 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2917", slider_2917);
-sliderAttachment_2918 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2918", slider_2918);
-sliderAttachment_2919 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2919", slider_2919);
-sliderAttachment_2920 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2920", slider_2920);
-sliderAttachment_2921 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2921", slider_2921);
-sliderAttachment_2922 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2922", slider_2922);
-sliderAttachment_2923 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2923", slider_2923);
-sliderAttachment_2924 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2924", slider_2924);
-sliderAttachment_2925 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2925", slider_2925);
-sliderAttachment_2926 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2926", slider_2926);
-sliderAttachment_2927 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2927", slider_2927);
-sliderAttachment_2928 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2928", slider_2928);
-sliderAttachment_2929 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2929", slider_2929);
-sliderAttachment_2930 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2930", slider_2930);
-sliderAttachment_2931 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2931", slider_2931);
-sliderAttachment_2932 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2932", slider_2932);
-sliderAttachment_2933 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2933", slider_2933);
-sliderAttachment_2934 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2934", slider_2934);
-sliderAttachment_2935 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2935", slider_2935);
-sliderAttachment_2936 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2936", slider_2936);
-sliderAttachment_2937 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2937", slider_2937);
-sliderAttachment_2938 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2938", slider_2938);
-sliderAttachment_2939 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2939", slider_2939);
-sliderAttachment_2940 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2940", slider_2940);
-sliderAttachment_2941 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2941", slider_2941);
-sliderAttachment_2942 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2942", slider_2942);
-sliderAttachment_2943 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2943", slider_2943);
-sliderAttachment_2944 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2944", slider_2944);
-sliderAttachment_2945 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2945", slider_2945);
-sliderAttachment_2946 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2946", slider_2946);
-sliderAttachment_2947 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2947", slider_2947);
-sliderAttachment_2948 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2948", slider_2948);
-sliderAttachment_2949 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2949", slider_2949);
-sliderAttachment_2950 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2950", slider_2950);
-sliderAttachment_2951 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2951", slider_2951);
-sliderAttachment_2952 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2952", slider_2952);
-sliderAttachment_2953 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2953", slider_2953);
-sliderAttachment_2954 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2954", slider_2954);
-sliderAttachment_2955 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2955", slider_2955);
-sliderAttachment_2956 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2956", slider_2956);
-sliderAttachment_2957 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2957", slider_2957);
-sliderAttachment_2958 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2958", slider_2958);
-sliderAttachment_2959 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2959", slider_2959);
-sliderAttachment_2960 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2960", slider_2960);
-sliderAttachment_2961 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2961", slider_2961);
-sliderAttachment_2962 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2962", slider_2962);
-sliderAttachment_2963 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2963", slider_2963);
-sliderAttachment_2964 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2964", slider_2964);
-sliderAttachment_2965 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2965", slider_2965);
-sliderAttachment_2966 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2966", slider_2966);
-sliderAttachment_2967 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2967", slider_2967);
-sliderAttachment_2968 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2968", slider_2968);
-sliderAttachment_2969 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2969", slider_2969);
-sliderAttachment_2970 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2970", slider_2970);
-sliderAttachment_2971 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2971", slider_2971);
-sliderAttachment_2972 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2972", slider_2972);
-sliderAttachment_2973 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2973", slider_2973);
-sliderAttachment_2974 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2974", slider_2974);
-sliderAttachment_2975 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2975", slider_2975);
-sliderAttachment_2976 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2976", slider_2976);
-sliderAttachment_2977 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2977", slider_2977);
-sliderAttachment_2978 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2978", slider_2978);
-sliderAttachment_2979 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2979", slider_2979);
-sliderAttachment_2980 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2980", slider_2980);
-sliderAttachment_2981 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2981", slider_2981);
-sliderAttachment_2982 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2982", slider_2982);
-sliderAttachment_2983 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2983", slider_2983);
-sliderAttachment_2984 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2984", slider_2984);
-sliderAttachment_2985 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2985", slider_2985);
-sliderAttachment_2986 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2986", slider_2986);
-sliderAttachment_2987 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2987", slider_2987);
-sliderAttachment_2988 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2988", slider_2988);
-sliderAttachment_2989 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2989", slider_2989);
-sliderAttachment_2990 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2990", slider_2990);
-sliderAttachment_2991 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2991", slider_2991);
-sliderAttachment_2992 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2992", slider_2992);
-sliderAttachment_2993 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2993", slider_2993);
-sliderAttachment_2994 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2994", slider_2994);
-sliderAttachment_2995 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2995", slider_2995);
-sliderAttachment_2996 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2996", slider_2996);
-sliderAttachment_2997 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2997", slider_2997);
-sliderAttachment_2998 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2998", slider_2998);
-sliderAttachment_2999 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "2999", slider_2999);
-sliderAttachment_3000 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3000", slider_3000);
-sliderAttachment_3001 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3001", slider_3001);
-sliderAttachment_3002 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3002", slider_3002);
-sliderAttachment_3003 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3003", slider_3003);
-sliderAttachment_3004 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3004", slider_3004);
-sliderAttachment_3005 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3005", slider_3005);
-sliderAttachment_3006 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3006", slider_3006);
-sliderAttachment_3007 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3007", slider_3007);
-sliderAttachment_3008 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3008", slider_3008);
-sliderAttachment_3009 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3009", slider_3009);
-sliderAttachment_3010 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3010", slider_3010);
-sliderAttachment_3011 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3011", slider_3011);
-sliderAttachment_3012 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3012", slider_3012);
-sliderAttachment_3013 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3013", slider_3013);
-sliderAttachment_3014 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3014", slider_3014);
-sliderAttachment_3015 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3015", slider_3015);
-sliderAttachment_3016 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3016", slider_3016);
-sliderAttachment_3017 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3017", slider_3017);
-sliderAttachment_3018 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3018", slider_3018);
-sliderAttachment_3019 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3019", slider_3019);
-sliderAttachment_3020 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3020", slider_3020);
-sliderAttachment_3021 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3021", slider_3021);
-sliderAttachment_3022 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3022", slider_3022);
-sliderAttachment_3023 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3023", slider_3023);
-sliderAttachment_3024 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3024", slider_3024);
-sliderAttachment_3025 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3025", slider_3025);
-sliderAttachment_3026 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3026", slider_3026);
-sliderAttachment_3027 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3027", slider_3027);
-sliderAttachment_3028 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3028", slider_3028);
-sliderAttachment_3029 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3029", slider_3029);
-sliderAttachment_3030 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3030", slider_3030);
-sliderAttachment_3031 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3031", slider_3031);
-sliderAttachment_3032 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3032", slider_3032);
-sliderAttachment_3033 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3033", slider_3033);
-sliderAttachment_3034 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3034", slider_3034);
-sliderAttachment_3035 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3035", slider_3035);
-sliderAttachment_3036 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3036", slider_3036);
-sliderAttachment_3037 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3037", slider_3037);
-sliderAttachment_3038 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3038", slider_3038);
-sliderAttachment_3039 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3039", slider_3039);
-sliderAttachment_3040 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3040", slider_3040);
-sliderAttachment_3041 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3041", slider_3041);
-sliderAttachment_3042 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3042", slider_3042);
-sliderAttachment_3043 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3043", slider_3043);
-sliderAttachment_3044 = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, "3044", slider_3044);
-
@@ -1,3046 +0,0 @@
-#pragma once
-juce::Slider slider_0; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_0;
-juce::Slider slider_1; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1;
-juce::Slider slider_2; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2;
-juce::Slider slider_3; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3;
-juce::Slider slider_4; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_4;
-juce::Slider slider_5; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_5;
-juce::Slider slider_6; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_6;
-juce::Slider slider_7; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_7;
-juce::Slider slider_8; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_8;
-juce::Slider slider_9; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_9;
-juce::Slider slider_10; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_10;
-juce::Slider slider_11; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_11;
-juce::Slider slider_12; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_12;
-juce::Slider slider_13; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_13;
-juce::Slider slider_14; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_14;
-juce::Slider slider_15; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_15;
-juce::Slider slider_16; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_16;
-juce::Slider slider_17; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_17;
-juce::Slider slider_18; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_18;
-juce::Slider slider_19; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_19;
-juce::Slider slider_20; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_20;
-juce::Slider slider_21; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_21;
-juce::Slider slider_22; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_22;
-juce::Slider slider_23; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_23;
-juce::Slider slider_24; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_24;
-juce::Slider slider_25; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_25;
-juce::Slider slider_26; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_26;
-juce::Slider slider_27; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_27;
-juce::Slider slider_28; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_28;
-juce::Slider slider_29; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_29;
-juce::Slider slider_30; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_30;
-juce::Slider slider_31; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_31;
-juce::Slider slider_32; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_32;
-juce::Slider slider_33; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_33;
-juce::Slider slider_34; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_34;
-juce::Slider slider_35; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_35;
-juce::Slider slider_36; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_36;
-juce::Slider slider_37; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_37;
-juce::Slider slider_38; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_38;
-juce::Slider slider_39; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_39;
-juce::Slider slider_40; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_40;
-juce::Slider slider_41; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_41;
-juce::Slider slider_42; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_42;
-juce::Slider slider_43; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_43;
-juce::Slider slider_44; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_44;
-juce::Slider slider_45; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_45;
-juce::Slider slider_46; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_46;
-juce::Slider slider_47; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_47;
-juce::Slider slider_48; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_48;
-juce::Slider slider_49; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_49;
-juce::Slider slider_50; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_50;
-juce::Slider slider_51; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_51;
-juce::Slider slider_52; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_52;
-juce::Slider slider_53; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_53;
-juce::Slider slider_54; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_54;
-juce::Slider slider_55; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_55;
-juce::Slider slider_56; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_56;
-juce::Slider slider_57; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_57;
-juce::Slider slider_58; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_58;
-juce::Slider slider_59; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_59;
-juce::Slider slider_60; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_60;
-juce::Slider slider_61; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_61;
-juce::Slider slider_62; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_62;
-juce::Slider slider_63; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_63;
-juce::Slider slider_64; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_64;
-juce::Slider slider_65; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_65;
-juce::Slider slider_66; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_66;
-juce::Slider slider_67; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_67;
-juce::Slider slider_68; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_68;
-juce::Slider slider_69; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_69;
-juce::Slider slider_70; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_70;
-juce::Slider slider_71; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_71;
-juce::Slider slider_72; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_72;
-juce::Slider slider_73; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_73;
-juce::Slider slider_74; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_74;
-juce::Slider slider_75; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_75;
-juce::Slider slider_76; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_76;
-juce::Slider slider_77; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_77;
-juce::Slider slider_78; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_78;
-juce::Slider slider_79; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_79;
-juce::Slider slider_80; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_80;
-juce::Slider slider_81; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_81;
-juce::Slider slider_82; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_82;
-juce::Slider slider_83; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_83;
-juce::Slider slider_84; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_84;
-juce::Slider slider_85; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_85;
-juce::Slider slider_86; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_86;
-juce::Slider slider_87; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_87;
-juce::Slider slider_88; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_88;
-juce::Slider slider_89; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_89;
-juce::Slider slider_90; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_90;
-juce::Slider slider_91; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_91;
-juce::Slider slider_92; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_92;
-juce::Slider slider_93; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_93;
-juce::Slider slider_94; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_94;
-juce::Slider slider_95; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_95;
-juce::Slider slider_96; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_96;
-juce::Slider slider_97; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_97;
-juce::Slider slider_98; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_98;
-juce::Slider slider_99; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_99;
-juce::Slider slider_100; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_100;
-juce::Slider slider_101; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_101;
-juce::Slider slider_102; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_102;
-juce::Slider slider_103; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_103;
-juce::Slider slider_104; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_104;
-juce::Slider slider_105; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_105;
-juce::Slider slider_106; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_106;
-juce::Slider slider_107; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_107;
-juce::Slider slider_108; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_108;
-juce::Slider slider_109; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_109;
-juce::Slider slider_110; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_110;
-juce::Slider slider_111; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_111;
-juce::Slider slider_112; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_112;
-juce::Slider slider_113; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_113;
-juce::Slider slider_114; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_114;
-juce::Slider slider_115; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_115;
-juce::Slider slider_116; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_116;
-juce::Slider slider_117; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_117;
-juce::Slider slider_118; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_118;
-juce::Slider slider_119; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_119;
-juce::Slider slider_120; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_120;
-juce::Slider slider_121; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_121;
-juce::Slider slider_122; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_122;
-juce::Slider slider_123; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_123;
-juce::Slider slider_124; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_124;
-juce::Slider slider_125; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_125;
-juce::Slider slider_126; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_126;
-juce::Slider slider_127; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_127;
-juce::Slider slider_128; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_128;
-juce::Slider slider_129; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_129;
-juce::Slider slider_130; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_130;
-juce::Slider slider_131; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_131;
-juce::Slider slider_132; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_132;
-juce::Slider slider_133; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_133;
-juce::Slider slider_134; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_134;
-juce::Slider slider_135; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_135;
-juce::Slider slider_136; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_136;
-juce::Slider slider_137; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_137;
-juce::Slider slider_138; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_138;
-juce::Slider slider_139; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_139;
-juce::Slider slider_140; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_140;
-juce::Slider slider_141; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_141;
-juce::Slider slider_142; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_142;
-juce::Slider slider_143; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_143;
-juce::Slider slider_144; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_144;
-juce::Slider slider_145; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_145;
-juce::Slider slider_146; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_146;
-juce::Slider slider_147; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_147;
-juce::Slider slider_148; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_148;
-juce::Slider slider_149; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_149;
-juce::Slider slider_150; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_150;
-juce::Slider slider_151; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_151;
-juce::Slider slider_152; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_152;
-juce::Slider slider_153; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_153;
-juce::Slider slider_154; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_154;
-juce::Slider slider_155; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_155;
-juce::Slider slider_156; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_156;
-juce::Slider slider_157; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_157;
-juce::Slider slider_158; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_158;
-juce::Slider slider_159; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_159;
-juce::Slider slider_160; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_160;
-juce::Slider slider_161; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_161;
-juce::Slider slider_162; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_162;
-juce::Slider slider_163; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_163;
-juce::Slider slider_164; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_164;
-juce::Slider slider_165; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_165;
-juce::Slider slider_166; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_166;
-juce::Slider slider_167; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_167;
-juce::Slider slider_168; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_168;
-juce::Slider slider_169; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_169;
-juce::Slider slider_170; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_170;
-juce::Slider slider_171; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_171;
-juce::Slider slider_172; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_172;
-juce::Slider slider_173; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_173;
-juce::Slider slider_174; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_174;
-juce::Slider slider_175; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_175;
-juce::Slider slider_176; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_176;
-juce::Slider slider_177; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_177;
-juce::Slider slider_178; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_178;
-juce::Slider slider_179; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_179;
-juce::Slider slider_180; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_180;
-juce::Slider slider_181; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_181;
-juce::Slider slider_182; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_182;
-juce::Slider slider_183; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_183;
-juce::Slider slider_184; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_184;
-juce::Slider slider_185; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_185;
-juce::Slider slider_186; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_186;
-juce::Slider slider_187; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_187;
-juce::Slider slider_188; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_188;
-juce::Slider slider_189; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_189;
-juce::Slider slider_190; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_190;
-juce::Slider slider_191; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_191;
-juce::Slider slider_192; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_192;
-juce::Slider slider_193; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_193;
-juce::Slider slider_194; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_194;
-juce::Slider slider_195; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_195;
-juce::Slider slider_196; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_196;
-juce::Slider slider_197; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_197;
-juce::Slider slider_198; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_198;
-juce::Slider slider_199; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_199;
-juce::Slider slider_200; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_200;
-juce::Slider slider_201; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_201;
-juce::Slider slider_202; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_202;
-juce::Slider slider_203; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_203;
-juce::Slider slider_204; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_204;
-juce::Slider slider_205; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_205;
-juce::Slider slider_206; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_206;
-juce::Slider slider_207; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_207;
-juce::Slider slider_208; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_208;
-juce::Slider slider_209; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_209;
-juce::Slider slider_210; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_210;
-juce::Slider slider_211; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_211;
-juce::Slider slider_212; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_212;
-juce::Slider slider_213; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_213;
-juce::Slider slider_214; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_214;
-juce::Slider slider_215; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_215;
-juce::Slider slider_216; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_216;
-juce::Slider slider_217; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_217;
-juce::Slider slider_218; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_218;
-juce::Slider slider_219; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_219;
-juce::Slider slider_220; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_220;
-juce::Slider slider_221; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_221;
-juce::Slider slider_222; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_222;
-juce::Slider slider_223; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_223;
-juce::Slider slider_224; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_224;
-juce::Slider slider_225; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_225;
-juce::Slider slider_226; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_226;
-juce::Slider slider_227; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_227;
-juce::Slider slider_228; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_228;
-juce::Slider slider_229; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_229;
-juce::Slider slider_230; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_230;
-juce::Slider slider_231; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_231;
-juce::Slider slider_232; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_232;
-juce::Slider slider_233; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_233;
-juce::Slider slider_234; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_234;
-juce::Slider slider_235; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_235;
-juce::Slider slider_236; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_236;
-juce::Slider slider_237; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_237;
-juce::Slider slider_238; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_238;
-juce::Slider slider_239; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_239;
-juce::Slider slider_240; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_240;
-juce::Slider slider_241; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_241;
-juce::Slider slider_242; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_242;
-juce::Slider slider_243; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_243;
-juce::Slider slider_244; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_244;
-juce::Slider slider_245; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_245;
-juce::Slider slider_246; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_246;
-juce::Slider slider_247; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_247;
-juce::Slider slider_248; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_248;
-juce::Slider slider_249; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_249;
-juce::Slider slider_250; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_250;
-juce::Slider slider_251; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_251;
-juce::Slider slider_252; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_252;
-juce::Slider slider_253; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_253;
-juce::Slider slider_254; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_254;
-juce::Slider slider_255; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_255;
-juce::Slider slider_256; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_256;
-juce::Slider slider_257; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_257;
-juce::Slider slider_258; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_258;
-juce::Slider slider_259; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_259;
-juce::Slider slider_260; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_260;
-juce::Slider slider_261; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_261;
-juce::Slider slider_262; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_262;
-juce::Slider slider_263; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_263;
-juce::Slider slider_264; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_264;
-juce::Slider slider_265; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_265;
-juce::Slider slider_266; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_266;
-juce::Slider slider_267; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_267;
-juce::Slider slider_268; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_268;
-juce::Slider slider_269; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_269;
-juce::Slider slider_270; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_270;
-juce::Slider slider_271; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_271;
-juce::Slider slider_272; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_272;
-juce::Slider slider_273; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_273;
-juce::Slider slider_274; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_274;
-juce::Slider slider_275; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_275;
-juce::Slider slider_276; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_276;
-juce::Slider slider_277; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_277;
-juce::Slider slider_278; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_278;
-juce::Slider slider_279; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_279;
-juce::Slider slider_280; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_280;
-juce::Slider slider_281; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_281;
-juce::Slider slider_282; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_282;
-juce::Slider slider_283; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_283;
-juce::Slider slider_284; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_284;
-juce::Slider slider_285; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_285;
-juce::Slider slider_286; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_286;
-juce::Slider slider_287; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_287;
-juce::Slider slider_288; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_288;
-juce::Slider slider_289; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_289;
-juce::Slider slider_290; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_290;
-juce::Slider slider_291; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_291;
-juce::Slider slider_292; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_292;
-juce::Slider slider_293; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_293;
-juce::Slider slider_294; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_294;
-juce::Slider slider_295; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_295;
-juce::Slider slider_296; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_296;
-juce::Slider slider_297; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_297;
-juce::Slider slider_298; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_298;
-juce::Slider slider_299; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_299;
-juce::Slider slider_300; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_300;
-juce::Slider slider_301; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_301;
-juce::Slider slider_302; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_302;
-juce::Slider slider_303; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_303;
-juce::Slider slider_304; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_304;
-juce::Slider slider_305; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_305;
-juce::Slider slider_306; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_306;
-juce::Slider slider_307; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_307;
-juce::Slider slider_308; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_308;
-juce::Slider slider_309; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_309;
-juce::Slider slider_310; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_310;
-juce::Slider slider_311; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_311;
-juce::Slider slider_312; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_312;
-juce::Slider slider_313; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_313;
-juce::Slider slider_314; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_314;
-juce::Slider slider_315; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_315;
-juce::Slider slider_316; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_316;
-juce::Slider slider_317; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_317;
-juce::Slider slider_318; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_318;
-juce::Slider slider_319; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_319;
-juce::Slider slider_320; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_320;
-juce::Slider slider_321; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_321;
-juce::Slider slider_322; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_322;
-juce::Slider slider_323; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_323;
-juce::Slider slider_324; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_324;
-juce::Slider slider_325; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_325;
-juce::Slider slider_326; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_326;
-juce::Slider slider_327; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_327;
-juce::Slider slider_328; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_328;
-juce::Slider slider_329; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_329;
-juce::Slider slider_330; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_330;
-juce::Slider slider_331; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_331;
-juce::Slider slider_332; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_332;
-juce::Slider slider_333; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_333;
-juce::Slider slider_334; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_334;
-juce::Slider slider_335; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_335;
-juce::Slider slider_336; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_336;
-juce::Slider slider_337; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_337;
-juce::Slider slider_338; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_338;
-juce::Slider slider_339; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_339;
-juce::Slider slider_340; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_340;
-juce::Slider slider_341; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_341;
-juce::Slider slider_342; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_342;
-juce::Slider slider_343; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_343;
-juce::Slider slider_344; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_344;
-juce::Slider slider_345; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_345;
-juce::Slider slider_346; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_346;
-juce::Slider slider_347; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_347;
-juce::Slider slider_348; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_348;
-juce::Slider slider_349; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_349;
-juce::Slider slider_350; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_350;
-juce::Slider slider_351; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_351;
-juce::Slider slider_352; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_352;
-juce::Slider slider_353; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_353;
-juce::Slider slider_354; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_354;
-juce::Slider slider_355; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_355;
-juce::Slider slider_356; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_356;
-juce::Slider slider_357; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_357;
-juce::Slider slider_358; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_358;
-juce::Slider slider_359; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_359;
-juce::Slider slider_360; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_360;
-juce::Slider slider_361; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_361;
-juce::Slider slider_362; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_362;
-juce::Slider slider_363; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_363;
-juce::Slider slider_364; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_364;
-juce::Slider slider_365; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_365;
-juce::Slider slider_366; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_366;
-juce::Slider slider_367; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_367;
-juce::Slider slider_368; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_368;
-juce::Slider slider_369; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_369;
-juce::Slider slider_370; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_370;
-juce::Slider slider_371; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_371;
-juce::Slider slider_372; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_372;
-juce::Slider slider_373; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_373;
-juce::Slider slider_374; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_374;
-juce::Slider slider_375; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_375;
-juce::Slider slider_376; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_376;
-juce::Slider slider_377; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_377;
-juce::Slider slider_378; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_378;
-juce::Slider slider_379; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_379;
-juce::Slider slider_380; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_380;
-juce::Slider slider_381; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_381;
-juce::Slider slider_382; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_382;
-juce::Slider slider_383; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_383;
-juce::Slider slider_384; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_384;
-juce::Slider slider_385; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_385;
-juce::Slider slider_386; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_386;
-juce::Slider slider_387; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_387;
-juce::Slider slider_388; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_388;
-juce::Slider slider_389; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_389;
-juce::Slider slider_390; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_390;
-juce::Slider slider_391; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_391;
-juce::Slider slider_392; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_392;
-juce::Slider slider_393; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_393;
-juce::Slider slider_394; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_394;
-juce::Slider slider_395; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_395;
-juce::Slider slider_396; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_396;
-juce::Slider slider_397; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_397;
-juce::Slider slider_398; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_398;
-juce::Slider slider_399; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_399;
-juce::Slider slider_400; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_400;
-juce::Slider slider_401; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_401;
-juce::Slider slider_402; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_402;
-juce::Slider slider_403; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_403;
-juce::Slider slider_404; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_404;
-juce::Slider slider_405; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_405;
-juce::Slider slider_406; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_406;
-juce::Slider slider_407; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_407;
-juce::Slider slider_408; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_408;
-juce::Slider slider_409; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_409;
-juce::Slider slider_410; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_410;
-juce::Slider slider_411; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_411;
-juce::Slider slider_412; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_412;
-juce::Slider slider_413; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_413;
-juce::Slider slider_414; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_414;
-juce::Slider slider_415; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_415;
-juce::Slider slider_416; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_416;
-juce::Slider slider_417; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_417;
-juce::Slider slider_418; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_418;
-juce::Slider slider_419; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_419;
-juce::Slider slider_420; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_420;
-juce::Slider slider_421; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_421;
-juce::Slider slider_422; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_422;
-juce::Slider slider_423; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_423;
-juce::Slider slider_424; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_424;
-juce::Slider slider_425; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_425;
-juce::Slider slider_426; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_426;
-juce::Slider slider_427; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_427;
-juce::Slider slider_428; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_428;
-juce::Slider slider_429; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_429;
-juce::Slider slider_430; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_430;
-juce::Slider slider_431; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_431;
-juce::Slider slider_432; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_432;
-juce::Slider slider_433; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_433;
-juce::Slider slider_434; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_434;
-juce::Slider slider_435; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_435;
-juce::Slider slider_436; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_436;
-juce::Slider slider_437; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_437;
-juce::Slider slider_438; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_438;
-juce::Slider slider_439; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_439;
-juce::Slider slider_440; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_440;
-juce::Slider slider_441; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_441;
-juce::Slider slider_442; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_442;
-juce::Slider slider_443; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_443;
-juce::Slider slider_444; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_444;
-juce::Slider slider_445; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_445;
-juce::Slider slider_446; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_446;
-juce::Slider slider_447; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_447;
-juce::Slider slider_448; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_448;
-juce::Slider slider_449; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_449;
-juce::Slider slider_450; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_450;
-juce::Slider slider_451; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_451;
-juce::Slider slider_452; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_452;
-juce::Slider slider_453; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_453;
-juce::Slider slider_454; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_454;
-juce::Slider slider_455; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_455;
-juce::Slider slider_456; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_456;
-juce::Slider slider_457; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_457;
-juce::Slider slider_458; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_458;
-juce::Slider slider_459; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_459;
-juce::Slider slider_460; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_460;
-juce::Slider slider_461; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_461;
-juce::Slider slider_462; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_462;
-juce::Slider slider_463; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_463;
-juce::Slider slider_464; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_464;
-juce::Slider slider_465; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_465;
-juce::Slider slider_466; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_466;
-juce::Slider slider_467; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_467;
-juce::Slider slider_468; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_468;
-juce::Slider slider_469; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_469;
-juce::Slider slider_470; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_470;
-juce::Slider slider_471; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_471;
-juce::Slider slider_472; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_472;
-juce::Slider slider_473; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_473;
-juce::Slider slider_474; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_474;
-juce::Slider slider_475; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_475;
-juce::Slider slider_476; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_476;
-juce::Slider slider_477; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_477;
-juce::Slider slider_478; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_478;
-juce::Slider slider_479; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_479;
-juce::Slider slider_480; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_480;
-juce::Slider slider_481; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_481;
-juce::Slider slider_482; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_482;
-juce::Slider slider_483; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_483;
-juce::Slider slider_484; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_484;
-juce::Slider slider_485; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_485;
-juce::Slider slider_486; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_486;
-juce::Slider slider_487; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_487;
-juce::Slider slider_488; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_488;
-juce::Slider slider_489; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_489;
-juce::Slider slider_490; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_490;
-juce::Slider slider_491; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_491;
-juce::Slider slider_492; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_492;
-juce::Slider slider_493; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_493;
-juce::Slider slider_494; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_494;
-juce::Slider slider_495; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_495;
-juce::Slider slider_496; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_496;
-juce::Slider slider_497; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_497;
-juce::Slider slider_498; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_498;
-juce::Slider slider_499; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_499;
-juce::Slider slider_500; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_500;
-juce::Slider slider_501; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_501;
-juce::Slider slider_502; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_502;
-juce::Slider slider_503; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_503;
-juce::Slider slider_504; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_504;
-juce::Slider slider_505; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_505;
-juce::Slider slider_506; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_506;
-juce::Slider slider_507; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_507;
-juce::Slider slider_508; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_508;
-juce::Slider slider_509; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_509;
-juce::Slider slider_510; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_510;
-juce::Slider slider_511; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_511;
-juce::Slider slider_512; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_512;
-juce::Slider slider_513; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_513;
-juce::Slider slider_514; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_514;
-juce::Slider slider_515; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_515;
-juce::Slider slider_516; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_516;
-juce::Slider slider_517; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_517;
-juce::Slider slider_518; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_518;
-juce::Slider slider_519; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_519;
-juce::Slider slider_520; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_520;
-juce::Slider slider_521; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_521;
-juce::Slider slider_522; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_522;
-juce::Slider slider_523; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_523;
-juce::Slider slider_524; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_524;
-juce::Slider slider_525; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_525;
-juce::Slider slider_526; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_526;
-juce::Slider slider_527; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_527;
-juce::Slider slider_528; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_528;
-juce::Slider slider_529; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_529;
-juce::Slider slider_530; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_530;
-juce::Slider slider_531; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_531;
-juce::Slider slider_532; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_532;
-juce::Slider slider_533; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_533;
-juce::Slider slider_534; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_534;
-juce::Slider slider_535; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_535;
-juce::Slider slider_536; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_536;
-juce::Slider slider_537; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_537;
-juce::Slider slider_538; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_538;
-juce::Slider slider_539; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_539;
-juce::Slider slider_540; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_540;
-juce::Slider slider_541; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_541;
-juce::Slider slider_542; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_542;
-juce::Slider slider_543; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_543;
-juce::Slider slider_544; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_544;
-juce::Slider slider_545; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_545;
-juce::Slider slider_546; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_546;
-juce::Slider slider_547; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_547;
-juce::Slider slider_548; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_548;
-juce::Slider slider_549; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_549;
-juce::Slider slider_550; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_550;
-juce::Slider slider_551; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_551;
-juce::Slider slider_552; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_552;
-juce::Slider slider_553; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_553;
-juce::Slider slider_554; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_554;
-juce::Slider slider_555; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_555;
-juce::Slider slider_556; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_556;
-juce::Slider slider_557; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_557;
-juce::Slider slider_558; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_558;
-juce::Slider slider_559; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_559;
-juce::Slider slider_560; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_560;
-juce::Slider slider_561; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_561;
-juce::Slider slider_562; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_562;
-juce::Slider slider_563; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_563;
-juce::Slider slider_564; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_564;
-juce::Slider slider_565; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_565;
-juce::Slider slider_566; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_566;
-juce::Slider slider_567; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_567;
-juce::Slider slider_568; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_568;
-juce::Slider slider_569; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_569;
-juce::Slider slider_570; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_570;
-juce::Slider slider_571; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_571;
-juce::Slider slider_572; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_572;
-juce::Slider slider_573; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_573;
-juce::Slider slider_574; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_574;
-juce::Slider slider_575; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_575;
-juce::Slider slider_576; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_576;
-juce::Slider slider_577; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_577;
-juce::Slider slider_578; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_578;
-juce::Slider slider_579; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_579;
-juce::Slider slider_580; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_580;
-juce::Slider slider_581; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_581;
-juce::Slider slider_582; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_582;
-juce::Slider slider_583; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_583;
-juce::Slider slider_584; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_584;
-juce::Slider slider_585; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_585;
-juce::Slider slider_586; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_586;
-juce::Slider slider_587; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_587;
-juce::Slider slider_588; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_588;
-juce::Slider slider_589; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_589;
-juce::Slider slider_590; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_590;
-juce::Slider slider_591; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_591;
-juce::Slider slider_592; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_592;
-juce::Slider slider_593; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_593;
-juce::Slider slider_594; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_594;
-juce::Slider slider_595; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_595;
-juce::Slider slider_596; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_596;
-juce::Slider slider_597; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_597;
-juce::Slider slider_598; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_598;
-juce::Slider slider_599; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_599;
-juce::Slider slider_600; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_600;
-juce::Slider slider_601; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_601;
-juce::Slider slider_602; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_602;
-juce::Slider slider_603; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_603;
-juce::Slider slider_604; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_604;
-juce::Slider slider_605; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_605;
-juce::Slider slider_606; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_606;
-juce::Slider slider_607; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_607;
-juce::Slider slider_608; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_608;
-juce::Slider slider_609; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_609;
-juce::Slider slider_610; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_610;
-juce::Slider slider_611; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_611;
-juce::Slider slider_612; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_612;
-juce::Slider slider_613; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_613;
-juce::Slider slider_614; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_614;
-juce::Slider slider_615; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_615;
-juce::Slider slider_616; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_616;
-juce::Slider slider_617; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_617;
-juce::Slider slider_618; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_618;
-juce::Slider slider_619; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_619;
-juce::Slider slider_620; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_620;
-juce::Slider slider_621; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_621;
-juce::Slider slider_622; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_622;
-juce::Slider slider_623; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_623;
-juce::Slider slider_624; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_624;
-juce::Slider slider_625; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_625;
-juce::Slider slider_626; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_626;
-juce::Slider slider_627; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_627;
-juce::Slider slider_628; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_628;
-juce::Slider slider_629; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_629;
-juce::Slider slider_630; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_630;
-juce::Slider slider_631; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_631;
-juce::Slider slider_632; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_632;
-juce::Slider slider_633; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_633;
-juce::Slider slider_634; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_634;
-juce::Slider slider_635; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_635;
-juce::Slider slider_636; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_636;
-juce::Slider slider_637; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_637;
-juce::Slider slider_638; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_638;
-juce::Slider slider_639; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_639;
-juce::Slider slider_640; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_640;
-juce::Slider slider_641; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_641;
-juce::Slider slider_642; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_642;
-juce::Slider slider_643; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_643;
-juce::Slider slider_644; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_644;
-juce::Slider slider_645; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_645;
-juce::Slider slider_646; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_646;
-juce::Slider slider_647; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_647;
-juce::Slider slider_648; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_648;
-juce::Slider slider_649; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_649;
-juce::Slider slider_650; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_650;
-juce::Slider slider_651; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_651;
-juce::Slider slider_652; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_652;
-juce::Slider slider_653; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_653;
-juce::Slider slider_654; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_654;
-juce::Slider slider_655; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_655;
-juce::Slider slider_656; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_656;
-juce::Slider slider_657; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_657;
-juce::Slider slider_658; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_658;
-juce::Slider slider_659; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_659;
-juce::Slider slider_660; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_660;
-juce::Slider slider_661; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_661;
-juce::Slider slider_662; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_662;
-juce::Slider slider_663; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_663;
-juce::Slider slider_664; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_664;
-juce::Slider slider_665; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_665;
-juce::Slider slider_666; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_666;
-juce::Slider slider_667; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_667;
-juce::Slider slider_668; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_668;
-juce::Slider slider_669; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_669;
-juce::Slider slider_670; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_670;
-juce::Slider slider_671; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_671;
-juce::Slider slider_672; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_672;
-juce::Slider slider_673; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_673;
-juce::Slider slider_674; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_674;
-juce::Slider slider_675; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_675;
-juce::Slider slider_676; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_676;
-juce::Slider slider_677; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_677;
-juce::Slider slider_678; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_678;
-juce::Slider slider_679; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_679;
-juce::Slider slider_680; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_680;
-juce::Slider slider_681; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_681;
-juce::Slider slider_682; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_682;
-juce::Slider slider_683; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_683;
-juce::Slider slider_684; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_684;
-juce::Slider slider_685; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_685;
-juce::Slider slider_686; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_686;
-juce::Slider slider_687; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_687;
-juce::Slider slider_688; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_688;
-juce::Slider slider_689; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_689;
-juce::Slider slider_690; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_690;
-juce::Slider slider_691; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_691;
-juce::Slider slider_692; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_692;
-juce::Slider slider_693; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_693;
-juce::Slider slider_694; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_694;
-juce::Slider slider_695; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_695;
-juce::Slider slider_696; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_696;
-juce::Slider slider_697; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_697;
-juce::Slider slider_698; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_698;
-juce::Slider slider_699; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_699;
-juce::Slider slider_700; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_700;
-juce::Slider slider_701; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_701;
-juce::Slider slider_702; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_702;
-juce::Slider slider_703; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_703;
-juce::Slider slider_704; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_704;
-juce::Slider slider_705; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_705;
-juce::Slider slider_706; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_706;
-juce::Slider slider_707; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_707;
-juce::Slider slider_708; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_708;
-juce::Slider slider_709; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_709;
-juce::Slider slider_710; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_710;
-juce::Slider slider_711; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_711;
-juce::Slider slider_712; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_712;
-juce::Slider slider_713; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_713;
-juce::Slider slider_714; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_714;
-juce::Slider slider_715; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_715;
-juce::Slider slider_716; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_716;
-juce::Slider slider_717; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_717;
-juce::Slider slider_718; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_718;
-juce::Slider slider_719; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_719;
-juce::Slider slider_720; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_720;
-juce::Slider slider_721; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_721;
-juce::Slider slider_722; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_722;
-juce::Slider slider_723; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_723;
-juce::Slider slider_724; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_724;
-juce::Slider slider_725; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_725;
-juce::Slider slider_726; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_726;
-juce::Slider slider_727; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_727;
-juce::Slider slider_728; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_728;
-juce::Slider slider_729; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_729;
-juce::Slider slider_730; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_730;
-juce::Slider slider_731; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_731;
-juce::Slider slider_732; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_732;
-juce::Slider slider_733; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_733;
-juce::Slider slider_734; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_734;
-juce::Slider slider_735; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_735;
-juce::Slider slider_736; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_736;
-juce::Slider slider_737; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_737;
-juce::Slider slider_738; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_738;
-juce::Slider slider_739; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_739;
-juce::Slider slider_740; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_740;
-juce::Slider slider_741; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_741;
-juce::Slider slider_742; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_742;
-juce::Slider slider_743; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_743;
-juce::Slider slider_744; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_744;
-juce::Slider slider_745; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_745;
-juce::Slider slider_746; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_746;
-juce::Slider slider_747; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_747;
-juce::Slider slider_748; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_748;
-juce::Slider slider_749; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_749;
-juce::Slider slider_750; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_750;
-juce::Slider slider_751; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_751;
-juce::Slider slider_752; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_752;
-juce::Slider slider_753; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_753;
-juce::Slider slider_754; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_754;
-juce::Slider slider_755; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_755;
-juce::Slider slider_756; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_756;
-juce::Slider slider_757; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_757;
-juce::Slider slider_758; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_758;
-juce::Slider slider_759; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_759;
-juce::Slider slider_760; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_760;
-juce::Slider slider_761; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_761;
-juce::Slider slider_762; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_762;
-juce::Slider slider_763; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_763;
-juce::Slider slider_764; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_764;
-juce::Slider slider_765; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_765;
-juce::Slider slider_766; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_766;
-juce::Slider slider_767; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_767;
-juce::Slider slider_768; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_768;
-juce::Slider slider_769; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_769;
-juce::Slider slider_770; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_770;
-juce::Slider slider_771; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_771;
-juce::Slider slider_772; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_772;
-juce::Slider slider_773; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_773;
-juce::Slider slider_774; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_774;
-juce::Slider slider_775; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_775;
-juce::Slider slider_776; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_776;
-juce::Slider slider_777; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_777;
-juce::Slider slider_778; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_778;
-juce::Slider slider_779; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_779;
-juce::Slider slider_780; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_780;
-juce::Slider slider_781; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_781;
-juce::Slider slider_782; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_782;
-juce::Slider slider_783; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_783;
-juce::Slider slider_784; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_784;
-juce::Slider slider_785; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_785;
-juce::Slider slider_786; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_786;
-juce::Slider slider_787; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_787;
-juce::Slider slider_788; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_788;
-juce::Slider slider_789; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_789;
-juce::Slider slider_790; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_790;
-juce::Slider slider_791; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_791;
-juce::Slider slider_792; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_792;
-juce::Slider slider_793; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_793;
-juce::Slider slider_794; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_794;
-juce::Slider slider_795; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_795;
-juce::Slider slider_796; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_796;
-juce::Slider slider_797; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_797;
-juce::Slider slider_798; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_798;
-juce::Slider slider_799; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_799;
-juce::Slider slider_800; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_800;
-juce::Slider slider_801; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_801;
-juce::Slider slider_802; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_802;
-juce::Slider slider_803; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_803;
-juce::Slider slider_804; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_804;
-juce::Slider slider_805; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_805;
-juce::Slider slider_806; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_806;
-juce::Slider slider_807; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_807;
-juce::Slider slider_808; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_808;
-juce::Slider slider_809; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_809;
-juce::Slider slider_810; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_810;
-juce::Slider slider_811; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_811;
-juce::Slider slider_812; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_812;
-juce::Slider slider_813; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_813;
-juce::Slider slider_814; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_814;
-juce::Slider slider_815; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_815;
-juce::Slider slider_816; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_816;
-juce::Slider slider_817; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_817;
-juce::Slider slider_818; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_818;
-juce::Slider slider_819; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_819;
-juce::Slider slider_820; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_820;
-juce::Slider slider_821; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_821;
-juce::Slider slider_822; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_822;
-juce::Slider slider_823; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_823;
-juce::Slider slider_824; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_824;
-juce::Slider slider_825; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_825;
-juce::Slider slider_826; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_826;
-juce::Slider slider_827; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_827;
-juce::Slider slider_828; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_828;
-juce::Slider slider_829; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_829;
-juce::Slider slider_830; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_830;
-juce::Slider slider_831; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_831;
-juce::Slider slider_832; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_832;
-juce::Slider slider_833; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_833;
-juce::Slider slider_834; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_834;
-juce::Slider slider_835; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_835;
-juce::Slider slider_836; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_836;
-juce::Slider slider_837; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_837;
-juce::Slider slider_838; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_838;
-juce::Slider slider_839; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_839;
-juce::Slider slider_840; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_840;
-juce::Slider slider_841; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_841;
-juce::Slider slider_842; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_842;
-juce::Slider slider_843; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_843;
-juce::Slider slider_844; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_844;
-juce::Slider slider_845; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_845;
-juce::Slider slider_846; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_846;
-juce::Slider slider_847; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_847;
-juce::Slider slider_848; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_848;
-juce::Slider slider_849; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_849;
-juce::Slider slider_850; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_850;
-juce::Slider slider_851; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_851;
-juce::Slider slider_852; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_852;
-juce::Slider slider_853; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_853;
-juce::Slider slider_854; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_854;
-juce::Slider slider_855; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_855;
-juce::Slider slider_856; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_856;
-juce::Slider slider_857; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_857;
-juce::Slider slider_858; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_858;
-juce::Slider slider_859; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_859;
-juce::Slider slider_860; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_860;
-juce::Slider slider_861; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_861;
-juce::Slider slider_862; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_862;
-juce::Slider slider_863; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_863;
-juce::Slider slider_864; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_864;
-juce::Slider slider_865; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_865;
-juce::Slider slider_866; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_866;
-juce::Slider slider_867; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_867;
-juce::Slider slider_868; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_868;
-juce::Slider slider_869; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_869;
-juce::Slider slider_870; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_870;
-juce::Slider slider_871; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_871;
-juce::Slider slider_872; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_872;
-juce::Slider slider_873; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_873;
-juce::Slider slider_874; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_874;
-juce::Slider slider_875; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_875;
-juce::Slider slider_876; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_876;
-juce::Slider slider_877; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_877;
-juce::Slider slider_878; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_878;
-juce::Slider slider_879; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_879;
-juce::Slider slider_880; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_880;
-juce::Slider slider_881; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_881;
-juce::Slider slider_882; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_882;
-juce::Slider slider_883; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_883;
-juce::Slider slider_884; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_884;
-juce::Slider slider_885; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_885;
-juce::Slider slider_886; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_886;
-juce::Slider slider_887; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_887;
-juce::Slider slider_888; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_888;
-juce::Slider slider_889; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_889;
-juce::Slider slider_890; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_890;
-juce::Slider slider_891; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_891;
-juce::Slider slider_892; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_892;
-juce::Slider slider_893; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_893;
-juce::Slider slider_894; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_894;
-juce::Slider slider_895; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_895;
-juce::Slider slider_896; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_896;
-juce::Slider slider_897; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_897;
-juce::Slider slider_898; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_898;
-juce::Slider slider_899; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_899;
-juce::Slider slider_900; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_900;
-juce::Slider slider_901; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_901;
-juce::Slider slider_902; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_902;
-juce::Slider slider_903; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_903;
-juce::Slider slider_904; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_904;
-juce::Slider slider_905; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_905;
-juce::Slider slider_906; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_906;
-juce::Slider slider_907; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_907;
-juce::Slider slider_908; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_908;
-juce::Slider slider_909; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_909;
-juce::Slider slider_910; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_910;
-juce::Slider slider_911; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_911;
-juce::Slider slider_912; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_912;
-juce::Slider slider_913; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_913;
-juce::Slider slider_914; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_914;
-juce::Slider slider_915; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_915;
-juce::Slider slider_916; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_916;
-juce::Slider slider_917; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_917;
-juce::Slider slider_918; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_918;
-juce::Slider slider_919; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_919;
-juce::Slider slider_920; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_920;
-juce::Slider slider_921; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_921;
-juce::Slider slider_922; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_922;
-juce::Slider slider_923; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_923;
-juce::Slider slider_924; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_924;
-juce::Slider slider_925; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_925;
-juce::Slider slider_926; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_926;
-juce::Slider slider_927; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_927;
-juce::Slider slider_928; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_928;
-juce::Slider slider_929; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_929;
-juce::Slider slider_930; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_930;
-juce::Slider slider_931; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_931;
-juce::Slider slider_932; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_932;
-juce::Slider slider_933; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_933;
-juce::Slider slider_934; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_934;
-juce::Slider slider_935; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_935;
-juce::Slider slider_936; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_936;
-juce::Slider slider_937; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_937;
-juce::Slider slider_938; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_938;
-juce::Slider slider_939; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_939;
-juce::Slider slider_940; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_940;
-juce::Slider slider_941; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_941;
-juce::Slider slider_942; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_942;
-juce::Slider slider_943; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_943;
-juce::Slider slider_944; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_944;
-juce::Slider slider_945; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_945;
-juce::Slider slider_946; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_946;
-juce::Slider slider_947; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_947;
-juce::Slider slider_948; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_948;
-juce::Slider slider_949; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_949;
-juce::Slider slider_950; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_950;
-juce::Slider slider_951; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_951;
-juce::Slider slider_952; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_952;
-juce::Slider slider_953; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_953;
-juce::Slider slider_954; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_954;
-juce::Slider slider_955; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_955;
-juce::Slider slider_956; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_956;
-juce::Slider slider_957; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_957;
-juce::Slider slider_958; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_958;
-juce::Slider slider_959; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_959;
-juce::Slider slider_960; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_960;
-juce::Slider slider_961; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_961;
-juce::Slider slider_962; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_962;
-juce::Slider slider_963; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_963;
-juce::Slider slider_964; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_964;
-juce::Slider slider_965; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_965;
-juce::Slider slider_966; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_966;
-juce::Slider slider_967; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_967;
-juce::Slider slider_968; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_968;
-juce::Slider slider_969; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_969;
-juce::Slider slider_970; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_970;
-juce::Slider slider_971; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_971;
-juce::Slider slider_972; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_972;
-juce::Slider slider_973; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_973;
-juce::Slider slider_974; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_974;
-juce::Slider slider_975; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_975;
-juce::Slider slider_976; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_976;
-juce::Slider slider_977; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_977;
-juce::Slider slider_978; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_978;
-juce::Slider slider_979; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_979;
-juce::Slider slider_980; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_980;
-juce::Slider slider_981; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_981;
-juce::Slider slider_982; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_982;
-juce::Slider slider_983; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_983;
-juce::Slider slider_984; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_984;
-juce::Slider slider_985; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_985;
-juce::Slider slider_986; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_986;
-juce::Slider slider_987; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_987;
-juce::Slider slider_988; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_988;
-juce::Slider slider_989; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_989;
-juce::Slider slider_990; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_990;
-juce::Slider slider_991; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_991;
-juce::Slider slider_992; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_992;
-juce::Slider slider_993; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_993;
-juce::Slider slider_994; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_994;
-juce::Slider slider_995; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_995;
-juce::Slider slider_996; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_996;
-juce::Slider slider_997; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_997;
-juce::Slider slider_998; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_998;
-juce::Slider slider_999; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_999;
-juce::Slider slider_1000; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1000;
-juce::Slider slider_1001; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1001;
-juce::Slider slider_1002; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1002;
-juce::Slider slider_1003; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1003;
-juce::Slider slider_1004; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1004;
-juce::Slider slider_1005; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1005;
-juce::Slider slider_1006; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1006;
-juce::Slider slider_1007; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1007;
-juce::Slider slider_1008; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1008;
-juce::Slider slider_1009; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1009;
-juce::Slider slider_1010; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1010;
-juce::Slider slider_1011; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1011;
-juce::Slider slider_1012; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1012;
-juce::Slider slider_1013; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1013;
-juce::Slider slider_1014; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1014;
-juce::Slider slider_1015; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1015;
-juce::Slider slider_1016; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1016;
-juce::Slider slider_1017; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1017;
-juce::Slider slider_1018; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1018;
-juce::Slider slider_1019; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1019;
-juce::Slider slider_1020; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1020;
-juce::Slider slider_1021; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1021;
-juce::Slider slider_1022; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1022;
-juce::Slider slider_1023; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1023;
-juce::Slider slider_1024; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1024;
-juce::Slider slider_1025; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1025;
-juce::Slider slider_1026; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1026;
-juce::Slider slider_1027; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1027;
-juce::Slider slider_1028; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1028;
-juce::Slider slider_1029; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1029;
-juce::Slider slider_1030; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1030;
-juce::Slider slider_1031; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1031;
-juce::Slider slider_1032; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1032;
-juce::Slider slider_1033; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1033;
-juce::Slider slider_1034; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1034;
-juce::Slider slider_1035; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1035;
-juce::Slider slider_1036; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1036;
-juce::Slider slider_1037; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1037;
-juce::Slider slider_1038; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1038;
-juce::Slider slider_1039; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1039;
-juce::Slider slider_1040; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1040;
-juce::Slider slider_1041; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1041;
-juce::Slider slider_1042; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1042;
-juce::Slider slider_1043; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1043;
-juce::Slider slider_1044; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1044;
-juce::Slider slider_1045; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1045;
-juce::Slider slider_1046; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1046;
-juce::Slider slider_1047; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1047;
-juce::Slider slider_1048; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1048;
-juce::Slider slider_1049; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1049;
-juce::Slider slider_1050; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1050;
-juce::Slider slider_1051; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1051;
-juce::Slider slider_1052; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1052;
-juce::Slider slider_1053; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1053;
-juce::Slider slider_1054; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1054;
-juce::Slider slider_1055; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1055;
-juce::Slider slider_1056; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1056;
-juce::Slider slider_1057; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1057;
-juce::Slider slider_1058; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1058;
-juce::Slider slider_1059; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1059;
-juce::Slider slider_1060; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1060;
-juce::Slider slider_1061; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1061;
-juce::Slider slider_1062; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1062;
-juce::Slider slider_1063; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1063;
-juce::Slider slider_1064; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1064;
-juce::Slider slider_1065; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1065;
-juce::Slider slider_1066; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1066;
-juce::Slider slider_1067; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1067;
-juce::Slider slider_1068; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1068;
-juce::Slider slider_1069; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1069;
-juce::Slider slider_1070; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1070;
-juce::Slider slider_1071; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1071;
-juce::Slider slider_1072; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1072;
-juce::Slider slider_1073; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1073;
-juce::Slider slider_1074; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1074;
-juce::Slider slider_1075; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1075;
-juce::Slider slider_1076; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1076;
-juce::Slider slider_1077; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1077;
-juce::Slider slider_1078; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1078;
-juce::Slider slider_1079; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1079;
-juce::Slider slider_1080; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1080;
-juce::Slider slider_1081; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1081;
-juce::Slider slider_1082; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1082;
-juce::Slider slider_1083; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1083;
-juce::Slider slider_1084; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1084;
-juce::Slider slider_1085; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1085;
-juce::Slider slider_1086; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1086;
-juce::Slider slider_1087; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1087;
-juce::Slider slider_1088; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1088;
-juce::Slider slider_1089; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1089;
-juce::Slider slider_1090; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1090;
-juce::Slider slider_1091; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1091;
-juce::Slider slider_1092; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1092;
-juce::Slider slider_1093; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1093;
-juce::Slider slider_1094; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1094;
-juce::Slider slider_1095; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1095;
-juce::Slider slider_1096; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1096;
-juce::Slider slider_1097; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1097;
-juce::Slider slider_1098; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1098;
-juce::Slider slider_1099; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1099;
-juce::Slider slider_1100; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1100;
-juce::Slider slider_1101; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1101;
-juce::Slider slider_1102; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1102;
-juce::Slider slider_1103; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1103;
-juce::Slider slider_1104; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1104;
-juce::Slider slider_1105; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1105;
-juce::Slider slider_1106; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1106;
-juce::Slider slider_1107; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1107;
-juce::Slider slider_1108; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1108;
-juce::Slider slider_1109; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1109;
-juce::Slider slider_1110; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1110;
-juce::Slider slider_1111; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1111;
-juce::Slider slider_1112; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1112;
-juce::Slider slider_1113; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1113;
-juce::Slider slider_1114; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1114;
-juce::Slider slider_1115; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1115;
-juce::Slider slider_1116; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1116;
-juce::Slider slider_1117; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1117;
-juce::Slider slider_1118; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1118;
-juce::Slider slider_1119; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1119;
-juce::Slider slider_1120; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1120;
-juce::Slider slider_1121; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1121;
-juce::Slider slider_1122; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1122;
-juce::Slider slider_1123; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1123;
-juce::Slider slider_1124; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1124;
-juce::Slider slider_1125; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1125;
-juce::Slider slider_1126; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1126;
-juce::Slider slider_1127; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1127;
-juce::Slider slider_1128; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1128;
-juce::Slider slider_1129; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1129;
-juce::Slider slider_1130; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1130;
-juce::Slider slider_1131; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1131;
-juce::Slider slider_1132; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1132;
-juce::Slider slider_1133; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1133;
-juce::Slider slider_1134; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1134;
-juce::Slider slider_1135; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1135;
-juce::Slider slider_1136; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1136;
-juce::Slider slider_1137; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1137;
-juce::Slider slider_1138; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1138;
-juce::Slider slider_1139; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1139;
-juce::Slider slider_1140; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1140;
-juce::Slider slider_1141; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1141;
-juce::Slider slider_1142; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1142;
-juce::Slider slider_1143; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1143;
-juce::Slider slider_1144; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1144;
-juce::Slider slider_1145; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1145;
-juce::Slider slider_1146; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1146;
-juce::Slider slider_1147; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1147;
-juce::Slider slider_1148; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1148;
-juce::Slider slider_1149; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1149;
-juce::Slider slider_1150; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1150;
-juce::Slider slider_1151; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1151;
-juce::Slider slider_1152; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1152;
-juce::Slider slider_1153; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1153;
-juce::Slider slider_1154; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1154;
-juce::Slider slider_1155; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1155;
-juce::Slider slider_1156; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1156;
-juce::Slider slider_1157; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1157;
-juce::Slider slider_1158; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1158;
-juce::Slider slider_1159; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1159;
-juce::Slider slider_1160; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1160;
-juce::Slider slider_1161; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1161;
-juce::Slider slider_1162; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1162;
-juce::Slider slider_1163; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1163;
-juce::Slider slider_1164; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1164;
-juce::Slider slider_1165; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1165;
-juce::Slider slider_1166; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1166;
-juce::Slider slider_1167; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1167;
-juce::Slider slider_1168; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1168;
-juce::Slider slider_1169; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1169;
-juce::Slider slider_1170; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1170;
-juce::Slider slider_1171; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1171;
-juce::Slider slider_1172; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1172;
-juce::Slider slider_1173; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1173;
-juce::Slider slider_1174; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1174;
-juce::Slider slider_1175; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1175;
-juce::Slider slider_1176; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1176;
-juce::Slider slider_1177; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1177;
-juce::Slider slider_1178; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1178;
-juce::Slider slider_1179; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1179;
-juce::Slider slider_1180; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1180;
-juce::Slider slider_1181; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1181;
-juce::Slider slider_1182; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1182;
-juce::Slider slider_1183; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1183;
-juce::Slider slider_1184; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1184;
-juce::Slider slider_1185; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1185;
-juce::Slider slider_1186; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1186;
-juce::Slider slider_1187; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1187;
-juce::Slider slider_1188; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1188;
-juce::Slider slider_1189; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1189;
-juce::Slider slider_1190; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1190;
-juce::Slider slider_1191; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1191;
-juce::Slider slider_1192; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1192;
-juce::Slider slider_1193; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1193;
-juce::Slider slider_1194; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1194;
-juce::Slider slider_1195; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1195;
-juce::Slider slider_1196; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1196;
-juce::Slider slider_1197; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1197;
-juce::Slider slider_1198; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1198;
-juce::Slider slider_1199; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1199;
-juce::Slider slider_1200; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1200;
-juce::Slider slider_1201; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1201;
-juce::Slider slider_1202; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1202;
-juce::Slider slider_1203; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1203;
-juce::Slider slider_1204; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1204;
-juce::Slider slider_1205; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1205;
-juce::Slider slider_1206; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1206;
-juce::Slider slider_1207; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1207;
-juce::Slider slider_1208; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1208;
-juce::Slider slider_1209; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1209;
-juce::Slider slider_1210; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1210;
-juce::Slider slider_1211; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1211;
-juce::Slider slider_1212; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1212;
-juce::Slider slider_1213; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1213;
-juce::Slider slider_1214; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1214;
-juce::Slider slider_1215; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1215;
-juce::Slider slider_1216; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1216;
-juce::Slider slider_1217; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1217;
-juce::Slider slider_1218; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1218;
-juce::Slider slider_1219; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1219;
-juce::Slider slider_1220; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1220;
-juce::Slider slider_1221; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1221;
-juce::Slider slider_1222; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1222;
-juce::Slider slider_1223; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1223;
-juce::Slider slider_1224; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1224;
-juce::Slider slider_1225; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1225;
-juce::Slider slider_1226; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1226;
-juce::Slider slider_1227; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1227;
-juce::Slider slider_1228; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1228;
-juce::Slider slider_1229; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1229;
-juce::Slider slider_1230; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1230;
-juce::Slider slider_1231; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1231;
-juce::Slider slider_1232; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1232;
-juce::Slider slider_1233; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1233;
-juce::Slider slider_1234; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1234;
-juce::Slider slider_1235; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1235;
-juce::Slider slider_1236; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1236;
-juce::Slider slider_1237; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1237;
-juce::Slider slider_1238; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1238;
-juce::Slider slider_1239; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1239;
-juce::Slider slider_1240; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1240;
-juce::Slider slider_1241; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1241;
-juce::Slider slider_1242; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1242;
-juce::Slider slider_1243; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1243;
-juce::Slider slider_1244; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1244;
-juce::Slider slider_1245; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1245;
-juce::Slider slider_1246; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1246;
-juce::Slider slider_1247; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1247;
-juce::Slider slider_1248; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1248;
-juce::Slider slider_1249; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1249;
-juce::Slider slider_1250; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1250;
-juce::Slider slider_1251; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1251;
-juce::Slider slider_1252; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1252;
-juce::Slider slider_1253; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1253;
-juce::Slider slider_1254; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1254;
-juce::Slider slider_1255; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1255;
-juce::Slider slider_1256; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1256;
-juce::Slider slider_1257; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1257;
-juce::Slider slider_1258; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1258;
-juce::Slider slider_1259; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1259;
-juce::Slider slider_1260; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1260;
-juce::Slider slider_1261; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1261;
-juce::Slider slider_1262; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1262;
-juce::Slider slider_1263; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1263;
-juce::Slider slider_1264; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1264;
-juce::Slider slider_1265; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1265;
-juce::Slider slider_1266; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1266;
-juce::Slider slider_1267; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1267;
-juce::Slider slider_1268; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1268;
-juce::Slider slider_1269; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1269;
-juce::Slider slider_1270; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1270;
-juce::Slider slider_1271; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1271;
-juce::Slider slider_1272; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1272;
-juce::Slider slider_1273; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1273;
-juce::Slider slider_1274; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1274;
-juce::Slider slider_1275; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1275;
-juce::Slider slider_1276; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1276;
-juce::Slider slider_1277; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1277;
-juce::Slider slider_1278; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1278;
-juce::Slider slider_1279; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1279;
-juce::Slider slider_1280; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1280;
-juce::Slider slider_1281; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1281;
-juce::Slider slider_1282; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1282;
-juce::Slider slider_1283; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1283;
-juce::Slider slider_1284; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1284;
-juce::Slider slider_1285; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1285;
-juce::Slider slider_1286; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1286;
-juce::Slider slider_1287; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1287;
-juce::Slider slider_1288; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1288;
-juce::Slider slider_1289; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1289;
-juce::Slider slider_1290; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1290;
-juce::Slider slider_1291; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1291;
-juce::Slider slider_1292; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1292;
-juce::Slider slider_1293; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1293;
-juce::Slider slider_1294; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1294;
-juce::Slider slider_1295; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1295;
-juce::Slider slider_1296; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1296;
-juce::Slider slider_1297; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1297;
-juce::Slider slider_1298; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1298;
-juce::Slider slider_1299; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1299;
-juce::Slider slider_1300; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1300;
-juce::Slider slider_1301; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1301;
-juce::Slider slider_1302; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1302;
-juce::Slider slider_1303; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1303;
-juce::Slider slider_1304; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1304;
-juce::Slider slider_1305; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1305;
-juce::Slider slider_1306; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1306;
-juce::Slider slider_1307; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1307;
-juce::Slider slider_1308; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1308;
-juce::Slider slider_1309; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1309;
-juce::Slider slider_1310; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1310;
-juce::Slider slider_1311; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1311;
-juce::Slider slider_1312; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1312;
-juce::Slider slider_1313; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1313;
-juce::Slider slider_1314; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1314;
-juce::Slider slider_1315; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1315;
-juce::Slider slider_1316; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1316;
-juce::Slider slider_1317; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1317;
-juce::Slider slider_1318; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1318;
-juce::Slider slider_1319; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1319;
-juce::Slider slider_1320; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1320;
-juce::Slider slider_1321; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1321;
-juce::Slider slider_1322; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1322;
-juce::Slider slider_1323; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1323;
-juce::Slider slider_1324; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1324;
-juce::Slider slider_1325; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1325;
-juce::Slider slider_1326; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1326;
-juce::Slider slider_1327; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1327;
-juce::Slider slider_1328; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1328;
-juce::Slider slider_1329; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1329;
-juce::Slider slider_1330; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1330;
-juce::Slider slider_1331; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1331;
-juce::Slider slider_1332; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1332;
-juce::Slider slider_1333; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1333;
-juce::Slider slider_1334; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1334;
-juce::Slider slider_1335; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1335;
-juce::Slider slider_1336; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1336;
-juce::Slider slider_1337; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1337;
-juce::Slider slider_1338; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1338;
-juce::Slider slider_1339; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1339;
-juce::Slider slider_1340; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1340;
-juce::Slider slider_1341; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1341;
-juce::Slider slider_1342; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1342;
-juce::Slider slider_1343; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1343;
-juce::Slider slider_1344; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1344;
-juce::Slider slider_1345; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1345;
-juce::Slider slider_1346; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1346;
-juce::Slider slider_1347; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1347;
-juce::Slider slider_1348; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1348;
-juce::Slider slider_1349; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1349;
-juce::Slider slider_1350; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1350;
-juce::Slider slider_1351; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1351;
-juce::Slider slider_1352; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1352;
-juce::Slider slider_1353; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1353;
-juce::Slider slider_1354; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1354;
-juce::Slider slider_1355; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1355;
-juce::Slider slider_1356; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1356;
-juce::Slider slider_1357; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1357;
-juce::Slider slider_1358; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1358;
-juce::Slider slider_1359; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1359;
-juce::Slider slider_1360; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1360;
-juce::Slider slider_1361; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1361;
-juce::Slider slider_1362; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1362;
-juce::Slider slider_1363; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1363;
-juce::Slider slider_1364; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1364;
-juce::Slider slider_1365; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1365;
-juce::Slider slider_1366; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1366;
-juce::Slider slider_1367; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1367;
-juce::Slider slider_1368; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1368;
-juce::Slider slider_1369; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1369;
-juce::Slider slider_1370; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1370;
-juce::Slider slider_1371; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1371;
-juce::Slider slider_1372; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1372;
-juce::Slider slider_1373; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1373;
-juce::Slider slider_1374; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1374;
-juce::Slider slider_1375; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1375;
-juce::Slider slider_1376; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1376;
-juce::Slider slider_1377; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1377;
-juce::Slider slider_1378; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1378;
-juce::Slider slider_1379; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1379;
-juce::Slider slider_1380; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1380;
-juce::Slider slider_1381; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1381;
-juce::Slider slider_1382; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1382;
-juce::Slider slider_1383; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1383;
-juce::Slider slider_1384; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1384;
-juce::Slider slider_1385; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1385;
-juce::Slider slider_1386; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1386;
-juce::Slider slider_1387; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1387;
-juce::Slider slider_1388; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1388;
-juce::Slider slider_1389; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1389;
-juce::Slider slider_1390; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1390;
-juce::Slider slider_1391; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1391;
-juce::Slider slider_1392; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1392;
-juce::Slider slider_1393; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1393;
-juce::Slider slider_1394; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1394;
-juce::Slider slider_1395; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1395;
-juce::Slider slider_1396; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1396;
-juce::Slider slider_1397; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1397;
-juce::Slider slider_1398; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1398;
-juce::Slider slider_1399; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1399;
-juce::Slider slider_1400; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1400;
-juce::Slider slider_1401; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1401;
-juce::Slider slider_1402; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1402;
-juce::Slider slider_1403; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1403;
-juce::Slider slider_1404; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1404;
-juce::Slider slider_1405; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1405;
-juce::Slider slider_1406; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1406;
-juce::Slider slider_1407; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1407;
-juce::Slider slider_1408; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1408;
-juce::Slider slider_1409; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1409;
-juce::Slider slider_1410; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1410;
-juce::Slider slider_1411; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1411;
-juce::Slider slider_1412; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1412;
-juce::Slider slider_1413; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1413;
-juce::Slider slider_1414; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1414;
-juce::Slider slider_1415; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1415;
-juce::Slider slider_1416; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1416;
-juce::Slider slider_1417; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1417;
-juce::Slider slider_1418; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1418;
-juce::Slider slider_1419; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1419;
-juce::Slider slider_1420; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1420;
-juce::Slider slider_1421; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1421;
-juce::Slider slider_1422; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1422;
-juce::Slider slider_1423; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1423;
-juce::Slider slider_1424; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1424;
-juce::Slider slider_1425; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1425;
-juce::Slider slider_1426; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1426;
-juce::Slider slider_1427; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1427;
-juce::Slider slider_1428; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1428;
-juce::Slider slider_1429; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1429;
-juce::Slider slider_1430; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1430;
-juce::Slider slider_1431; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1431;
-juce::Slider slider_1432; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1432;
-juce::Slider slider_1433; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1433;
-juce::Slider slider_1434; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1434;
-juce::Slider slider_1435; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1435;
-juce::Slider slider_1436; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1436;
-juce::Slider slider_1437; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1437;
-juce::Slider slider_1438; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1438;
-juce::Slider slider_1439; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1439;
-juce::Slider slider_1440; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1440;
-juce::Slider slider_1441; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1441;
-juce::Slider slider_1442; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1442;
-juce::Slider slider_1443; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1443;
-juce::Slider slider_1444; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1444;
-juce::Slider slider_1445; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1445;
-juce::Slider slider_1446; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1446;
-juce::Slider slider_1447; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1447;
-juce::Slider slider_1448; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1448;
-juce::Slider slider_1449; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1449;
-juce::Slider slider_1450; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1450;
-juce::Slider slider_1451; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1451;
-juce::Slider slider_1452; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1452;
-juce::Slider slider_1453; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1453;
-juce::Slider slider_1454; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1454;
-juce::Slider slider_1455; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1455;
-juce::Slider slider_1456; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1456;
-juce::Slider slider_1457; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1457;
-juce::Slider slider_1458; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1458;
-juce::Slider slider_1459; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1459;
-juce::Slider slider_1460; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1460;
-juce::Slider slider_1461; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1461;
-juce::Slider slider_1462; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1462;
-juce::Slider slider_1463; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1463;
-juce::Slider slider_1464; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1464;
-juce::Slider slider_1465; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1465;
-juce::Slider slider_1466; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1466;
-juce::Slider slider_1467; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1467;
-juce::Slider slider_1468; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1468;
-juce::Slider slider_1469; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1469;
-juce::Slider slider_1470; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1470;
-juce::Slider slider_1471; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1471;
-juce::Slider slider_1472; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1472;
-juce::Slider slider_1473; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1473;
-juce::Slider slider_1474; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1474;
-juce::Slider slider_1475; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1475;
-juce::Slider slider_1476; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1476;
-juce::Slider slider_1477; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1477;
-juce::Slider slider_1478; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1478;
-juce::Slider slider_1479; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1479;
-juce::Slider slider_1480; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1480;
-juce::Slider slider_1481; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1481;
-juce::Slider slider_1482; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1482;
-juce::Slider slider_1483; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1483;
-juce::Slider slider_1484; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1484;
-juce::Slider slider_1485; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1485;
-juce::Slider slider_1486; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1486;
-juce::Slider slider_1487; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1487;
-juce::Slider slider_1488; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1488;
-juce::Slider slider_1489; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1489;
-juce::Slider slider_1490; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1490;
-juce::Slider slider_1491; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1491;
-juce::Slider slider_1492; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1492;
-juce::Slider slider_1493; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1493;
-juce::Slider slider_1494; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1494;
-juce::Slider slider_1495; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1495;
-juce::Slider slider_1496; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1496;
-juce::Slider slider_1497; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1497;
-juce::Slider slider_1498; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1498;
-juce::Slider slider_1499; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1499;
-juce::Slider slider_1500; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1500;
-juce::Slider slider_1501; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1501;
-juce::Slider slider_1502; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1502;
-juce::Slider slider_1503; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1503;
-juce::Slider slider_1504; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1504;
-juce::Slider slider_1505; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1505;
-juce::Slider slider_1506; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1506;
-juce::Slider slider_1507; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1507;
-juce::Slider slider_1508; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1508;
-juce::Slider slider_1509; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1509;
-juce::Slider slider_1510; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1510;
-juce::Slider slider_1511; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1511;
-juce::Slider slider_1512; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1512;
-juce::Slider slider_1513; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1513;
-juce::Slider slider_1514; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1514;
-juce::Slider slider_1515; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1515;
-juce::Slider slider_1516; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1516;
-juce::Slider slider_1517; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1517;
-juce::Slider slider_1518; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1518;
-juce::Slider slider_1519; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1519;
-juce::Slider slider_1520; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1520;
-juce::Slider slider_1521; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1521;
-juce::Slider slider_1522; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1522;
-juce::Slider slider_1523; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1523;
-juce::Slider slider_1524; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1524;
-juce::Slider slider_1525; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1525;
-juce::Slider slider_1526; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1526;
-juce::Slider slider_1527; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1527;
-juce::Slider slider_1528; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1528;
-juce::Slider slider_1529; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1529;
-juce::Slider slider_1530; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1530;
-juce::Slider slider_1531; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1531;
-juce::Slider slider_1532; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1532;
-juce::Slider slider_1533; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1533;
-juce::Slider slider_1534; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1534;
-juce::Slider slider_1535; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1535;
-juce::Slider slider_1536; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1536;
-juce::Slider slider_1537; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1537;
-juce::Slider slider_1538; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1538;
-juce::Slider slider_1539; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1539;
-juce::Slider slider_1540; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1540;
-juce::Slider slider_1541; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1541;
-juce::Slider slider_1542; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1542;
-juce::Slider slider_1543; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1543;
-juce::Slider slider_1544; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1544;
-juce::Slider slider_1545; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1545;
-juce::Slider slider_1546; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1546;
-juce::Slider slider_1547; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1547;
-juce::Slider slider_1548; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1548;
-juce::Slider slider_1549; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1549;
-juce::Slider slider_1550; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1550;
-juce::Slider slider_1551; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1551;
-juce::Slider slider_1552; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1552;
-juce::Slider slider_1553; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1553;
-juce::Slider slider_1554; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1554;
-juce::Slider slider_1555; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1555;
-juce::Slider slider_1556; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1556;
-juce::Slider slider_1557; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1557;
-juce::Slider slider_1558; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1558;
-juce::Slider slider_1559; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1559;
-juce::Slider slider_1560; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1560;
-juce::Slider slider_1561; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1561;
-juce::Slider slider_1562; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1562;
-juce::Slider slider_1563; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1563;
-juce::Slider slider_1564; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1564;
-juce::Slider slider_1565; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1565;
-juce::Slider slider_1566; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1566;
-juce::Slider slider_1567; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1567;
-juce::Slider slider_1568; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1568;
-juce::Slider slider_1569; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1569;
-juce::Slider slider_1570; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1570;
-juce::Slider slider_1571; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1571;
-juce::Slider slider_1572; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1572;
-juce::Slider slider_1573; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1573;
-juce::Slider slider_1574; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1574;
-juce::Slider slider_1575; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1575;
-juce::Slider slider_1576; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1576;
-juce::Slider slider_1577; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1577;
-juce::Slider slider_1578; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1578;
-juce::Slider slider_1579; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1579;
-juce::Slider slider_1580; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1580;
-juce::Slider slider_1581; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1581;
-juce::Slider slider_1582; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1582;
-juce::Slider slider_1583; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1583;
-juce::Slider slider_1584; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1584;
-juce::Slider slider_1585; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1585;
-juce::Slider slider_1586; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1586;
-juce::Slider slider_1587; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1587;
-juce::Slider slider_1588; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1588;
-juce::Slider slider_1589; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1589;
-juce::Slider slider_1590; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1590;
-juce::Slider slider_1591; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1591;
-juce::Slider slider_1592; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1592;
-juce::Slider slider_1593; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1593;
-juce::Slider slider_1594; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1594;
-juce::Slider slider_1595; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1595;
-juce::Slider slider_1596; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1596;
-juce::Slider slider_1597; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1597;
-juce::Slider slider_1598; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1598;
-juce::Slider slider_1599; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1599;
-juce::Slider slider_1600; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1600;
-juce::Slider slider_1601; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1601;
-juce::Slider slider_1602; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1602;
-juce::Slider slider_1603; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1603;
-juce::Slider slider_1604; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1604;
-juce::Slider slider_1605; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1605;
-juce::Slider slider_1606; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1606;
-juce::Slider slider_1607; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1607;
-juce::Slider slider_1608; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1608;
-juce::Slider slider_1609; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1609;
-juce::Slider slider_1610; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1610;
-juce::Slider slider_1611; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1611;
-juce::Slider slider_1612; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1612;
-juce::Slider slider_1613; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1613;
-juce::Slider slider_1614; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1614;
-juce::Slider slider_1615; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1615;
-juce::Slider slider_1616; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1616;
-juce::Slider slider_1617; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1617;
-juce::Slider slider_1618; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1618;
-juce::Slider slider_1619; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1619;
-juce::Slider slider_1620; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1620;
-juce::Slider slider_1621; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1621;
-juce::Slider slider_1622; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1622;
-juce::Slider slider_1623; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1623;
-juce::Slider slider_1624; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1624;
-juce::Slider slider_1625; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1625;
-juce::Slider slider_1626; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1626;
-juce::Slider slider_1627; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1627;
-juce::Slider slider_1628; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1628;
-juce::Slider slider_1629; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1629;
-juce::Slider slider_1630; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1630;
-juce::Slider slider_1631; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1631;
-juce::Slider slider_1632; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1632;
-juce::Slider slider_1633; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1633;
-juce::Slider slider_1634; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1634;
-juce::Slider slider_1635; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1635;
-juce::Slider slider_1636; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1636;
-juce::Slider slider_1637; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1637;
-juce::Slider slider_1638; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1638;
-juce::Slider slider_1639; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1639;
-juce::Slider slider_1640; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1640;
-juce::Slider slider_1641; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1641;
-juce::Slider slider_1642; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1642;
-juce::Slider slider_1643; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1643;
-juce::Slider slider_1644; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1644;
-juce::Slider slider_1645; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1645;
-juce::Slider slider_1646; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1646;
-juce::Slider slider_1647; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1647;
-juce::Slider slider_1648; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1648;
-juce::Slider slider_1649; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1649;
-juce::Slider slider_1650; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1650;
-juce::Slider slider_1651; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1651;
-juce::Slider slider_1652; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1652;
-juce::Slider slider_1653; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1653;
-juce::Slider slider_1654; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1654;
-juce::Slider slider_1655; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1655;
-juce::Slider slider_1656; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1656;
-juce::Slider slider_1657; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1657;
-juce::Slider slider_1658; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1658;
-juce::Slider slider_1659; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1659;
-juce::Slider slider_1660; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1660;
-juce::Slider slider_1661; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1661;
-juce::Slider slider_1662; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1662;
-juce::Slider slider_1663; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1663;
-juce::Slider slider_1664; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1664;
-juce::Slider slider_1665; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1665;
-juce::Slider slider_1666; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1666;
-juce::Slider slider_1667; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1667;
-juce::Slider slider_1668; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1668;
-juce::Slider slider_1669; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1669;
-juce::Slider slider_1670; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1670;
-juce::Slider slider_1671; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1671;
-juce::Slider slider_1672; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1672;
-juce::Slider slider_1673; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1673;
-juce::Slider slider_1674; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1674;
-juce::Slider slider_1675; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1675;
-juce::Slider slider_1676; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1676;
-juce::Slider slider_1677; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1677;
-juce::Slider slider_1678; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1678;
-juce::Slider slider_1679; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1679;
-juce::Slider slider_1680; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1680;
-juce::Slider slider_1681; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1681;
-juce::Slider slider_1682; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1682;
-juce::Slider slider_1683; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1683;
-juce::Slider slider_1684; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1684;
-juce::Slider slider_1685; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1685;
-juce::Slider slider_1686; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1686;
-juce::Slider slider_1687; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1687;
-juce::Slider slider_1688; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1688;
-juce::Slider slider_1689; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1689;
-juce::Slider slider_1690; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1690;
-juce::Slider slider_1691; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1691;
-juce::Slider slider_1692; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1692;
-juce::Slider slider_1693; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1693;
-juce::Slider slider_1694; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1694;
-juce::Slider slider_1695; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1695;
-juce::Slider slider_1696; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1696;
-juce::Slider slider_1697; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1697;
-juce::Slider slider_1698; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1698;
-juce::Slider slider_1699; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1699;
-juce::Slider slider_1700; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1700;
-juce::Slider slider_1701; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1701;
-juce::Slider slider_1702; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1702;
-juce::Slider slider_1703; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1703;
-juce::Slider slider_1704; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1704;
-juce::Slider slider_1705; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1705;
-juce::Slider slider_1706; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1706;
-juce::Slider slider_1707; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1707;
-juce::Slider slider_1708; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1708;
-juce::Slider slider_1709; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1709;
-juce::Slider slider_1710; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1710;
-juce::Slider slider_1711; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1711;
-juce::Slider slider_1712; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1712;
-juce::Slider slider_1713; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1713;
-juce::Slider slider_1714; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1714;
-juce::Slider slider_1715; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1715;
-juce::Slider slider_1716; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1716;
-juce::Slider slider_1717; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1717;
-juce::Slider slider_1718; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1718;
-juce::Slider slider_1719; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1719;
-juce::Slider slider_1720; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1720;
-juce::Slider slider_1721; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1721;
-juce::Slider slider_1722; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1722;
-juce::Slider slider_1723; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1723;
-juce::Slider slider_1724; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1724;
-juce::Slider slider_1725; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1725;
-juce::Slider slider_1726; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1726;
-juce::Slider slider_1727; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1727;
-juce::Slider slider_1728; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1728;
-juce::Slider slider_1729; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1729;
-juce::Slider slider_1730; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1730;
-juce::Slider slider_1731; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1731;
-juce::Slider slider_1732; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1732;
-juce::Slider slider_1733; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1733;
-juce::Slider slider_1734; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1734;
-juce::Slider slider_1735; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1735;
-juce::Slider slider_1736; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1736;
-juce::Slider slider_1737; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1737;
-juce::Slider slider_1738; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1738;
-juce::Slider slider_1739; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1739;
-juce::Slider slider_1740; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1740;
-juce::Slider slider_1741; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1741;
-juce::Slider slider_1742; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1742;
-juce::Slider slider_1743; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1743;
-juce::Slider slider_1744; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1744;
-juce::Slider slider_1745; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1745;
-juce::Slider slider_1746; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1746;
-juce::Slider slider_1747; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1747;
-juce::Slider slider_1748; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1748;
-juce::Slider slider_1749; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1749;
-juce::Slider slider_1750; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1750;
-juce::Slider slider_1751; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1751;
-juce::Slider slider_1752; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1752;
-juce::Slider slider_1753; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1753;
-juce::Slider slider_1754; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1754;
-juce::Slider slider_1755; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1755;
-juce::Slider slider_1756; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1756;
-juce::Slider slider_1757; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1757;
-juce::Slider slider_1758; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1758;
-juce::Slider slider_1759; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1759;
-juce::Slider slider_1760; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1760;
-juce::Slider slider_1761; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1761;
-juce::Slider slider_1762; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1762;
-juce::Slider slider_1763; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1763;
-juce::Slider slider_1764; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1764;
-juce::Slider slider_1765; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1765;
-juce::Slider slider_1766; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1766;
-juce::Slider slider_1767; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1767;
-juce::Slider slider_1768; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1768;
-juce::Slider slider_1769; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1769;
-juce::Slider slider_1770; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1770;
-juce::Slider slider_1771; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1771;
-juce::Slider slider_1772; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1772;
-juce::Slider slider_1773; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1773;
-juce::Slider slider_1774; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1774;
-juce::Slider slider_1775; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1775;
-juce::Slider slider_1776; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1776;
-juce::Slider slider_1777; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1777;
-juce::Slider slider_1778; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1778;
-juce::Slider slider_1779; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1779;
-juce::Slider slider_1780; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1780;
-juce::Slider slider_1781; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1781;
-juce::Slider slider_1782; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1782;
-juce::Slider slider_1783; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1783;
-juce::Slider slider_1784; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1784;
-juce::Slider slider_1785; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1785;
-juce::Slider slider_1786; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1786;
-juce::Slider slider_1787; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1787;
-juce::Slider slider_1788; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1788;
-juce::Slider slider_1789; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1789;
-juce::Slider slider_1790; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1790;
-juce::Slider slider_1791; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1791;
-juce::Slider slider_1792; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1792;
-juce::Slider slider_1793; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1793;
-juce::Slider slider_1794; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1794;
-juce::Slider slider_1795; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1795;
-juce::Slider slider_1796; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1796;
-juce::Slider slider_1797; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1797;
-juce::Slider slider_1798; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1798;
-juce::Slider slider_1799; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1799;
-juce::Slider slider_1800; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1800;
-juce::Slider slider_1801; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1801;
-juce::Slider slider_1802; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1802;
-juce::Slider slider_1803; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1803;
-juce::Slider slider_1804; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1804;
-juce::Slider slider_1805; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1805;
-juce::Slider slider_1806; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1806;
-juce::Slider slider_1807; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1807;
-juce::Slider slider_1808; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1808;
-juce::Slider slider_1809; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1809;
-juce::Slider slider_1810; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1810;
-juce::Slider slider_1811; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1811;
-juce::Slider slider_1812; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1812;
-juce::Slider slider_1813; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1813;
-juce::Slider slider_1814; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1814;
-juce::Slider slider_1815; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1815;
-juce::Slider slider_1816; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1816;
-juce::Slider slider_1817; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1817;
-juce::Slider slider_1818; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1818;
-juce::Slider slider_1819; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1819;
-juce::Slider slider_1820; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1820;
-juce::Slider slider_1821; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1821;
-juce::Slider slider_1822; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1822;
-juce::Slider slider_1823; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1823;
-juce::Slider slider_1824; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1824;
-juce::Slider slider_1825; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1825;
-juce::Slider slider_1826; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1826;
-juce::Slider slider_1827; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1827;
-juce::Slider slider_1828; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1828;
-juce::Slider slider_1829; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1829;
-juce::Slider slider_1830; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1830;
-juce::Slider slider_1831; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1831;
-juce::Slider slider_1832; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1832;
-juce::Slider slider_1833; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1833;
-juce::Slider slider_1834; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1834;
-juce::Slider slider_1835; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1835;
-juce::Slider slider_1836; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1836;
-juce::Slider slider_1837; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1837;
-juce::Slider slider_1838; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1838;
-juce::Slider slider_1839; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1839;
-juce::Slider slider_1840; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1840;
-juce::Slider slider_1841; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1841;
-juce::Slider slider_1842; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1842;
-juce::Slider slider_1843; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1843;
-juce::Slider slider_1844; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1844;
-juce::Slider slider_1845; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1845;
-juce::Slider slider_1846; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1846;
-juce::Slider slider_1847; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1847;
-juce::Slider slider_1848; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1848;
-juce::Slider slider_1849; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1849;
-juce::Slider slider_1850; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1850;
-juce::Slider slider_1851; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1851;
-juce::Slider slider_1852; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1852;
-juce::Slider slider_1853; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1853;
-juce::Slider slider_1854; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1854;
-juce::Slider slider_1855; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1855;
-juce::Slider slider_1856; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1856;
-juce::Slider slider_1857; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1857;
-juce::Slider slider_1858; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1858;
-juce::Slider slider_1859; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1859;
-juce::Slider slider_1860; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1860;
-juce::Slider slider_1861; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1861;
-juce::Slider slider_1862; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1862;
-juce::Slider slider_1863; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1863;
-juce::Slider slider_1864; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1864;
-juce::Slider slider_1865; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1865;
-juce::Slider slider_1866; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1866;
-juce::Slider slider_1867; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1867;
-juce::Slider slider_1868; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1868;
-juce::Slider slider_1869; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1869;
-juce::Slider slider_1870; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1870;
-juce::Slider slider_1871; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1871;
-juce::Slider slider_1872; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1872;
-juce::Slider slider_1873; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1873;
-juce::Slider slider_1874; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1874;
-juce::Slider slider_1875; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1875;
-juce::Slider slider_1876; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1876;
-juce::Slider slider_1877; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1877;
-juce::Slider slider_1878; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1878;
-juce::Slider slider_1879; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1879;
-juce::Slider slider_1880; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1880;
-juce::Slider slider_1881; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1881;
-juce::Slider slider_1882; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1882;
-juce::Slider slider_1883; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1883;
-juce::Slider slider_1884; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1884;
-juce::Slider slider_1885; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1885;
-juce::Slider slider_1886; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1886;
-juce::Slider slider_1887; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1887;
-juce::Slider slider_1888; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1888;
-juce::Slider slider_1889; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1889;
-juce::Slider slider_1890; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1890;
-juce::Slider slider_1891; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1891;
-juce::Slider slider_1892; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1892;
-juce::Slider slider_1893; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1893;
-juce::Slider slider_1894; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1894;
-juce::Slider slider_1895; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1895;
-juce::Slider slider_1896; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1896;
-juce::Slider slider_1897; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1897;
-juce::Slider slider_1898; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1898;
-juce::Slider slider_1899; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1899;
-juce::Slider slider_1900; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1900;
-juce::Slider slider_1901; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1901;
-juce::Slider slider_1902; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1902;
-juce::Slider slider_1903; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1903;
-juce::Slider slider_1904; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1904;
-juce::Slider slider_1905; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1905;
-juce::Slider slider_1906; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1906;
-juce::Slider slider_1907; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1907;
-juce::Slider slider_1908; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1908;
-juce::Slider slider_1909; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1909;
-juce::Slider slider_1910; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1910;
-juce::Slider slider_1911; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1911;
-juce::Slider slider_1912; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1912;
-juce::Slider slider_1913; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1913;
-juce::Slider slider_1914; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1914;
-juce::Slider slider_1915; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1915;
-juce::Slider slider_1916; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1916;
-juce::Slider slider_1917; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1917;
-juce::Slider slider_1918; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1918;
-juce::Slider slider_1919; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1919;
-juce::Slider slider_1920; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1920;
-juce::Slider slider_1921; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1921;
-juce::Slider slider_1922; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1922;
-juce::Slider slider_1923; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1923;
-juce::Slider slider_1924; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1924;
-juce::Slider slider_1925; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1925;
-juce::Slider slider_1926; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1926;
-juce::Slider slider_1927; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1927;
-juce::Slider slider_1928; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1928;
-juce::Slider slider_1929; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1929;
-juce::Slider slider_1930; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1930;
-juce::Slider slider_1931; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1931;
-juce::Slider slider_1932; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1932;
-juce::Slider slider_1933; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1933;
-juce::Slider slider_1934; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1934;
-juce::Slider slider_1935; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1935;
-juce::Slider slider_1936; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1936;
-juce::Slider slider_1937; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1937;
-juce::Slider slider_1938; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1938;
-juce::Slider slider_1939; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1939;
-juce::Slider slider_1940; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1940;
-juce::Slider slider_1941; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1941;
-juce::Slider slider_1942; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1942;
-juce::Slider slider_1943; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1943;
-juce::Slider slider_1944; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1944;
-juce::Slider slider_1945; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1945;
-juce::Slider slider_1946; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1946;
-juce::Slider slider_1947; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1947;
-juce::Slider slider_1948; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1948;
-juce::Slider slider_1949; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1949;
-juce::Slider slider_1950; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1950;
-juce::Slider slider_1951; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1951;
-juce::Slider slider_1952; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1952;
-juce::Slider slider_1953; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1953;
-juce::Slider slider_1954; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1954;
-juce::Slider slider_1955; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1955;
-juce::Slider slider_1956; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1956;
-juce::Slider slider_1957; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1957;
-juce::Slider slider_1958; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1958;
-juce::Slider slider_1959; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1959;
-juce::Slider slider_1960; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1960;
-juce::Slider slider_1961; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1961;
-juce::Slider slider_1962; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1962;
-juce::Slider slider_1963; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1963;
-juce::Slider slider_1964; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1964;
-juce::Slider slider_1965; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1965;
-juce::Slider slider_1966; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1966;
-juce::Slider slider_1967; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1967;
-juce::Slider slider_1968; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1968;
-juce::Slider slider_1969; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1969;
-juce::Slider slider_1970; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1970;
-juce::Slider slider_1971; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1971;
-juce::Slider slider_1972; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1972;
-juce::Slider slider_1973; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1973;
-juce::Slider slider_1974; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1974;
-juce::Slider slider_1975; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1975;
-juce::Slider slider_1976; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1976;
-juce::Slider slider_1977; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1977;
-juce::Slider slider_1978; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1978;
-juce::Slider slider_1979; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1979;
-juce::Slider slider_1980; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1980;
-juce::Slider slider_1981; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1981;
-juce::Slider slider_1982; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1982;
-juce::Slider slider_1983; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1983;
-juce::Slider slider_1984; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1984;
-juce::Slider slider_1985; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1985;
-juce::Slider slider_1986; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1986;
-juce::Slider slider_1987; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1987;
-juce::Slider slider_1988; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1988;
-juce::Slider slider_1989; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1989;
-juce::Slider slider_1990; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1990;
-juce::Slider slider_1991; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1991;
-juce::Slider slider_1992; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1992;
-juce::Slider slider_1993; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1993;
-juce::Slider slider_1994; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1994;
-juce::Slider slider_1995; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1995;
-juce::Slider slider_1996; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1996;
-juce::Slider slider_1997; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1997;
-juce::Slider slider_1998; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1998;
-juce::Slider slider_1999; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_1999;
-juce::Slider slider_2000; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2000;
-juce::Slider slider_2001; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2001;
-juce::Slider slider_2002; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2002;
-juce::Slider slider_2003; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2003;
-juce::Slider slider_2004; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2004;
-juce::Slider slider_2005; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2005;
-juce::Slider slider_2006; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2006;
-juce::Slider slider_2007; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2007;
-juce::Slider slider_2008; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2008;
-juce::Slider slider_2009; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2009;
-juce::Slider slider_2010; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2010;
-juce::Slider slider_2011; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2011;
-juce::Slider slider_2012; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2012;
-juce::Slider slider_2013; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2013;
-juce::Slider slider_2014; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2014;
-juce::Slider slider_2015; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2015;
-juce::Slider slider_2016; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2016;
-juce::Slider slider_2017; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2017;
-juce::Slider slider_2018; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2018;
-juce::Slider slider_2019; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2019;
-juce::Slider slider_2020; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2020;
-juce::Slider slider_2021; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2021;
-juce::Slider slider_2022; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2022;
-juce::Slider slider_2023; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2023;
-juce::Slider slider_2024; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2024;
-juce::Slider slider_2025; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2025;
-juce::Slider slider_2026; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2026;
-juce::Slider slider_2027; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2027;
-juce::Slider slider_2028; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2028;
-juce::Slider slider_2029; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2029;
-juce::Slider slider_2030; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2030;
-juce::Slider slider_2031; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2031;
-juce::Slider slider_2032; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2032;
-juce::Slider slider_2033; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2033;
-juce::Slider slider_2034; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2034;
-juce::Slider slider_2035; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2035;
-juce::Slider slider_2036; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2036;
-juce::Slider slider_2037; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2037;
-juce::Slider slider_2038; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2038;
-juce::Slider slider_2039; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2039;
-juce::Slider slider_2040; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2040;
-juce::Slider slider_2041; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2041;
-juce::Slider slider_2042; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2042;
-juce::Slider slider_2043; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2043;
-juce::Slider slider_2044; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2044;
-juce::Slider slider_2045; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2045;
-juce::Slider slider_2046; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2046;
-juce::Slider slider_2047; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2047;
-juce::Slider slider_2048; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2048;
-juce::Slider slider_2049; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2049;
-juce::Slider slider_2050; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2050;
-juce::Slider slider_2051; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2051;
-juce::Slider slider_2052; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2052;
-juce::Slider slider_2053; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2053;
-juce::Slider slider_2054; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2054;
-juce::Slider slider_2055; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2055;
-juce::Slider slider_2056; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2056;
-juce::Slider slider_2057; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2057;
-juce::Slider slider_2058; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2058;
-juce::Slider slider_2059; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2059;
-juce::Slider slider_2060; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2060;
-juce::Slider slider_2061; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2061;
-juce::Slider slider_2062; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2062;
-juce::Slider slider_2063; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2063;
-juce::Slider slider_2064; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2064;
-juce::Slider slider_2065; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2065;
-juce::Slider slider_2066; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2066;
-juce::Slider slider_2067; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2067;
-juce::Slider slider_2068; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2068;
-juce::Slider slider_2069; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2069;
-juce::Slider slider_2070; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2070;
-juce::Slider slider_2071; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2071;
-juce::Slider slider_2072; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2072;
-juce::Slider slider_2073; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2073;
-juce::Slider slider_2074; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2074;
-juce::Slider slider_2075; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2075;
-juce::Slider slider_2076; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2076;
-juce::Slider slider_2077; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2077;
-juce::Slider slider_2078; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2078;
-juce::Slider slider_2079; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2079;
-juce::Slider slider_2080; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2080;
-juce::Slider slider_2081; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2081;
-juce::Slider slider_2082; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2082;
-juce::Slider slider_2083; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2083;
-juce::Slider slider_2084; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2084;
-juce::Slider slider_2085; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2085;
-juce::Slider slider_2086; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2086;
-juce::Slider slider_2087; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2087;
-juce::Slider slider_2088; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2088;
-juce::Slider slider_2089; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2089;
-juce::Slider slider_2090; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2090;
-juce::Slider slider_2091; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2091;
-juce::Slider slider_2092; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2092;
-juce::Slider slider_2093; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2093;
-juce::Slider slider_2094; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2094;
-juce::Slider slider_2095; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2095;
-juce::Slider slider_2096; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2096;
-juce::Slider slider_2097; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2097;
-juce::Slider slider_2098; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2098;
-juce::Slider slider_2099; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2099;
-juce::Slider slider_2100; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2100;
-juce::Slider slider_2101; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2101;
-juce::Slider slider_2102; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2102;
-juce::Slider slider_2103; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2103;
-juce::Slider slider_2104; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2104;
-juce::Slider slider_2105; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2105;
-juce::Slider slider_2106; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2106;
-juce::Slider slider_2107; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2107;
-juce::Slider slider_2108; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2108;
-juce::Slider slider_2109; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2109;
-juce::Slider slider_2110; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2110;
-juce::Slider slider_2111; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2111;
-juce::Slider slider_2112; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2112;
-juce::Slider slider_2113; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2113;
-juce::Slider slider_2114; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2114;
-juce::Slider slider_2115; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2115;
-juce::Slider slider_2116; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2116;
-juce::Slider slider_2117; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2117;
-juce::Slider slider_2118; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2118;
-juce::Slider slider_2119; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2119;
-juce::Slider slider_2120; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2120;
-juce::Slider slider_2121; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2121;
-juce::Slider slider_2122; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2122;
-juce::Slider slider_2123; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2123;
-juce::Slider slider_2124; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2124;
-juce::Slider slider_2125; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2125;
-juce::Slider slider_2126; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2126;
-juce::Slider slider_2127; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2127;
-juce::Slider slider_2128; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2128;
-juce::Slider slider_2129; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2129;
-juce::Slider slider_2130; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2130;
-juce::Slider slider_2131; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2131;
-juce::Slider slider_2132; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2132;
-juce::Slider slider_2133; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2133;
-juce::Slider slider_2134; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2134;
-juce::Slider slider_2135; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2135;
-juce::Slider slider_2136; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2136;
-juce::Slider slider_2137; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2137;
-juce::Slider slider_2138; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2138;
-juce::Slider slider_2139; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2139;
-juce::Slider slider_2140; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2140;
-juce::Slider slider_2141; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2141;
-juce::Slider slider_2142; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2142;
-juce::Slider slider_2143; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2143;
-juce::Slider slider_2144; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2144;
-juce::Slider slider_2145; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2145;
-juce::Slider slider_2146; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2146;
-juce::Slider slider_2147; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2147;
-juce::Slider slider_2148; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2148;
-juce::Slider slider_2149; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2149;
-juce::Slider slider_2150; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2150;
-juce::Slider slider_2151; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2151;
-juce::Slider slider_2152; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2152;
-juce::Slider slider_2153; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2153;
-juce::Slider slider_2154; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2154;
-juce::Slider slider_2155; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2155;
-juce::Slider slider_2156; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2156;
-juce::Slider slider_2157; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2157;
-juce::Slider slider_2158; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2158;
-juce::Slider slider_2159; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2159;
-juce::Slider slider_2160; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2160;
-juce::Slider slider_2161; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2161;
-juce::Slider slider_2162; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2162;
-juce::Slider slider_2163; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2163;
-juce::Slider slider_2164; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2164;
-juce::Slider slider_2165; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2165;
-juce::Slider slider_2166; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2166;
-juce::Slider slider_2167; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2167;
-juce::Slider slider_2168; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2168;
-juce::Slider slider_2169; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2169;
-juce::Slider slider_2170; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2170;
-juce::Slider slider_2171; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2171;
-juce::Slider slider_2172; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2172;
-juce::Slider slider_2173; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2173;
-juce::Slider slider_2174; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2174;
-juce::Slider slider_2175; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2175;
-juce::Slider slider_2176; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2176;
-juce::Slider slider_2177; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2177;
-juce::Slider slider_2178; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2178;
-juce::Slider slider_2179; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2179;
-juce::Slider slider_2180; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2180;
-juce::Slider slider_2181; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2181;
-juce::Slider slider_2182; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2182;
-juce::Slider slider_2183; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2183;
-juce::Slider slider_2184; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2184;
-juce::Slider slider_2185; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2185;
-juce::Slider slider_2186; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2186;
-juce::Slider slider_2187; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2187;
-juce::Slider slider_2188; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2188;
-juce::Slider slider_2189; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2189;
-juce::Slider slider_2190; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2190;
-juce::Slider slider_2191; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2191;
-juce::Slider slider_2192; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2192;
-juce::Slider slider_2193; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2193;
-juce::Slider slider_2194; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2194;
-juce::Slider slider_2195; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2195;
-juce::Slider slider_2196; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2196;
-juce::Slider slider_2197; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2197;
-juce::Slider slider_2198; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2198;
-juce::Slider slider_2199; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2199;
-juce::Slider slider_2200; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2200;
-juce::Slider slider_2201; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2201;
-juce::Slider slider_2202; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2202;
-juce::Slider slider_2203; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2203;
-juce::Slider slider_2204; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2204;
-juce::Slider slider_2205; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2205;
-juce::Slider slider_2206; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2206;
-juce::Slider slider_2207; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2207;
-juce::Slider slider_2208; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2208;
-juce::Slider slider_2209; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2209;
-juce::Slider slider_2210; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2210;
-juce::Slider slider_2211; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2211;
-juce::Slider slider_2212; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2212;
-juce::Slider slider_2213; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2213;
-juce::Slider slider_2214; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2214;
-juce::Slider slider_2215; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2215;
-juce::Slider slider_2216; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2216;
-juce::Slider slider_2217; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2217;
-juce::Slider slider_2218; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2218;
-juce::Slider slider_2219; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2219;
-juce::Slider slider_2220; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2220;
-juce::Slider slider_2221; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2221;
-juce::Slider slider_2222; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2222;
-juce::Slider slider_2223; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2223;
-juce::Slider slider_2224; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2224;
-juce::Slider slider_2225; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2225;
-juce::Slider slider_2226; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2226;
-juce::Slider slider_2227; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2227;
-juce::Slider slider_2228; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2228;
-juce::Slider slider_2229; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2229;
-juce::Slider slider_2230; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2230;
-juce::Slider slider_2231; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2231;
-juce::Slider slider_2232; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2232;
-juce::Slider slider_2233; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2233;
-juce::Slider slider_2234; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2234;
-juce::Slider slider_2235; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2235;
-juce::Slider slider_2236; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2236;
-juce::Slider slider_2237; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2237;
-juce::Slider slider_2238; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2238;
-juce::Slider slider_2239; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2239;
-juce::Slider slider_2240; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2240;
-juce::Slider slider_2241; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2241;
-juce::Slider slider_2242; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2242;
-juce::Slider slider_2243; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2243;
-juce::Slider slider_2244; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2244;
-juce::Slider slider_2245; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2245;
-juce::Slider slider_2246; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2246;
-juce::Slider slider_2247; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2247;
-juce::Slider slider_2248; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2248;
-juce::Slider slider_2249; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2249;
-juce::Slider slider_2250; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2250;
-juce::Slider slider_2251; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2251;
-juce::Slider slider_2252; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2252;
-juce::Slider slider_2253; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2253;
-juce::Slider slider_2254; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2254;
-juce::Slider slider_2255; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2255;
-juce::Slider slider_2256; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2256;
-juce::Slider slider_2257; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2257;
-juce::Slider slider_2258; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2258;
-juce::Slider slider_2259; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2259;
-juce::Slider slider_2260; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2260;
-juce::Slider slider_2261; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2261;
-juce::Slider slider_2262; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2262;
-juce::Slider slider_2263; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2263;
-juce::Slider slider_2264; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2264;
-juce::Slider slider_2265; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2265;
-juce::Slider slider_2266; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2266;
-juce::Slider slider_2267; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2267;
-juce::Slider slider_2268; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2268;
-juce::Slider slider_2269; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2269;
-juce::Slider slider_2270; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2270;
-juce::Slider slider_2271; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2271;
-juce::Slider slider_2272; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2272;
-juce::Slider slider_2273; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2273;
-juce::Slider slider_2274; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2274;
-juce::Slider slider_2275; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2275;
-juce::Slider slider_2276; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2276;
-juce::Slider slider_2277; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2277;
-juce::Slider slider_2278; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2278;
-juce::Slider slider_2279; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2279;
-juce::Slider slider_2280; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2280;
-juce::Slider slider_2281; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2281;
-juce::Slider slider_2282; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2282;
-juce::Slider slider_2283; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2283;
-juce::Slider slider_2284; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2284;
-juce::Slider slider_2285; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2285;
-juce::Slider slider_2286; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2286;
-juce::Slider slider_2287; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2287;
-juce::Slider slider_2288; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2288;
-juce::Slider slider_2289; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2289;
-juce::Slider slider_2290; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2290;
-juce::Slider slider_2291; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2291;
-juce::Slider slider_2292; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2292;
-juce::Slider slider_2293; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2293;
-juce::Slider slider_2294; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2294;
-juce::Slider slider_2295; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2295;
-juce::Slider slider_2296; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2296;
-juce::Slider slider_2297; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2297;
-juce::Slider slider_2298; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2298;
-juce::Slider slider_2299; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2299;
-juce::Slider slider_2300; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2300;
-juce::Slider slider_2301; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2301;
-juce::Slider slider_2302; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2302;
-juce::Slider slider_2303; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2303;
-juce::Slider slider_2304; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2304;
-juce::Slider slider_2305; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2305;
-juce::Slider slider_2306; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2306;
-juce::Slider slider_2307; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2307;
-juce::Slider slider_2308; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2308;
-juce::Slider slider_2309; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2309;
-juce::Slider slider_2310; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2310;
-juce::Slider slider_2311; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2311;
-juce::Slider slider_2312; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2312;
-juce::Slider slider_2313; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2313;
-juce::Slider slider_2314; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2314;
-juce::Slider slider_2315; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2315;
-juce::Slider slider_2316; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2316;
-juce::Slider slider_2317; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2317;
-juce::Slider slider_2318; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2318;
-juce::Slider slider_2319; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2319;
-juce::Slider slider_2320; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2320;
-juce::Slider slider_2321; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2321;
-juce::Slider slider_2322; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2322;
-juce::Slider slider_2323; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2323;
-juce::Slider slider_2324; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2324;
-juce::Slider slider_2325; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2325;
-juce::Slider slider_2326; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2326;
-juce::Slider slider_2327; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2327;
-juce::Slider slider_2328; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2328;
-juce::Slider slider_2329; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2329;
-juce::Slider slider_2330; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2330;
-juce::Slider slider_2331; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2331;
-juce::Slider slider_2332; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2332;
-juce::Slider slider_2333; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2333;
-juce::Slider slider_2334; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2334;
-juce::Slider slider_2335; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2335;
-juce::Slider slider_2336; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2336;
-juce::Slider slider_2337; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2337;
-juce::Slider slider_2338; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2338;
-juce::Slider slider_2339; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2339;
-juce::Slider slider_2340; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2340;
-juce::Slider slider_2341; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2341;
-juce::Slider slider_2342; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2342;
-juce::Slider slider_2343; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2343;
-juce::Slider slider_2344; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2344;
-juce::Slider slider_2345; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2345;
-juce::Slider slider_2346; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2346;
-juce::Slider slider_2347; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2347;
-juce::Slider slider_2348; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2348;
-juce::Slider slider_2349; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2349;
-juce::Slider slider_2350; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2350;
-juce::Slider slider_2351; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2351;
-juce::Slider slider_2352; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2352;
-juce::Slider slider_2353; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2353;
-juce::Slider slider_2354; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2354;
-juce::Slider slider_2355; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2355;
-juce::Slider slider_2356; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2356;
-juce::Slider slider_2357; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2357;
-juce::Slider slider_2358; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2358;
-juce::Slider slider_2359; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2359;
-juce::Slider slider_2360; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2360;
-juce::Slider slider_2361; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2361;
-juce::Slider slider_2362; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2362;
-juce::Slider slider_2363; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2363;
-juce::Slider slider_2364; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2364;
-juce::Slider slider_2365; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2365;
-juce::Slider slider_2366; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2366;
-juce::Slider slider_2367; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2367;
-juce::Slider slider_2368; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2368;
-juce::Slider slider_2369; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2369;
-juce::Slider slider_2370; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2370;
-juce::Slider slider_2371; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2371;
-juce::Slider slider_2372; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2372;
-juce::Slider slider_2373; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2373;
-juce::Slider slider_2374; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2374;
-juce::Slider slider_2375; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2375;
-juce::Slider slider_2376; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2376;
-juce::Slider slider_2377; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2377;
-juce::Slider slider_2378; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2378;
-juce::Slider slider_2379; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2379;
-juce::Slider slider_2380; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2380;
-juce::Slider slider_2381; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2381;
-juce::Slider slider_2382; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2382;
-juce::Slider slider_2383; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2383;
-juce::Slider slider_2384; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2384;
-juce::Slider slider_2385; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2385;
-juce::Slider slider_2386; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2386;
-juce::Slider slider_2387; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2387;
-juce::Slider slider_2388; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2388;
-juce::Slider slider_2389; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2389;
-juce::Slider slider_2390; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2390;
-juce::Slider slider_2391; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2391;
-juce::Slider slider_2392; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2392;
-juce::Slider slider_2393; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2393;
-juce::Slider slider_2394; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2394;
-juce::Slider slider_2395; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2395;
-juce::Slider slider_2396; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2396;
-juce::Slider slider_2397; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2397;
-juce::Slider slider_2398; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2398;
-juce::Slider slider_2399; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2399;
-juce::Slider slider_2400; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2400;
-juce::Slider slider_2401; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2401;
-juce::Slider slider_2402; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2402;
-juce::Slider slider_2403; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2403;
-juce::Slider slider_2404; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2404;
-juce::Slider slider_2405; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2405;
-juce::Slider slider_2406; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2406;
-juce::Slider slider_2407; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2407;
-juce::Slider slider_2408; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2408;
-juce::Slider slider_2409; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2409;
-juce::Slider slider_2410; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2410;
-juce::Slider slider_2411; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2411;
-juce::Slider slider_2412; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2412;
-juce::Slider slider_2413; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2413;
-juce::Slider slider_2414; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2414;
-juce::Slider slider_2415; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2415;
-juce::Slider slider_2416; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2416;
-juce::Slider slider_2417; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2417;
-juce::Slider slider_2418; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2418;
-juce::Slider slider_2419; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2419;
-juce::Slider slider_2420; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2420;
-juce::Slider slider_2421; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2421;
-juce::Slider slider_2422; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2422;
-juce::Slider slider_2423; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2423;
-juce::Slider slider_2424; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2424;
-juce::Slider slider_2425; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2425;
-juce::Slider slider_2426; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2426;
-juce::Slider slider_2427; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2427;
-juce::Slider slider_2428; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2428;
-juce::Slider slider_2429; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2429;
-juce::Slider slider_2430; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2430;
-juce::Slider slider_2431; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2431;
-juce::Slider slider_2432; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2432;
-juce::Slider slider_2433; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2433;
-juce::Slider slider_2434; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2434;
-juce::Slider slider_2435; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2435;
-juce::Slider slider_2436; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2436;
-juce::Slider slider_2437; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2437;
-juce::Slider slider_2438; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2438;
-juce::Slider slider_2439; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2439;
-juce::Slider slider_2440; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2440;
-juce::Slider slider_2441; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2441;
-juce::Slider slider_2442; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2442;
-juce::Slider slider_2443; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2443;
-juce::Slider slider_2444; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2444;
-juce::Slider slider_2445; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2445;
-juce::Slider slider_2446; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2446;
-juce::Slider slider_2447; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2447;
-juce::Slider slider_2448; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2448;
-juce::Slider slider_2449; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2449;
-juce::Slider slider_2450; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2450;
-juce::Slider slider_2451; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2451;
-juce::Slider slider_2452; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2452;
-juce::Slider slider_2453; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2453;
-juce::Slider slider_2454; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2454;
-juce::Slider slider_2455; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2455;
-juce::Slider slider_2456; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2456;
-juce::Slider slider_2457; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2457;
-juce::Slider slider_2458; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2458;
-juce::Slider slider_2459; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2459;
-juce::Slider slider_2460; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2460;
-juce::Slider slider_2461; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2461;
-juce::Slider slider_2462; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2462;
-juce::Slider slider_2463; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2463;
-juce::Slider slider_2464; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2464;
-juce::Slider slider_2465; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2465;
-juce::Slider slider_2466; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2466;
-juce::Slider slider_2467; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2467;
-juce::Slider slider_2468; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2468;
-juce::Slider slider_2469; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2469;
-juce::Slider slider_2470; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2470;
-juce::Slider slider_2471; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2471;
-juce::Slider slider_2472; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2472;
-juce::Slider slider_2473; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2473;
-juce::Slider slider_2474; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2474;
-juce::Slider slider_2475; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2475;
-juce::Slider slider_2476; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2476;
-juce::Slider slider_2477; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2477;
-juce::Slider slider_2478; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2478;
-juce::Slider slider_2479; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2479;
-juce::Slider slider_2480; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2480;
-juce::Slider slider_2481; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2481;
-juce::Slider slider_2482; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2482;
-juce::Slider slider_2483; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2483;
-juce::Slider slider_2484; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2484;
-juce::Slider slider_2485; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2485;
-juce::Slider slider_2486; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2486;
-juce::Slider slider_2487; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2487;
-juce::Slider slider_2488; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2488;
-juce::Slider slider_2489; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2489;
-juce::Slider slider_2490; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2490;
-juce::Slider slider_2491; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2491;
-juce::Slider slider_2492; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2492;
-juce::Slider slider_2493; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2493;
-juce::Slider slider_2494; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2494;
-juce::Slider slider_2495; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2495;
-juce::Slider slider_2496; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2496;
-juce::Slider slider_2497; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2497;
-juce::Slider slider_2498; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2498;
-juce::Slider slider_2499; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2499;
-juce::Slider slider_2500; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2500;
-juce::Slider slider_2501; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2501;
-juce::Slider slider_2502; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2502;
-juce::Slider slider_2503; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2503;
-juce::Slider slider_2504; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2504;
-juce::Slider slider_2505; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2505;
-juce::Slider slider_2506; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2506;
-juce::Slider slider_2507; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2507;
-juce::Slider slider_2508; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2508;
-juce::Slider slider_2509; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2509;
-juce::Slider slider_2510; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2510;
-juce::Slider slider_2511; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2511;
-juce::Slider slider_2512; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2512;
-juce::Slider slider_2513; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2513;
-juce::Slider slider_2514; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2514;
-juce::Slider slider_2515; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2515;
-juce::Slider slider_2516; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2516;
-juce::Slider slider_2517; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2517;
-juce::Slider slider_2518; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2518;
-juce::Slider slider_2519; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2519;
-juce::Slider slider_2520; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2520;
-juce::Slider slider_2521; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2521;
-juce::Slider slider_2522; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2522;
-juce::Slider slider_2523; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2523;
-juce::Slider slider_2524; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2524;
-juce::Slider slider_2525; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2525;
-juce::Slider slider_2526; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2526;
-juce::Slider slider_2527; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2527;
-juce::Slider slider_2528; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2528;
-juce::Slider slider_2529; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2529;
-juce::Slider slider_2530; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2530;
-juce::Slider slider_2531; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2531;
-juce::Slider slider_2532; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2532;
-juce::Slider slider_2533; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2533;
-juce::Slider slider_2534; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2534;
-juce::Slider slider_2535; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2535;
-juce::Slider slider_2536; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2536;
-juce::Slider slider_2537; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2537;
-juce::Slider slider_2538; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2538;
-juce::Slider slider_2539; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2539;
-juce::Slider slider_2540; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2540;
-juce::Slider slider_2541; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2541;
-juce::Slider slider_2542; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2542;
-juce::Slider slider_2543; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2543;
-juce::Slider slider_2544; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2544;
-juce::Slider slider_2545; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2545;
-juce::Slider slider_2546; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2546;
-juce::Slider slider_2547; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2547;
-juce::Slider slider_2548; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2548;
-juce::Slider slider_2549; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2549;
-juce::Slider slider_2550; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2550;
-juce::Slider slider_2551; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2551;
-juce::Slider slider_2552; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2552;
-juce::Slider slider_2553; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2553;
-juce::Slider slider_2554; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2554;
-juce::Slider slider_2555; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2555;
-juce::Slider slider_2556; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2556;
-juce::Slider slider_2557; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2557;
-juce::Slider slider_2558; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2558;
-juce::Slider slider_2559; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2559;
-juce::Slider slider_2560; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2560;
-juce::Slider slider_2561; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2561;
-juce::Slider slider_2562; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2562;
-juce::Slider slider_2563; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2563;
-juce::Slider slider_2564; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2564;
-juce::Slider slider_2565; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2565;
-juce::Slider slider_2566; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2566;
-juce::Slider slider_2567; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2567;
-juce::Slider slider_2568; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2568;
-juce::Slider slider_2569; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2569;
-juce::Slider slider_2570; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2570;
-juce::Slider slider_2571; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2571;
-juce::Slider slider_2572; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2572;
-juce::Slider slider_2573; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2573;
-juce::Slider slider_2574; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2574;
-juce::Slider slider_2575; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2575;
-juce::Slider slider_2576; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2576;
-juce::Slider slider_2577; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2577;
-juce::Slider slider_2578; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2578;
-juce::Slider slider_2579; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2579;
-juce::Slider slider_2580; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2580;
-juce::Slider slider_2581; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2581;
-juce::Slider slider_2582; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2582;
-juce::Slider slider_2583; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2583;
-juce::Slider slider_2584; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2584;
-juce::Slider slider_2585; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2585;
-juce::Slider slider_2586; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2586;
-juce::Slider slider_2587; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2587;
-juce::Slider slider_2588; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2588;
-juce::Slider slider_2589; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2589;
-juce::Slider slider_2590; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2590;
-juce::Slider slider_2591; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2591;
-juce::Slider slider_2592; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2592;
-juce::Slider slider_2593; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2593;
-juce::Slider slider_2594; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2594;
-juce::Slider slider_2595; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2595;
-juce::Slider slider_2596; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2596;
-juce::Slider slider_2597; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2597;
-juce::Slider slider_2598; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2598;
-juce::Slider slider_2599; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2599;
-juce::Slider slider_2600; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2600;
-juce::Slider slider_2601; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2601;
-juce::Slider slider_2602; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2602;
-juce::Slider slider_2603; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2603;
-juce::Slider slider_2604; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2604;
-juce::Slider slider_2605; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2605;
-juce::Slider slider_2606; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2606;
-juce::Slider slider_2607; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2607;
-juce::Slider slider_2608; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2608;
-juce::Slider slider_2609; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2609;
-juce::Slider slider_2610; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2610;
-juce::Slider slider_2611; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2611;
-juce::Slider slider_2612; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2612;
-juce::Slider slider_2613; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2613;
-juce::Slider slider_2614; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2614;
-juce::Slider slider_2615; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2615;
-juce::Slider slider_2616; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2616;
-juce::Slider slider_2617; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2617;
-juce::Slider slider_2618; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2618;
-juce::Slider slider_2619; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2619;
-juce::Slider slider_2620; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2620;
-juce::Slider slider_2621; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2621;
-juce::Slider slider_2622; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2622;
-juce::Slider slider_2623; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2623;
-juce::Slider slider_2624; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2624;
-juce::Slider slider_2625; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2625;
-juce::Slider slider_2626; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2626;
-juce::Slider slider_2627; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2627;
-juce::Slider slider_2628; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2628;
-juce::Slider slider_2629; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2629;
-juce::Slider slider_2630; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2630;
-juce::Slider slider_2631; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2631;
-juce::Slider slider_2632; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2632;
-juce::Slider slider_2633; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2633;
-juce::Slider slider_2634; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2634;
-juce::Slider slider_2635; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2635;
-juce::Slider slider_2636; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2636;
-juce::Slider slider_2637; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2637;
-juce::Slider slider_2638; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2638;
-juce::Slider slider_2639; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2639;
-juce::Slider slider_2640; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2640;
-juce::Slider slider_2641; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2641;
-juce::Slider slider_2642; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2642;
-juce::Slider slider_2643; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2643;
-juce::Slider slider_2644; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2644;
-juce::Slider slider_2645; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2645;
-juce::Slider slider_2646; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2646;
-juce::Slider slider_2647; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2647;
-juce::Slider slider_2648; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2648;
-juce::Slider slider_2649; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2649;
-juce::Slider slider_2650; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2650;
-juce::Slider slider_2651; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2651;
-juce::Slider slider_2652; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2652;
-juce::Slider slider_2653; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2653;
-juce::Slider slider_2654; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2654;
-juce::Slider slider_2655; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2655;
-juce::Slider slider_2656; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2656;
-juce::Slider slider_2657; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2657;
-juce::Slider slider_2658; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2658;
-juce::Slider slider_2659; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2659;
-juce::Slider slider_2660; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2660;
-juce::Slider slider_2661; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2661;
-juce::Slider slider_2662; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2662;
-juce::Slider slider_2663; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2663;
-juce::Slider slider_2664; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2664;
-juce::Slider slider_2665; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2665;
-juce::Slider slider_2666; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2666;
-juce::Slider slider_2667; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2667;
-juce::Slider slider_2668; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2668;
-juce::Slider slider_2669; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2669;
-juce::Slider slider_2670; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2670;
-juce::Slider slider_2671; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2671;
-juce::Slider slider_2672; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2672;
-juce::Slider slider_2673; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2673;
-juce::Slider slider_2674; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2674;
-juce::Slider slider_2675; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2675;
-juce::Slider slider_2676; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2676;
-juce::Slider slider_2677; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2677;
-juce::Slider slider_2678; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2678;
-juce::Slider slider_2679; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2679;
-juce::Slider slider_2680; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2680;
-juce::Slider slider_2681; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2681;
-juce::Slider slider_2682; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2682;
-juce::Slider slider_2683; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2683;
-juce::Slider slider_2684; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2684;
-juce::Slider slider_2685; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2685;
-juce::Slider slider_2686; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2686;
-juce::Slider slider_2687; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2687;
-juce::Slider slider_2688; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2688;
-juce::Slider slider_2689; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2689;
-juce::Slider slider_2690; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2690;
-juce::Slider slider_2691; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2691;
-juce::Slider slider_2692; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2692;
-juce::Slider slider_2693; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2693;
-juce::Slider slider_2694; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2694;
-juce::Slider slider_2695; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2695;
-juce::Slider slider_2696; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2696;
-juce::Slider slider_2697; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2697;
-juce::Slider slider_2698; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2698;
-juce::Slider slider_2699; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2699;
-juce::Slider slider_2700; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2700;
-juce::Slider slider_2701; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2701;
-juce::Slider slider_2702; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2702;
-juce::Slider slider_2703; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2703;
-juce::Slider slider_2704; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2704;
-juce::Slider slider_2705; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2705;
-juce::Slider slider_2706; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2706;
-juce::Slider slider_2707; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2707;
-juce::Slider slider_2708; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2708;
-juce::Slider slider_2709; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2709;
-juce::Slider slider_2710; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2710;
-juce::Slider slider_2711; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2711;
-juce::Slider slider_2712; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2712;
-juce::Slider slider_2713; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2713;
-juce::Slider slider_2714; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2714;
-juce::Slider slider_2715; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2715;
-juce::Slider slider_2716; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2716;
-juce::Slider slider_2717; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2717;
-juce::Slider slider_2718; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2718;
-juce::Slider slider_2719; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2719;
-juce::Slider slider_2720; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2720;
-juce::Slider slider_2721; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2721;
-juce::Slider slider_2722; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2722;
-juce::Slider slider_2723; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2723;
-juce::Slider slider_2724; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2724;
-juce::Slider slider_2725; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2725;
-juce::Slider slider_2726; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2726;
-juce::Slider slider_2727; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2727;
-juce::Slider slider_2728; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2728;
-juce::Slider slider_2729; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2729;
-juce::Slider slider_2730; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2730;
-juce::Slider slider_2731; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2731;
-juce::Slider slider_2732; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2732;
-juce::Slider slider_2733; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2733;
-juce::Slider slider_2734; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2734;
-juce::Slider slider_2735; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2735;
-juce::Slider slider_2736; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2736;
-juce::Slider slider_2737; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2737;
-juce::Slider slider_2738; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2738;
-juce::Slider slider_2739; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2739;
-juce::Slider slider_2740; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2740;
-juce::Slider slider_2741; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2741;
-juce::Slider slider_2742; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2742;
-juce::Slider slider_2743; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2743;
-juce::Slider slider_2744; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2744;
-juce::Slider slider_2745; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2745;
-juce::Slider slider_2746; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2746;
-juce::Slider slider_2747; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2747;
-juce::Slider slider_2748; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2748;
-juce::Slider slider_2749; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2749;
-juce::Slider slider_2750; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2750;
-juce::Slider slider_2751; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2751;
-juce::Slider slider_2752; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2752;
-juce::Slider slider_2753; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2753;
-juce::Slider slider_2754; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2754;
-juce::Slider slider_2755; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2755;
-juce::Slider slider_2756; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2756;
-juce::Slider slider_2757; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2757;
-juce::Slider slider_2758; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2758;
-juce::Slider slider_2759; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2759;
-juce::Slider slider_2760; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2760;
-juce::Slider slider_2761; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2761;
-juce::Slider slider_2762; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2762;
-juce::Slider slider_2763; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2763;
-juce::Slider slider_2764; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2764;
-juce::Slider slider_2765; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2765;
-juce::Slider slider_2766; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2766;
-juce::Slider slider_2767; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2767;
-juce::Slider slider_2768; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2768;
-juce::Slider slider_2769; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2769;
-juce::Slider slider_2770; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2770;
-juce::Slider slider_2771; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2771;
-juce::Slider slider_2772; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2772;
-juce::Slider slider_2773; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2773;
-juce::Slider slider_2774; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2774;
-juce::Slider slider_2775; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2775;
-juce::Slider slider_2776; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2776;
-juce::Slider slider_2777; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2777;
-juce::Slider slider_2778; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2778;
-juce::Slider slider_2779; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2779;
-juce::Slider slider_2780; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2780;
-juce::Slider slider_2781; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2781;
-juce::Slider slider_2782; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2782;
-juce::Slider slider_2783; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2783;
-juce::Slider slider_2784; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2784;
-juce::Slider slider_2785; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2785;
-juce::Slider slider_2786; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2786;
-juce::Slider slider_2787; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2787;
-juce::Slider slider_2788; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2788;
-juce::Slider slider_2789; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2789;
-juce::Slider slider_2790; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2790;
-juce::Slider slider_2791; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2791;
-juce::Slider slider_2792; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2792;
-juce::Slider slider_2793; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2793;
-juce::Slider slider_2794; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2794;
-juce::Slider slider_2795; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2795;
-juce::Slider slider_2796; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2796;
-juce::Slider slider_2797; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2797;
-juce::Slider slider_2798; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2798;
-juce::Slider slider_2799; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2799;
-juce::Slider slider_2800; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2800;
-juce::Slider slider_2801; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2801;
-juce::Slider slider_2802; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2802;
-juce::Slider slider_2803; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2803;
-juce::Slider slider_2804; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2804;
-juce::Slider slider_2805; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2805;
-juce::Slider slider_2806; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2806;
-juce::Slider slider_2807; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2807;
-juce::Slider slider_2808; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2808;
-juce::Slider slider_2809; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2809;
-juce::Slider slider_2810; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2810;
-juce::Slider slider_2811; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2811;
-juce::Slider slider_2812; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2812;
-juce::Slider slider_2813; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2813;
-juce::Slider slider_2814; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2814;
-juce::Slider slider_2815; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2815;
-juce::Slider slider_2816; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2816;
-juce::Slider slider_2817; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2817;
-juce::Slider slider_2818; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2818;
-juce::Slider slider_2819; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2819;
-juce::Slider slider_2820; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2820;
-juce::Slider slider_2821; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2821;
-juce::Slider slider_2822; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2822;
-juce::Slider slider_2823; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2823;
-juce::Slider slider_2824; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2824;
-juce::Slider slider_2825; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2825;
-juce::Slider slider_2826; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2826;
-juce::Slider slider_2827; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2827;
-juce::Slider slider_2828; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2828;
-juce::Slider slider_2829; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2829;
-juce::Slider slider_2830; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2830;
-juce::Slider slider_2831; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2831;
-juce::Slider slider_2832; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2832;
-juce::Slider slider_2833; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2833;
-juce::Slider slider_2834; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2834;
-juce::Slider slider_2835; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2835;
-juce::Slider slider_2836; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2836;
-juce::Slider slider_2837; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2837;
-juce::Slider slider_2838; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2838;
-juce::Slider slider_2839; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2839;
-juce::Slider slider_2840; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2840;
-juce::Slider slider_2841; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2841;
-juce::Slider slider_2842; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2842;
-juce::Slider slider_2843; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2843;
-juce::Slider slider_2844; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2844;
-juce::Slider slider_2845; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2845;
-juce::Slider slider_2846; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2846;
-juce::Slider slider_2847; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2847;
-juce::Slider slider_2848; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2848;
-juce::Slider slider_2849; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2849;
-juce::Slider slider_2850; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2850;
-juce::Slider slider_2851; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2851;
-juce::Slider slider_2852; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2852;
-juce::Slider slider_2853; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2853;
-juce::Slider slider_2854; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2854;
-juce::Slider slider_2855; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2855;
-juce::Slider slider_2856; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2856;
-juce::Slider slider_2857; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2857;
-juce::Slider slider_2858; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2858;
-juce::Slider slider_2859; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2859;
-juce::Slider slider_2860; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2860;
-juce::Slider slider_2861; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2861;
-juce::Slider slider_2862; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2862;
-juce::Slider slider_2863; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2863;
-juce::Slider slider_2864; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2864;
-juce::Slider slider_2865; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2865;
-juce::Slider slider_2866; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2866;
-juce::Slider slider_2867; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2867;
-juce::Slider slider_2868; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2868;
-juce::Slider slider_2869; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2869;
-juce::Slider slider_2870; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2870;
-juce::Slider slider_2871; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2871;
-juce::Slider slider_2872; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2872;
-juce::Slider slider_2873; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2873;
-juce::Slider slider_2874; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2874;
-juce::Slider slider_2875; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2875;
-juce::Slider slider_2876; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2876;
-juce::Slider slider_2877; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2877;
-juce::Slider slider_2878; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2878;
-juce::Slider slider_2879; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2879;
-juce::Slider slider_2880; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2880;
-juce::Slider slider_2881; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2881;
-juce::Slider slider_2882; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2882;
-juce::Slider slider_2883; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2883;
-juce::Slider slider_2884; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2884;
-juce::Slider slider_2885; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2885;
-juce::Slider slider_2886; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2886;
-juce::Slider slider_2887; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2887;
-juce::Slider slider_2888; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2888;
-juce::Slider slider_2889; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2889;
-juce::Slider slider_2890; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2890;
-juce::Slider slider_2891; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2891;
-juce::Slider slider_2892; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2892;
-juce::Slider slider_2893; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2893;
-juce::Slider slider_2894; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2894;
-juce::Slider slider_2895; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2895;
-juce::Slider slider_2896; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2896;
-juce::Slider slider_2897; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2897;
-juce::Slider slider_2898; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2898;
-juce::Slider slider_2899; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2899;
-juce::Slider slider_2900; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2900;
-juce::Slider slider_2901; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2901;
-juce::Slider slider_2902; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2902;
-juce::Slider slider_2903; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2903;
-juce::Slider slider_2904; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2904;
-juce::Slider slider_2905; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2905;
-juce::Slider slider_2906; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2906;
-juce::Slider slider_2907; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2907;
-juce::Slider slider_2908; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2908;
-juce::Slider slider_2909; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2909;
-juce::Slider slider_2910; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2910;
-juce::Slider slider_2911; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2911;
-juce::Slider slider_2912; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2912;
-juce::Slider slider_2913; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2913;
-juce::Slider slider_2914; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2914;
-juce::Slider slider_2915; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2915;
-juce::Slider slider_2916; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2916;
-juce::Slider slider_2917; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2917;
-juce::Slider slider_2918; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2918;
-juce::Slider slider_2919; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2919;
-juce::Slider slider_2920; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2920;
-juce::Slider slider_2921; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2921;
-juce::Slider slider_2922; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2922;
-juce::Slider slider_2923; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2923;
-juce::Slider slider_2924; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2924;
-juce::Slider slider_2925; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2925;
-juce::Slider slider_2926; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2926;
-juce::Slider slider_2927; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2927;
-juce::Slider slider_2928; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2928;
-juce::Slider slider_2929; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2929;
-juce::Slider slider_2930; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2930;
-juce::Slider slider_2931; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2931;
-juce::Slider slider_2932; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2932;
-juce::Slider slider_2933; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2933;
-juce::Slider slider_2934; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2934;
-juce::Slider slider_2935; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2935;
-juce::Slider slider_2936; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2936;
-juce::Slider slider_2937; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2937;
-juce::Slider slider_2938; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2938;
-juce::Slider slider_2939; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2939;
-juce::Slider slider_2940; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2940;
-juce::Slider slider_2941; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2941;
-juce::Slider slider_2942; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2942;
-juce::Slider slider_2943; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2943;
-juce::Slider slider_2944; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2944;
-juce::Slider slider_2945; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2945;
-juce::Slider slider_2946; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2946;
-juce::Slider slider_2947; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2947;
-juce::Slider slider_2948; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2948;
-juce::Slider slider_2949; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2949;
-juce::Slider slider_2950; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2950;
-juce::Slider slider_2951; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2951;
-juce::Slider slider_2952; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2952;
-juce::Slider slider_2953; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2953;
-juce::Slider slider_2954; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2954;
-juce::Slider slider_2955; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2955;
-juce::Slider slider_2956; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2956;
-juce::Slider slider_2957; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2957;
-juce::Slider slider_2958; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2958;
-juce::Slider slider_2959; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2959;
-juce::Slider slider_2960; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2960;
-juce::Slider slider_2961; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2961;
-juce::Slider slider_2962; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2962;
-juce::Slider slider_2963; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2963;
-juce::Slider slider_2964; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2964;
-juce::Slider slider_2965; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2965;
-juce::Slider slider_2966; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2966;
-juce::Slider slider_2967; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2967;
-juce::Slider slider_2968; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2968;
-juce::Slider slider_2969; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2969;
-juce::Slider slider_2970; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2970;
-juce::Slider slider_2971; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2971;
-juce::Slider slider_2972; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2972;
-juce::Slider slider_2973; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2973;
-juce::Slider slider_2974; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2974;
-juce::Slider slider_2975; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2975;
-juce::Slider slider_2976; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2976;
-juce::Slider slider_2977; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2977;
-juce::Slider slider_2978; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2978;
-juce::Slider slider_2979; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2979;
-juce::Slider slider_2980; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2980;
-juce::Slider slider_2981; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2981;
-juce::Slider slider_2982; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2982;
-juce::Slider slider_2983; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2983;
-juce::Slider slider_2984; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2984;
-juce::Slider slider_2985; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2985;
-juce::Slider slider_2986; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2986;
-juce::Slider slider_2987; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2987;
-juce::Slider slider_2988; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2988;
-juce::Slider slider_2989; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2989;
-juce::Slider slider_2990; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2990;
-juce::Slider slider_2991; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2991;
-juce::Slider slider_2992; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2992;
-juce::Slider slider_2993; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2993;
-juce::Slider slider_2994; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2994;
-juce::Slider slider_2995; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2995;
-juce::Slider slider_2996; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2996;
-juce::Slider slider_2997; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2997;
-juce::Slider slider_2998; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2998;
-juce::Slider slider_2999; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_2999;
-juce::Slider slider_3000; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3000;
-juce::Slider slider_3001; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3001;
-juce::Slider slider_3002; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3002;
-juce::Slider slider_3003; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3003;
-juce::Slider slider_3004; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3004;
-juce::Slider slider_3005; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3005;
-juce::Slider slider_3006; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3006;
-juce::Slider slider_3007; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3007;
-juce::Slider slider_3008; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3008;
-juce::Slider slider_3009; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3009;
-juce::Slider slider_3010; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3010;
-juce::Slider slider_3011; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3011;
-juce::Slider slider_3012; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3012;
-juce::Slider slider_3013; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3013;
-juce::Slider slider_3014; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3014;
-juce::Slider slider_3015; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3015;
-juce::Slider slider_3016; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3016;
-juce::Slider slider_3017; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3017;
-juce::Slider slider_3018; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3018;
-juce::Slider slider_3019; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3019;
-juce::Slider slider_3020; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3020;
-juce::Slider slider_3021; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3021;
-juce::Slider slider_3022; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3022;
-juce::Slider slider_3023; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3023;
-juce::Slider slider_3024; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3024;
-juce::Slider slider_3025; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3025;
-juce::Slider slider_3026; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3026;
-juce::Slider slider_3027; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3027;
-juce::Slider slider_3028; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3028;
-juce::Slider slider_3029; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3029;
-juce::Slider slider_3030; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3030;
-juce::Slider slider_3031; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3031;
-juce::Slider slider_3032; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3032;
-juce::Slider slider_3033; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3033;
-juce::Slider slider_3034; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3034;
-juce::Slider slider_3035; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3035;
-juce::Slider slider_3036; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3036;
-juce::Slider slider_3037; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3037;
-juce::Slider slider_3038; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3038;
-juce::Slider slider_3039; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3039;
-juce::Slider slider_3040; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3040;
-juce::Slider slider_3041; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3041;
-juce::Slider slider_3042; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3042;
-juce::Slider slider_3043; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3043;
-juce::Slider slider_3044; std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment_3044;
@@ -0,0 +1,202 @@
+#pragma once
+#include <JuceHeader.h>
+#include <string>
+#include "Parameter.h"
+
+// Token prefix index over the hierarchical parameter names, built once from the parameter table.
+// A query is split into terms, every term must be the prefix of one name token ("inst2 lfo1 rat" finds
+// "INST2/DYNAMIC SYNTH/LFO1/RATE"). The matches are returned in table order.
+// A name the table uses for several parameters (the two words of the CTL/ON OFF STATE register) is
+// ambiguous: every one of them gets a unique name with the address appended, "CTL/ON OFF STATE [1000031A]".
+class SY1000ParameterSearchIndex
+{
+public:
+
+    SY1000ParameterSearchIndex(const SY1000Parameter& parameter)
+    {
+        int numParameters = (int)parameter.size();
+        mTokensOf.resize((size_t)numParameters);
+        mUniqueNames.resize((size_t)numParameters);
+        for (int i = 0; i < numParameters; i++)
+        {
+            juce::String key = parameter.getParameterData(i).parameterName.toUpperCase();
+            std::vector<int> indices = mIndicesByName[key];
+            indices.push_back(i);
+            mIndicesByName.set(key, indices);
+        }
+
+        for (int i = 0; i < numParameters; i++)
+        {
+            const SY1000Parameter::Data& data = parameter.getParameterData(i);
+            const juce::String& name = data.parameterName;
+            juce::String uniqueName = name;
+            if (mIndicesByName[name.toUpperCase()].size() > 1)
+                uniqueName += " [" + data.hexAddress + "]";
+            mUniqueNames[(size_t)i] = uniqueName;
+            mIndexByName.set(uniqueName.toUpperCase(), i);
+            for (auto& token : tokenize(name))
+            {
+                mTokens.push_back({ token, i });
+                mTokensOf[(size_t)i].push_back(token);
+            }
+        }
+        std::sort(mTokens.begin(), mTokens.end());
+    }
+
+    // Index of the parameter with exactly this unique name (case insensitive), -1 if there is none.
+    // An ambiguous table name is not found, only the unique names of its parameters.
+    int getParameterIndex(const juce::String& parameterName) const
+    {
+        juce::String key = parameterName.toUpperCase();
+        if (mIndexByName.contains(key))
+            return mIndexByName[key];
+        return -1;
+    }
+
+    // Every parameter with this table name (case insensitive), in table order
+    std::vector<int> getParameterIndices(const juce::String& parameterName) const
+    {
+        return mIndicesByName[parameterName.toUpperCase()];
+    }
+
+    // The table name, with the address appended if the name is ambiguous
+    const juce::String& getUniqueName(int parameterIndex) const
+    {
+        return mUniqueNames[(size_t)parameterIndex];
+    }
+
+    std::vector<int> find(const juce::String& query) const
+    {
+        std::vector<int> result;
+        std::vector<std::string> terms = tokenize(query);
+        if (terms.empty())
+            return result;
+
+        // Candidates of the most selective term, then the other terms are checked per candidate
+        size_t bestTerm = 0;
+        size_t bestCount = mTokens.size() + 1;
+        for (size_t t = 0; t < terms.size(); t++)
+        {
+            auto range = getPrefixRange(terms[t]);
+            size_t count = (size_t)(range.second - range.first);
+            if (count < bestCount)
+            {
+                bestCount = count;
+                bestTerm = t;
+            }
+        }
+
+        auto range = getPrefixRange(terms[bestTerm]);
+        for (auto it = range.first; it != range.second; ++it)
+            result.push_back(it->second);
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        if (terms.size() > 1)
+            result = filter(result, terms);
+        return result;
+    }
+
+    // Incremental search for a text field. While the user keeps typing, only the previous matches are checked.
+    class Search
+    {
+    public:
+        Search(const SY1000ParameterSearchIndex& index) : mIndex(index) {}
+
+        const std::vector<int>& update(const juce::String& query)
+        {
+            juce::String trimmed = query.trim();
+            bool isRefinement = mQuery.isNotEmpty() && trimmed.startsWith(mQuery)
+                                && tokenize(trimmed).size() >= tokenize(mQuery).size();
+            if (isRefinement)
+                mResult = mIndex.filter(mResult, tokenize(trimmed));
+            else
+                mResult = mIndex.find(trimmed);
+            mQuery = trimmed;
+            return mResult;
+        }
+
+        const std::vector<int>& getResult() const
+        {
+            return mResult;
+        }
+
+    private:
+        const SY1000ParameterSearchIndex& mIndex;
+        juce::String mQuery;
+        std::vector<int> mResult;
+    };
+
+private:
+
+    typedef std::pair<std::string, int> Token;
+    typedef std::vector<Token>::const_iterator TokenIterator;
+
+    static std::vector<std::string> tokenize(const juce::String& text)
+    {
+        std::vector<std::string> tokens;
+        std::string token;
+        juce::String lowerCaseText = text.toLowerCase();
+        for (const char* c = lowerCaseText.toRawUTF8(); ; c++)
+        {
+            if (*c == 0 || *c == '/' || *c == ' ' || *c == '_' || *c == ':' || *c == '.')
+            {
+                if (!token.empty())
+                    tokens.push_back(token);
+                token.clear();
+                if (*c == 0)
+                    break;
+            }
+            else
+            {
+                token += *c;
+            }
+        }
+        return tokens;
+    }
+
+    std::pair<TokenIterator, TokenIterator> getPrefixRange(const std::string& prefix) const
+    {
+        TokenIterator first = std::lower_bound(mTokens.begin(), mTokens.end(), Token(prefix, -1));
+        TokenIterator last = first;
+        while (last != mTokens.end() && last->first.compare(0, prefix.size(), prefix) == 0)
+            ++last;
+        return { first, last };
+    }
+
+    bool matches(int parameterIndex, const std::vector<std::string>& terms) const
+    {
+        for (auto& term : terms)
+        {
+            bool found = false;
+            for (auto& token : mTokensOf[(size_t)parameterIndex])
+            {
+                if (token.compare(0, term.size(), term) == 0)
+                {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+                return false;
+        }
+        return true;
+    }
+
+    std::vector<int> filter(const std::vector<int>& candidates, const std::vector<std::string>& terms) const
+    {
+        std::vector<int> result;
+        for (int parameterIndex : candidates)
+        {
+            if (matches(parameterIndex, terms))
+                result.push_back(parameterIndex);
+        }
+        return result;
+    }
+
+    std::vector<Token> mTokens;
+    std::vector<std::vector<std::string>> mTokensOf;
+    juce::HashMap<juce::String, int> mIndexByName;                   // by unique name
+    juce::HashMap<juce::String, std::vector<int>> mIndicesByName;    // by table name
+    std::vector<juce::String> mUniqueNames;
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AddressIndex.h"
+#include "WritePlan.h"
+
+// Difference of two patch states as a write plan. The states are flat value arrays indexed like SY1000Param
+// (SY1000ValueStore::getSnapshot), the walk follows the address order of the index.
+// Only changed parameters are written, except short runs of unchanged parameters between two changes:
+// sending them again is cheaper than the header and checksum of another DT1, so both changes share one DT1.
+class SY1000PatchDiff
+{
+public:
+
+    // Bytes a DT1 adds to its data bytes: F0, 6 header bytes, command, 4 address bytes, checksum, F7
+    static constexpr int dt1Overhead = 14;
+
+    // Adds the values of "to" that differ from "from" to writePlan, returns the number of changed parameters
+    static int diff(const SY1000AddressIndex& addressIndex, const std::vector<int>& from, const std::vector<int>& to, SY1000WritePlan& writePlan)
+    {
+        jassert(from.size() == to.size());
+        int numChanged = 0;
+        bool isInRun = false;
+        juce::uint32 runEnd = 0;
+        int bridgeBytes = 0;
+        std::vector<int> bridge;
+
+        for (auto& entry : addressIndex.getEntries())
+        {
+            int parameterIndex = entry.parameterIndex;
+            if ((size_t)parameterIndex >= to.size() || !addressIndex.isWritable(parameterIndex))
+                continue;
+
+            if (from[(size_t)parameterIndex] != to[(size_t)parameterIndex])
+            {
+                // close the gap to the previous change if it is contiguous and short
+                if (isInRun && entry.linearAddress == runEnd)
+                {
+                    for (int bridgeIndex : bridge)
+                        writePlan.add(bridgeIndex, to[(size_t)bridgeIndex]);
+                }
+                writePlan.add(parameterIndex, to[(size_t)parameterIndex]);
+                numChanged++;
+                isInRun = true;
+                runEnd = entry.linearAddress + (juce::uint32)entry.dataBytes;
+                bridge.clear();
+                bridgeBytes = 0;
+            }
+            else if (isInRun)
+            {
+                if (entry.linearAddress == runEnd && bridgeBytes + entry.dataBytes <= dt1Overhead)
+                {
+                    bridge.push_back(parameterIndex);
+                    bridgeBytes += entry.dataBytes;
+                    runEnd = entry.linearAddress + (juce::uint32)entry.dataBytes;
+                }
+                else
+                {
+                    isInRun = false;
+                    bridge.clear();
+                    bridgeBytes = 0;
+                }
+            }
+        }
+        return numChanged;
+    }
+};
@@ -0,0 +1,387 @@
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+namespace
+{
+    const int rowHeight = 24;
+}
+
+//==============================================================================
+class SY1000AudioProcessorEditor::ParameterRowComponent  : public juce::Component
+{
+public:
+    ParameterRowComponent (SY1000AudioProcessorEditor& e, int parameterIndex, const juce::String& labelText)
+        : editor (e), index (parameterIndex)
+    {
+        label.setText (labelText, juce::dontSendNotification);
+        label.setMinimumHorizontalScale (0.7f);
+        label.setInterceptsMouseClicks (false, false);
+        addAndMakeVisible (label);
+
+        slider.setSliderStyle (juce::Slider::LinearHorizontal);
+        slider.setTextBoxStyle (juce::Slider::TextBoxRight, false, 110, rowHeight - 4);
+        addAndMakeVisible (slider);
+
+        // Range and text come from the table, parameters without host parameter (slot mode) are set directly
+        auto& processor = editor.getProcessor();
+        auto& data = processor.SY1000Param.getParameterData (index);
+        slider.setRange (processor.hostSlots.getMinValue (index), processor.hostSlots.getMaxValue (index), 1.0);
+        slider.textFromValueFunction = [this] (double value) { return editor.getProcessor().hostSlots.getText (index, (int) value); };
+        slider.valueFromTextFunction = [this, &data] (const juce::String& text)
+        {
+            return (double) (data.choices.size() > 0 ? juce::jmax (0, data.choices.indexOf (text)) : text.getIntValue());
+        };
+        // The host parameter is looked up on every use, a slot can be remapped while the row exists
+        slider.onDragStart = [this] { if (auto* parameter = editor.getProcessor().getHostParameter (index)) parameter->beginChangeGesture(); };
+        slider.onDragEnd = [this] { if (auto* parameter = editor.getProcessor().getHostParameter (index)) parameter->endChangeGesture(); };
+        slider.onValueChange = [this, &data]
+        {
+            if (isRefreshing)
+                return;
+
+            if (auto* parameter = editor.getProcessor().getHostParameter (index))
+                parameter->setValueNotifyingHost (editor.getProcessor().toHostValue (index, (int) slider.getValue()));
+            else
+                editor.getProcessor().updatePluginParameter (data.parameterID, (int) slider.getValue(), data.parameterName);
+        };
+        refresh();
+
+        editor.addVisibleRow (this);
+    }
+
+    ~ParameterRowComponent() override
+    {
+        editor.removeVisibleRow (this);
+    }
+
+    int getParameterIndex() const   { return index; }
+
+    // Show the current parameter value without sending it back
+    void refresh()
+    {
+        isRefreshing = true;
+        slider.setValue (editor.getProcessor().parameterValues.get (index), juce::dontSendNotification);
+        slider.updateText();
+        isRefreshing = false;
+    }
+
+    void resized() override
+    {
+        auto bounds = getLocalBounds();
+        label.setBounds (bounds.removeFromLeft (bounds.getWidth() * 2 / 5));
+        slider.setBounds (bounds);
+    }
+
+    // Right click on the label: host slot, macro and modulator assignment of the parameter
+    void mouseDown (const juce::MouseEvent& e) override
+    {
+        if (! e.mods.isPopupMenu())
+            return;
+
+        auto& processor = editor.getProcessor();
+        juce::PopupMenu slotMenu;
+        int currentSlot = processor.hostSlots.getSlot (index);
+        slotMenu.addItem ("Remove from slot", currentSlot >= 0, false, [this] { editor.getProcessor().setSlotParameter (editor.getProcessor().hostSlots.getSlot (index), -1); });
+        slotMenu.addSeparator();
+        for (int slot = 0; slot < SY1000HostSlots::numSlots; slot++)
+        {
+            int slotParameter = processor.hostSlots.getSlotParameter (slot);
+            juce::String text = "Slot " + juce::String (slot + 1);
+            if (slotParameter >= 0)
+                text += " (" + processor.SY1000Param.getParameterData (slotParameter).parameterName + ")";
+            slotMenu.addItem (text, true, slot == currentSlot, [this, slot] { editor.getProcessor().setSlotParameter (slot, index); });
+        }
+
+        juce::PopupMenu macroMenu;
+        for (int m = 0; m < SY1000MacroMap::numMacros; m++)
+        {
+            auto targets = processor.getMacroTargets (m);
+            bool isTarget = std::any_of (targets.begin(), targets.end(), [this] (const SY1000MacroMap::Target& target) { return target.parameterIndex == index; });
+            macroMenu.addItem ("Macro " + juce::String (m + 1), true, isTarget, [this, m] { toggleMacroTarget (m); });
+        }
+
+        juce::PopupMenu modulatorMenu;
+        modulatorMenu.addItem ("LFO", [this] { addModulator (SY1000ModulationEngine::LFO); });
+        modulatorMenu.addItem ("Envelope follower (note velocity)", [this] { addModulator (SY1000ModulationEngine::ENVELOPE); });
+        modulatorMenu.addItem ("Step sequencer", [this] { addModulator (SY1000ModulationEngine::STEP); });
+
+        juce::PopupMenu menu;
+        menu.addSectionHeader (processor.SY1000Param.getParameterData (index).parameterName);
+        menu.addSubMenu ("Host slot", slotMenu, processor.hostSlots.isSlotMode());
+        menu.addSubMenu ("Macro target", macroMenu);
+        menu.addSubMenu ("Add modulator", modulatorMenu);
+        menu.showMenuAsync (juce::PopupMenu::Options().withTargetComponent (this));
+    }
+
+private:
+    // Adds the parameter with its full range to the macro, or removes it
+    void toggleMacroTarget (int macroIndex)
+    {
+        auto& processor = editor.getProcessor();
+        auto targets = processor.getMacroTargets (macroIndex);
+        auto end = std::remove_if (targets.begin(), targets.end(), [this] (const SY1000MacroMap::Target& target) { return target.parameterIndex == index; });
+        if (end != targets.end())
+        {
+            targets.erase (end, targets.end());
+        }
+        else
+        {
+            SY1000MacroMap::Target target;
+            target.parameterIndex = index;
+            target.minValue = processor.hostSlots.getMinValue (index);
+            target.maxValue = processor.hostSlots.getMaxValue (index);
+            targets.push_back (target);
+        }
+        processor.setMacroTargets (macroIndex, targets);
+    }
+
+    // Modulator around the current value with the default settings
+    void addModulator (SY1000ModulationEngine::Source source)
+    {
+        SY1000ModulationEngine::Modulator modulator;
+        modulator.parameterIndex = index;
+        modulator.source = source;
+        modulator.center = (int) slider.getValue();
+        if (source == SY1000ModulationEngine::STEP)
+            modulator.steps = { -1.0, -0.5, 0.0, 0.5, 1.0, 0.5, 0.0, -0.5 };
+        editor.getProcessor().addModulator (modulator);
+    }
+
+    SY1000AudioProcessorEditor& editor;
+    int index;
+    bool isRefreshing = false;
+    juce::Label label;
+    juce::Slider slider;
+};
+
+namespace
+{
+    //==============================================================================
+    class ParameterItem  : public juce::TreeViewItem
+    {
+    public:
+        ParameterItem (SY1000AudioProcessorEditor& e, int index, const juce::String& labelText)
+            : editor (e), parameterIndex (index), label (labelText)
+        {
+        }
+
+        bool mightContainSubItems() override            { return false; }
+        int getItemHeight() const override              { return rowHeight; }
+        juce::String getUniqueName() const override     { return juce::String (parameterIndex); }
+
+        std::unique_ptr<juce::Component> createItemComponent() override
+        {
+            return std::make_unique<SY1000AudioProcessorEditor::ParameterRowComponent> (editor, parameterIndex, label);
+        }
+
+    private:
+        SY1000AudioProcessorEditor& editor;
+        int parameterIndex;
+        juce::String label;
+    };
+
+    //==============================================================================
+    // One level of the parameter name hierarchy. The sub items are built on the first opening.
+    class ParameterGroupItem  : public juce::TreeViewItem
+    {
+    public:
+        ParameterGroupItem (SY1000AudioProcessorEditor& e, const juce::String& groupPath)
+            : editor (e), path (groupPath)
+        {
+        }
+
+        bool mightContainSubItems() override            { return true; }
+        int getItemHeight() const override              { return rowHeight; }
+        juce::String getUniqueName() const override     { return path; }
+
+        void paintItem (juce::Graphics& g, int width, int height) override
+        {
+            g.setColour (juce::Colours::white);
+            g.setFont (juce::Font (15.0f).boldened());
+            g.drawText (path.fromLastOccurrenceOf ("/", false, false), 4, 0, width - 4, height, juce::Justification::centredLeft, true);
+        }
+
+        void itemOpennessChanged (bool isNowOpen) override
+        {
+            if (isNowOpen && getNumSubItems() == 0)
+                buildSubItems();
+        }
+
+    private:
+        void buildSubItems()
+        {
+            juce::String prefix = path.isEmpty() ? juce::String() : path + "/";
+            juce::StringArray groups;
+
+            auto& parameterTable = editor.getProcessor().SY1000Param;
+            for (int i = 0; i < (int) parameterTable.size(); i++)
+            {
+                const juce::String& name = parameterTable.getParameterData (i).parameterName;
+                if (! name.startsWith (prefix))
+                    continue;
+
+                juce::String rest = name.substring (prefix.length());
+                juce::String segment = rest.upToFirstOccurrenceOf ("/", false, false);
+
+                if (segment.length() == rest.length())
+                {
+                    addSubItem (new ParameterItem (editor, i, segment));
+                }
+                else if (! groups.contains (segment))
+                {
+                    groups.add (segment);
+                    addSubItem (new ParameterGroupItem (editor, prefix + segment));
+                }
+            }
+        }
+
+        SY1000AudioProcessorEditor& editor;
+        juce::String path;
+    };
+}
+
+//==============================================================================
+SY1000AudioProcessorEditor::SY1000AudioProcessorEditor (SY1000AudioProcessor& p)
+    : AudioProcessorEditor (&p), audioProcessor (p), search (p.parameterSearchIndex)
+{
+    rootItem = std::make_unique<ParameterGroupItem> (*this, juce::String());
+    parameterTree.setRootItem (rootItem.get());
+    parameterTree.setRootItemVisible (false);
+    rootItem->setOpen (true);
+    addAndMakeVisible (parameterTree);
+
+    searchBox.setTextToShowWhenEmpty ("Search parameter (e.g. inst1 lfo1 rate)", juce::Colours::grey);
+    searchBox.onTextChange = [this] { updateSearch(); };
+    searchBox.onEscapeKey = [this] { searchBox.clear(); updateSearch(); };
+    addAndMakeVisible (searchBox);
+
+    optionsButton.onClick = [this] { showOptionsMenu(); };
+    addAndMakeVisible (optionsButton);
+
+    searchResultList.setModel (this);
+    searchResultList.setRowHeight (rowHeight);
+    addChildComponent (searchResultList);
+
+    setResizable (true, true);
+    setResizeLimits (400, 300, 1600, 1600);
+    setSize (640, 720);
+
+    startTimerHz (30);
+}
+
+SY1000AudioProcessorEditor::~SY1000AudioProcessorEditor()
+{
+    stopTimer();
+    parameterTree.setRootItem (nullptr);
+    searchResultList.setModel (nullptr);
+}
+
+//==============================================================================
+void SY1000AudioProcessorEditor::addVisibleRow (ParameterRowComponent* row)
+{
+    visibleRows.add (row);
+}
+
+void SY1000AudioProcessorEditor::removeVisibleRow (ParameterRowComponent* row)
+{
+    visibleRows.removeFirstMatchingValue (row);
+}
+
+void SY1000AudioProcessorEditor::timerCallback()
+{
+    audioProcessor.dirtyParameters.takeAll (dirtySnapshot);
+    for (auto* row : visibleRows)
+    {
+        if (SY1000DirtyBits::isSet (dirtySnapshot, row->getParameterIndex()))
+            row->refresh();
+    }
+}
+
+//==============================================================================
+void SY1000AudioProcessorEditor::paint (juce::Graphics& g)
+{
+    g.fillAll (getLookAndFeel().findColour (juce::ResizableWindow::backgroundColourId));
+}
+
+void SY1000AudioProcessorEditor::resized()
+{
+    auto bounds = getLocalBounds().reduced (4);
+    auto topBar = bounds.removeFromTop (rowHeight + 4);
+    optionsButton.setBounds (topBar.removeFromRight (80));
+    topBar.removeFromRight (4);
+    searchBox.setBounds (topBar);
+    bounds.removeFromTop (4);
+    parameterTree.setBounds (bounds);
+    searchResultList.setBounds (bounds);
+}
+
+// Settings of the instance: host parameter exposure, morph and modulators
+void SY1000AudioProcessorEditor::showOptionsMenu()
+{
+    juce::PopupMenu exposureMenu;
+    auto mode = SY1000HostSlots::loadMode();
+    exposureMenu.addItem ("All parameters", true, mode == SY1000HostSlots::ALL_PARAMETERS, [this] { audioProcessor.setParameterExposure (SY1000HostSlots::ALL_PARAMETERS); });
+    exposureMenu.addItem (juce::String (SY1000HostSlots::numSlots) + " remappable slots", true, mode == SY1000HostSlots::SLOTS, [this] { audioProcessor.setParameterExposure (SY1000HostSlots::SLOTS); });
+
+    // The stored values are the target, the morph starts from the values at the time it is started
+    juce::PopupMenu morphMenu;
+    bool hasMorphTarget = ! morphTarget.empty();
+    morphMenu.addItem ("Store current values as target", [this] { morphTarget = audioProcessor.parameterValues.getSnapshot(); });
+    morphMenu.addSeparator();
+    morphMenu.addItem ("Morph to target in 1 s", hasMorphTarget, false, [this] { audioProcessor.startMorph (morphTarget, 1000.0); });
+    morphMenu.addItem ("Morph to target in 4 s", hasMorphTarget, false, [this] { audioProcessor.startMorph (morphTarget, 4000.0); });
+    morphMenu.addItem ("Morph to target in 1 bar (4 beats)", hasMorphTarget, false, [this] { audioProcessor.startMorphBeats (morphTarget, 4.0); });
+    morphMenu.addItem ("Stop morph", audioProcessor.isMorphing(), false, [this] { audioProcessor.stopMorph(); });
+
+    juce::PopupMenu menu;
+    menu.addSubMenu ("Host parameters (next plugin load)", exposureMenu);
+    menu.addSubMenu ("Morph", morphMenu);
+    menu.addItem ("Clear modulators", [this] { audioProcessor.clearModulators(); });
+    menu.showMenuAsync (juce::PopupMenu::Options().withTargetComponent (&optionsButton));
+}
+
+void SY1000AudioProcessorEditor::updateSearch()
+{
+    searchResult = search.update (searchBox.getText());
+    bool isSearching = searchBox.getText().trim().isNotEmpty();
+    parameterTree.setVisible (! isSearching);
+    searchResultList.setVisible (isSearching);
+    searchResultList.updateContent();
+}
+
+//==============================================================================
+int SY1000AudioProcessorEditor::getNumRows()
+{
+    return (int) searchResult.size();
+}
+
+void SY1000AudioProcessorEditor::paintListBoxItem (int, juce::Graphics&, int, int, bool)
+{
+}
+
+juce::Component* SY1000AudioProcessorEditor::refreshComponentForRow (int rowNumber, bool, juce::Component* existingComponentToUpdate)
+{
+    if (! juce::isPositiveAndBelow (rowNumber, (int) searchResult.size()))
+    {
+        delete existingComponentToUpdate;
+        return nullptr;
+    }
+
+    int parameterIndex = searchResult[(size_t) rowNumber];
+    if (auto* row = dynamic_cast<ParameterRowComponent*> (existingComponentToUpdate))
+    {
+        if (row->getParameterIndex() == parameterIndex)
+            return row;
+    }
+
+    delete existingComponentToUpdate;
+    return new ParameterRowComponent (*this, parameterIndex, audioProcessor.SY1000Param.getParameterData (parameterIndex).parameterName);
+}
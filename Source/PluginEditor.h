@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+// Shows the SY1000 parameters as a tree of their hierarchical names (INST1/DYNAMIC SYNTH/LFO1/...).
+// Group items create their sub items when they are opened for the first time, and the TreeView creates
+// the control components only for the rows that are visible.
+// While the search field is not empty, a ListBox shows the matching parameters instead of the tree.
+// The rows on screen are refreshed by a frame timer from the dirty bits of the processor, so there is no
+// listener per parameter and the refresh cost scales with the number of changed parameters per frame.
+// A right click on a row assigns the parameter to a host slot, a macro or a modulator, the Options menu
+// holds the settings of the instance.
+class SY1000AudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                    private juce::ListBoxModel,
+                                    private juce::Timer
+{
+public:
+    SY1000AudioProcessorEditor (SY1000AudioProcessor&);
+    ~SY1000AudioProcessorEditor() override;
+
+    //==============================================================================
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+    // Control row of one parameter, it registers itself while it exists
+    class ParameterRowComponent;
+    void addVisibleRow (ParameterRowComponent*);
+    void removeVisibleRow (ParameterRowComponent*);
+
+    SY1000AudioProcessor& getProcessor()    { return audioProcessor; }
+
+private:
+    void timerCallback() override;
+
+    // juce::ListBoxModel for the search result
+    int getNumRows() override;
+    void paintListBoxItem (int rowNumber, juce::Graphics&, int width, int height, bool rowIsSelected) override;
+    juce::Component* refreshComponentForRow (int rowNumber, bool isRowSelected, juce::Component* existingComponentToUpdate) override;
+
+    void updateSearch();
+    void showOptionsMenu();
+
+    SY1000AudioProcessor& audioProcessor;
+
+    juce::TreeView parameterTree;
+    std::unique_ptr<juce::TreeViewItem> rootItem;
+
+    juce::TextEditor searchBox;
+    juce::TextButton optionsButton { "Options" };
+    std::vector<int> morphTarget;
+    juce::ListBox searchResultList;
+    SY1000ParameterSearchIndex::Search search;
+    std::vector<int> searchResult;
+
+    juce::Array<ParameterRowComponent*> visibleRows;
+    std::vector<juce::uint64> dirtySnapshot;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SY1000AudioProcessorEditor)
+};
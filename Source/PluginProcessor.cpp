@@ -7,9 +7,49 @@
 */
 
 #include "PluginProcessor.h"
+#include "PluginEditor.h"
 #include "Parameter.h"
 #include <bitset>
 
+namespace
+{
+    // Block time of the change processBlock is making on this thread, -1 outside processBlock.
+    // The output scheduler starts the resulting writes at this position of the block.
+    thread_local double currentChangeTime = -1.0;
+
+    struct ScopedChangeTime
+    {
+        ScopedChangeTime(double changeTime) : previousChangeTime(currentChangeTime) { currentChangeTime = changeTime; }
+        ~ScopedChangeTime() { currentChangeTime = previousChangeTime; }
+        double previousChangeTime;
+    };
+
+    // Suppressed address range of the processor that is running a ScopedSuppressedRange on this thread
+    struct SuppressedRange
+    {
+        const SY1000AudioProcessor* processor = nullptr;
+        juce::uint32 beginAddress = 0;
+        juce::uint32 endAddress = 0;
+    };
+    thread_local SuppressedRange currentSuppressedRange;
+
+    // Innermost patch transfer running on this thread
+    thread_local SY1000AudioProcessor::ScopedPatchTransfer* currentPatchTransfer = nullptr;
+}
+
+SY1000AudioProcessor::ScopedSuppressedRange::ScopedSuppressedRange(const SY1000AudioProcessor& processor, juce::uint32 beginAddress, juce::uint32 endAddress)
+    : previousProcessor(currentSuppressedRange.processor),
+      previousBeginAddress(currentSuppressedRange.beginAddress),
+      previousEndAddress(currentSuppressedRange.endAddress)
+{
+    currentSuppressedRange = { &processor, beginAddress, endAddress };
+}
+
+SY1000AudioProcessor::ScopedSuppressedRange::~ScopedSuppressedRange()
+{
+    currentSuppressedRange = { previousProcessor, previousBeginAddress, previousEndAddress };
+}
+
 //==============================================================================
 SY1000AudioProcessor::SY1000AudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -25,21 +65,25 @@ SY1000AudioProcessor::SY1000AudioProcessor()
 {
     if (isDebugMode) juce::Logger::writeToLog("[SY1000] ***** START ***** ");
 
-    // Add a parameter listener for all sliders 
-    for (size_t i = 0; i < SY1000Param.size(); i++)
+    // One listener for all parameters, the callback gets the parameter index (= index in SY1000Param)
+    for (auto* parameter : getParameters())
     {
-        apvts.addParameterListener(juce::String(i), this);
+        parameter->addListener(this);
     }
 
-    // SY1000 Parameter Assingments
-#include "ParameterAssignments.h"
-
-    
- 
- }
+}
 
 SY1000AudioProcessor::~SY1000AudioProcessor()
 {
+    cancelPendingUpdate();
+    for (auto* parameter : getParameters())
+    {
+        parameter->removeListener(this);
+    }
+
+    if (isPrepared)
+        sharedDevice->releaseInstance(this);
+
     if (isDebugMode) juce::Logger::writeToLog("[SY1000] ***** END ***** ");
 }
 
@@ -112,9 +156,26 @@ void SY1000AudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock
     // initialisation that you need..
     if (isDebugMode) juce::Logger::writeToLog("[SY1000] prepareToPlay ");
 
-    isNewMidiOutMessage = false;
-    if (isDebugMode) juce::Logger::writeToLog("[SY1000] activate SysEx sync....");
-    sendSysEx("7F000001", 1, 1);
+    blockTiming.sampleRate = sampleRate;
+    blockTiming.blockTime = juce::Time::getMillisecondCounterHiRes();
+
+    lastActivityTime = blockTiming.blockTime;
+    setDormant(false);
+    {
+        const juce::SpinLock::ScopedLockType lock(tempoLock);
+        tempoEngine.reset();
+    }
+
+    // The first prepared instance of the process activates the SysEx sync, the others share it
+    if (!isPrepared)
+    {
+        isPrepared = true;
+        if (sharedDevice->prepareInstance(this))
+        {
+            if (isDebugMode) juce::Logger::writeToLog("[SY1000] activate SysEx sync....");
+            sendSysEx("7F000001", 1, 1);
+        }
+    }
 
 
 }
@@ -123,6 +184,12 @@ void SY1000AudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
+    setDormant(true);
+    if (isPrepared)
+    {
+        isPrepared = false;
+        sharedDevice->releaseInstance(this);
+    }
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -154,6 +221,10 @@ bool SY1000AudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) c
 void SY1000AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    blockTiming.blockTime = juce::Time::getMillisecondCounterHiRes();
+    blockTiming.numSamples = buffer.getNumSamples();
+    // writes of this block start at its beginning, writes of an incoming message at its sample position
+    ScopedChangeTime blockChangeTime(blockTiming.blockTime);
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -179,6 +250,23 @@ void SY1000AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce:
         // ..do something to the data...
     //}
 
+    // A dormant instance wakes up at the end of a host bypass, until then it does nothing. MIDI input doesn't
+    // wake it: the DT1 echoes and active sensing of the device would resynchronise a stale patch over the
+    // sound of the active instance.
+    bool isBypassEnd = isBypassed.exchange(false);
+    if (isDormant)
+    {
+        if (!isBypassEnd)
+        {
+            buffer.clear();
+            midiMessages.clear();
+            return;
+        }
+        setDormant(false);
+    }
+    if (!midiMessages.isEmpty())
+        lastActivityTime = blockTiming.blockTime;
+
     // Get the BPM info from Host
     playHead = this->getPlayHead();
     if (playHead != nullptr)
@@ -188,11 +276,22 @@ void SY1000AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce:
         {
             // Host BPM value changed..
             myBPM = currentPositionInfo.bpm;
-            if (isDebugMode) juce::Logger::writeToLog("[SY1000] Host BPM change :  " + juce::String(myBPM));
+            if (isDebugMode) juce::Logger::writeToLog("[SY1000] Host BPM change :  " + juce::String(myBPM.load()));
+        }
+
+        // BPM * 10, paced by the tempo engine during host tempo ramps
+        int bpmValue = -1;
+        {
+            const juce::SpinLock::ScopedTryLockType lock(tempoLock);
+            if (lock.isLocked())
+                bpmValue = tempoEngine.process(myBPM, blockTiming.blockTime);
+        }
+        if (bpmValue >= 0)
+        {
             // Send BPM to SY1000
-            sendSysEx("1000123E", 4, (int)myBPM * 10);
+            sendSysEx("1000123E", 4, bpmValue);
             // Update the Master Effect BPM parameter
-            updatePluginParameter("1000123E", 4, (int)myBPM * 10);
+            updatePluginParameter("1000123E", 4, bpmValue);
         }
     }
 
@@ -205,55 +304,162 @@ void SY1000AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce:
         auto message = metadata.getMessage();
         if (message.isSysEx())
         {
-            // check sysex header = "410000000069" SY1000 signature = ManufactorID + DeviceID + 4 Byte ModelID 
-            juce::String sysex = juce::String::toHexString(message.getSysExData(), message.getSysExDataSize(), 0);
-            if (sysex.startsWith("410000000069"))
+            // check sysex header = "410000000069" SY1000 signature = ManufactorID + DeviceID + 4 Byte ModelID,
+            // DT1 command, length and checksum. Bad frames are counted and dropped.
+            SY1000SysExDecoder::DT1 dt1;
+            SY1000SysExDecoder::Result result = SY1000SysExDecoder::parse(message.getSysExData(), message.getSysExDataSize(), dt1);
+            sysExDecoder.count(result);
+
+            double messageTime = blockTiming.blockTime + 1000.0 * metadata.samplePosition / blockTiming.sampleRate;
+            if (result == SY1000SysExDecoder::VALID && linkMeter.addReply(dt1, message.getRawDataSize(), messageTime))
             {
-                juce::String incomingHex = "";
-                int incomingValue = 0;
-                int incomingDataBytes = 0;
-                sysExInMessage = message.getDescription();
-                switch (sysex.length())
-                {
-                case 26:
-                    incomingDataBytes = 1;
-                    incomingValue = message.getSysExData()[11];
-                    break;
-                case 28: // DataByteQty 2-4 -> Only the lowest 4bit of 7bit chars will be used by SY1000.
-                    incomingDataBytes = 2;
-                    incomingValue = 16 * message.getSysExData()[11] + message.getSysExData()[12];
-                    break;
-                case 30:
-                    incomingDataBytes = 3;
-                    incomingValue = 256 * message.getSysExData()[11] + 16 * message.getSysExData()[12] + message.getSysExData()[13];
-                    break;
-                case 32:
-                    incomingDataBytes = 4;
-                    incomingValue = 4096 * message.getSysExData()[11] + 256 * message.getSysExData()[12] + 16 * message.getSysExData()[13] + message.getSysExData()[14];
-                    break;
-                case 40: // for PatchLed ON OFF STATE
-                    incomingDataBytes = 8;
-                    incomingValue = 268435456 * message.getSysExData()[11] + 16777216 * message.getSysExData()[12] + 1048576 * message.getSysExData()[13] + 65536 * message.getSysExData()[14] + 4096 * message.getSysExData()[15] + 256 * message.getSysExData()[16] + 16 * message.getSysExData()[17] + message.getSysExData()[18];
-                }
-                if (incomingDataBytes > 0)
-                {
-                    incomingHex = sysex.substring(14, 22).toUpperCase();
-                    if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx IN  : " + message.getDescription() + " Hex = " + incomingHex + " DataBytes = " + juce::String(incomingDataBytes) + " Value = " + juce::String(incomingValue));
-                    // New SysEx data -> Searches and sets the associated plugin parameter 
-                    updatePluginParameter(incomingHex, incomingDataBytes, incomingValue);
-                }
+                // reply to the link measurement, the values are not applied
+            }
+            else if (result == SY1000SysExDecoder::VALID)
+            {
+                ScopedChangeTime messageChangeTime(messageTime);
+                sharedDevice->setLastReceived(message.getDescription());
+                if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx IN  : " + message.getDescription() + " Hex = " + dt1.getHexAddress() + " DataBytes = " + juce::String(dt1.numDataBytes));
+                // New SysEx data -> Searches and sets the associated plugin parameters
+                applyIncomingDT1(dt1);
+            }
+            else if (result != SY1000SysExDecoder::OTHER_DEVICE)
+            {
+                if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx IN  : " + message.getDescription() + " ->  rejected (" + juce::String((int)result) + ")");
             }
         }
     }
+    processModulation(midiMessages);
+    midiMessages.clear();
+
+    processMorph();
+
+    // The output owner sends the MidiOut messages of all instances as far as the MIDI link allows.
+    // If a writer holds the lock, the messages go out with the next block.
+    const juce::ScopedTryLock lock(midiOutLock);
+    if (lock.isLocked())
+    {
+        if (needsLinkMeasurement.exchange(false))
+        {
+            if (isDebugMode) juce::Logger::writeToLog("[SY1000] measure MIDI link....");
+            transitionPlanner.addPacket("RQ1", SY1000LinkMeter::createRequest(), 0, 0, blockTiming.blockTime);
+            linkMeter.start(blockTiming.blockTime);
+            outputScheduler.takeRequestSentTime();
+        }
+        if (linkMeter.isWaitingForRequest())
+        {
+            // the output owner has sent the request, possibly in a block of its own
+            double requestSentTime = outputScheduler.takeRequestSentTime();
+            if (requestSentTime >= 0.0)
+                linkMeter.setRequestSentTime(requestSentTime);
+        }
+        double measuredBytesPerSecond = linkMeter.process(blockTiming.blockTime);
+        if (measuredBytesPerSecond > 0.0)
+        {
+            if (isDebugMode) juce::Logger::writeToLog("[SY1000] MIDI link measured -> BytesPerSecond = " + juce::String(measuredBytesPerSecond));
+            outputScheduler.setMeasuredBytesPerSecond(measuredBytesPerSecond);
+            // the message thread stores it in the settings
+            needsLinkSettingsSave = true;
+            triggerAsyncUpdate();
+        }
+        if (sharedDevice->claimOutput(this, blockTiming.blockTime))
+            outputScheduler.process(realtimeLane, transitionPlanner, midiMessages, blockTiming);
+    }
+
+    // Idle instance (e.g. in an inactive rackspace)
+    double timeoutMs = dormantTimeoutMs;
+    if (timeoutMs > 0.0 && blockTiming.blockTime - lastActivityTime > timeoutMs && !isMorphRunning && !hasModulators)
+        setDormant(true);
+}
+
+void SY1000AudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    isBypassed = true;
+    setDormant(true);
+    buffer.clear();
     midiMessages.clear();
+}
+
+void SY1000AudioProcessor::setDormant(bool shouldBeDormant)
+{
+    if (isDormant.exchange(shouldBeDormant) == shouldBeDormant)
+        return;
+
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] dormant -> " + juce::String(shouldBeDormant ? "on" : "off"));
+    if (shouldBeDormant)
+    {
+        stopMorph();
+        // another processing instance sends the queued writes
+        sharedDevice->releaseOutput(this);
+    }
+    else
+    {
+        lastActivityTime = juce::Time::getMillisecondCounterHiRes();
+        // the device may have another tempo now, the next host tempo is sent without hysteresis
+        const juce::SpinLock::ScopedLockType lock(tempoLock);
+        tempoEngine.reset();
+    }
+    // resynchronise or release the buffers on the message thread, the state may flip again until then
+    needsDormantUpdate = true;
+    triggerAsyncUpdate();
+}
+
+void SY1000AudioProcessor::handleAsyncUpdate()
+{
+    if (needsLinkSettingsSave.exchange(false))
+        sharedDevice->saveLinkSettings();
+    if (!needsDormantUpdate.exchange(false))
+        return;
 
-    // send MidiOut messages
-    if (isNewMidiOutMessage)
+    if (isDormant)
     {
-        isNewMidiOutMessage = false;
-        //sysExOutMessage = midiOutMessage.getDescription();
-        midiMessages.addEvent(midiOutMessage, 0);
+        const juce::SpinLock::ScopedLockType lock(morphLock);
+        if (!morphEngine.isRunning())
+            morphEngine.releaseBuffers();
+        return;
     }
+    resynchronise();
+}
+
+void SY1000AudioProcessor::setTempoSyncSettings(const SY1000TempoEngine::Settings& settings)
+{
+    const juce::SpinLock::ScopedLockType lock(tempoLock);
+    tempoEngine.setSettings(settings);
+}
+
+bool SY1000AudioProcessor::isDormantMode() const
+{
+    return isDormant;
+}
+
+void SY1000AudioProcessor::setDormantTimeout(double timeoutMs)
+{
+    dormantTimeoutMs = juce::jmax(0.0, timeoutMs);
+}
+
+// Sends the values of this instance that differ from the values the device is known to have (another
+// instance or changes during the dormant time). Called on the message thread after the wake up, the audio
+// thread only sends the queued packets.
+void SY1000AudioProcessor::resynchronise()
+{
+    std::vector<int> values = parameterValues.getSnapshot();
+    std::vector<int> deviceValues = sharedDevice->deviceValues.getSnapshot();
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        // inactive INST/FX engines get their values on activation, the registers are sent below
+        if (!engineRelevance.isRelevant((int)i) || SY1000Param.getParameterData((int)i).parameterType == SY1000Parameter::REGISTER)
+            deviceValues[i] = values[i];
+        else
+            sharedDevice->deviceValues.set((int)i, values[i]);
+    }
+
+    SY1000WritePlan writePlan(addressIndex);
+    int numChanged = SY1000PatchDiff::diff(addressIndex, deviceValues, values, writePlan);
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] resynchronise -> changed parameters = " + juce::String(numChanged));
+    queueWritePlan(writePlan);
+
+    sendSysEx("10000312", 8, registerA, true);
+    sendSysEx("1000031A", 8, registerB, true);
 }
 
 //==============================================================================
@@ -264,8 +470,7 @@ bool SY1000AudioProcessor::hasEditor() const
 
 juce::AudioProcessorEditor* SY1000AudioProcessor::createEditor()
 {
-    //return new SY1000AudioProcessorEditor (*this);
-    return new juce::GenericAudioProcessorEditor(*this);
+    return new SY1000AudioProcessorEditor (*this);
 }
 
 //==============================================================================
@@ -276,6 +481,11 @@ void SY1000AudioProcessor::getStateInformation (juce::MemoryBlock& destData)
     // as intermediaries to make it easy to save and load complex data.
     if (isDebugMode) juce::Logger::writeToLog("[SY1000] getStateInformation ");
     auto state = apvts.copyState();
+    // All values, also the ones without host parameter: a state saved in one exposure mode loads in the other
+    juce::StringArray values;
+    for (int value : parameterValues.getSnapshot())
+        values.add(juce::String(value));
+    state.setProperty("values", values.joinIntoString(","), nullptr);
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
 }
@@ -289,90 +499,98 @@ void SY1000AudioProcessor::setStateInformation (const void* data, int sizeInByte
 
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName(apvts.state.getType()))
-            apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
+        {
+            juce::ValueTree state = juce::ValueTree::fromXml(*xmlState);
+            {
+                // the mapping first, the macro values of the state evaluate their targets
+                SY1000MacroMap newMacroMap(SY1000Param);
+                newMacroMap.fromValueTree(state.getChildWithName("MACROS"));
+                setMacroMap(newMacroMap);
+            }
+            if (hostSlots.isSlotMode())
+                hostSlots.fromValueTree(state.getChildWithName("SLOTS"));
+            {
+                ScopedPatchTransfer patchTransfer(*this);
+                apvts.replaceState(state);
+                if (state.hasProperty("values"))
+                {
+                    std::vector<int> values;
+                    for (auto& value : juce::StringArray::fromTokens(state.getProperty("values").toString(), ",", ""))
+                        values.push_back(value.getIntValue());
+                    applyPatch(values);
+                }
+            }
+            if (hostSlots.isSlotMode())
+                updateHostDisplay();
+        }
+}
+
+void SY1000AudioProcessor::setMidiLinkProfile(SY1000OutputScheduler::LinkProfile profile, double customBytesPerSecond)
+{
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] MIDI link profile = " + juce::String((int)profile) + " BytesPerSecond = " + juce::String(customBytesPerSecond));
+    sharedDevice->setLinkProfile(profile, customBytesPerSecond);
+
+    if (profile == SY1000OutputScheduler::USB && outputScheduler.getMeasuredBytesPerSecond() <= 0.0)
+        measureMidiLink();
+}
+
+void SY1000AudioProcessor::measureMidiLink()
+{
+    needsLinkMeasurement = true;
+}
+
+SY1000OutputScheduler::Statistics SY1000AudioProcessor::getMidiOutStatistics() const
+{
+    return outputScheduler.getStatistics();
+}
+
+SY1000SysExDecoder::Statistics SY1000AudioProcessor::getSysExInStatistics() const
+{
+    return sysExDecoder.getStatistics();
 }
 
 void SY1000AudioProcessor::sendSysEx(juce::String hexAddress, int dataBytes, int value, bool forceSending)
 {
     juce::uint8 SysEx[20] = { 0x41, 0x00, 0x00, 0x00, 0x00, 0x69, 0x12, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-    int remainder = 0;
     // patch HexAddress
     SysEx[7] = (juce::uint8)hexAddress.substring(0, 2).getHexValue32();
     SysEx[8] = (juce::uint8)hexAddress.substring(2, 4).getHexValue32();
     SysEx[9] = (juce::uint8)hexAddress.substring(4, 6).getHexValue32();
     SysEx[10] = (juce::uint8)hexAddress.substring(6, 8).getHexValue32();
 
-    switch (dataBytes)
-    {
-    case 1:
-        SysEx[11] = (juce::uint8)(value & 127);
-        break;
-    case 2: // DataByteQty 2-4 -> Only the lowest 4bit of 7bit chars will be used by SY1000.
-        value = value & 255;
-        SysEx[11] = (juce::uint8)(value / 16);
-        remainder = value % 16;
-        SysEx[12] = (juce::uint8)remainder;
-        break;
-    case 3:
-        value = value & 4095;
-        SysEx[11] = (juce::uint8)(value / 256);
-        remainder = value % 256;
-        SysEx[12] = (juce::uint8)(remainder / 16);
-        remainder = remainder % 16;
-        SysEx[13] = (juce::uint8)remainder;
-        break;
-    case 4:
-        value = value & 65535;
-        SysEx[11] = (juce::uint8)(value / 4096);
-        remainder = value % 4096;
-        SysEx[12] = (juce::uint8)(remainder / 256);
-        remainder = remainder % 256;
-        SysEx[13] = (juce::uint8)(remainder / 16);
-        remainder = remainder % 16;
-        SysEx[14] = (juce::uint8)remainder;
-        break;
-    case 8:
-        //Value = Value & 4294967296;
-        SysEx[11] = (juce::uint8)(value / 268435456);
-        remainder = value % 268435456;
-        SysEx[12] = (juce::uint8)(remainder / 16777216);
-        remainder = remainder % 16777216;
-        SysEx[13] = (juce::uint8)(remainder / 1048576);
-        remainder = remainder % 1048576;
-        SysEx[14] = (juce::uint8)(remainder / 65536);
-        remainder = remainder % 65536;
-        SysEx[15] = (juce::uint8)(remainder / 4096);
-        remainder = remainder % 4096;
-        SysEx[16] = (juce::uint8)(remainder / 256);
-        remainder = remainder % 256;
-        SysEx[17] = (juce::uint8)(remainder / 16);
-        remainder = remainder % 16;
-        SysEx[18] = (juce::uint8)remainder;
-        break;
-    }
-    // Calculate Roland checksum of address and data bytes
-    int checksum = 0;
-    for (int i = 7; i <= 10 + dataBytes; i++)
-    {
-        checksum = checksum + SysEx[i];
-        // always keep checksum under 128
-        if (checksum > 128)
-        {
-            checksum = checksum - 128;
-        }
-    }
-    // Substract checksum from 128 to get the final checksum
-    checksum = 128 - checksum;
-    // Patch checksum byte
-    SysEx[(11 + dataBytes)] = (juce::uint8)checksum;
+    // patch data bytes
+    SY1000SysExCodec::encode(dataBytes, value, SysEx + 11);
 
-    // create SysEx message and set the isNewMidiMessage flag. SY1000AudioProcessor::processBlock will process the message
+    // Patch Roland checksum of address and data bytes
+    SysEx[(11 + dataBytes)] = SY1000SysExCodec::checksum(SysEx + 7, 4 + dataBytes);
+
+    // create SysEx message and queue it in the transition planner. SY1000AudioProcessor::processBlock will process the message
     midiOutMessage = juce::MidiMessage::createSysExMessage(SysEx, (12 + dataBytes));
 
     // Echo suppresson, don't send the same SysEx message that has been previously received. forceSending == true diable this behaviour
-    if (forceSending || midiOutMessage.getDescription() != sysExInMessage)
+    // A dormant instance sends nothing, the resynchronisation on wake up sends the differences
+    if (isDormant)
+    {
+        if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx OUT : ->  skipped (dormant)");
+        return;
+    }
+
+    if (forceSending || (!sharedDevice->isLastReceived(midiOutMessage.getDescription()) && !isSuppressedAddress(hexAddress)))
     {
-        isNewMidiOutMessage = true;
+        {
+            const juce::ScopedLock lock(midiOutLock);
+            // a write into a pending packet goes behind it on the bulk lane, the packet must not overwrite it
+            if (bulkTransferDepth == 0 && transitionPlanner.getTier(hexAddress) == SY1000TransitionPlanner::AUDIBLE && !transitionPlanner.isInPendingPacket(hexAddress))
+            {
+                realtimeLane.addWrite(hexAddress, midiOutMessage, currentChangeTime);
+                // a pending bulk write of this address must not overwrite the new value later
+                transitionPlanner.replaceIfPending(hexAddress, midiOutMessage);
+            }
+            else
+            {
+                transitionPlanner.addWrite(hexAddress, midiOutMessage, currentChangeTime);
+            }
+        }
         if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx OUT : " + midiOutMessage.getDescription() + " Hex = " + hexAddress + " DataBytes = " + juce::String(dataBytes) + " Value = " + juce::String(value));
     }
     else
@@ -383,60 +601,503 @@ void SY1000AudioProcessor::sendSysEx(juce::String hexAddress, int dataBytes, int
 
 
 
-// Searches and sets the associated plugin parameter value based on the received SysEx message data
-void SY1000AudioProcessor::updatePluginParameter(juce::String hexAddress, int dataBytes, int newValue)
+// Applies a DT1 of the device. One message can cover many consecutive addresses (e.g. a whole block dump),
+// every address slot is mapped to its parameter through the address index and the batch is applied in one pass.
+void SY1000AudioProcessor::applyIncomingDT1(const SY1000SysExDecoder::DT1& dt1)
 {
-    parameterAttributes = SY1000Param.getParameterAttributes(hexAddress, dataBytes);
-    if (parameterAttributes.isSingle)
+    juce::uint32 startAddress = SY1000AddressIndex::toLinear(dt1.address);
+
+    // The device already has these values, they must not be sent back. The range holds only for the
+    // writes of this call, not for other threads.
+    ScopedSuppressedRange suppressedRange(*this, startAddress, startAddress + (juce::uint32)dt1.numDataBytes);
     {
-        if (SY1000Param.getParameterData(hexAddress, dataBytes, SY1000Parameter::ParameterType::SINGLE, parameterData))
+        ScopedBulkTransfer bulkTransfer(*this);
+        int offset = 0;
+        while (offset < dt1.numDataBytes)
         {
-            updatePluginParameter(parameterData.parameterID, newValue, parameterData.parameterName);
+            // The entry whose width is exactly the rest of the message (single parameter DT1), otherwise the
+            // widest entry whose full width is in the message. A narrower entry would split a wide value.
+            const SY1000AddressIndex::Entry* match = nullptr;
+            int remainingBytes = dt1.numDataBytes - offset;
+            auto range = addressIndex.findAll(startAddress + (juce::uint32)offset);
+            for (auto* entry = range.first; entry != range.second; ++entry)
+            {
+                // DUALBPM is the virtual part of the DUALTIME value at the same address
+                if (entry->parameterType == SY1000Parameter::DUALBPM || entry->dataBytes > remainingBytes || !SY1000SysExCodec::isSupportedWidth(entry->dataBytes))
+                    continue;
+                if (entry->dataBytes == remainingBytes)
+                {
+                    match = entry;
+                    break;
+                }
+                if (match == nullptr || entry->dataBytes > match->dataBytes)
+                    match = entry;
+            }
+
+            if (match == nullptr)
+            {
+                // no parameter at this address (reserved byte)
+                offset++;
+                continue;
+            }
+
+            int newValue = 0;
+            SY1000SysExCodec::decode(match->dataBytes, dt1.data + offset, newValue);
+            updatePluginParameter(*match, newValue);
+            offset += match->dataBytes;
         }
     }
-    if (parameterAttributes.isDual)
+}
+
+SY1000AudioProcessor::ScopedPatchTransfer* SY1000AudioProcessor::getPatchTransfer() const
+{
+    return currentPatchTransfer != nullptr && &currentPatchTransfer->processor == this ? currentPatchTransfer : nullptr;
+}
+
+bool SY1000AudioProcessor::isSuppressedAddress(const juce::String& hexAddress) const
+{
+    juce::uint32 address = 0;
+    if (!SY1000AddressIndex::parseHexAddress(hexAddress, address))
+        return false;
+    juce::uint32 linearAddress = SY1000AddressIndex::toLinear(address);
+    return currentSuppressedRange.processor == this && linearAddress >= currentSuppressedRange.beginAddress && linearAddress < currentSuppressedRange.endAddress;
+}
+
+bool SY1000AudioProcessor::copyBlock(const juce::String& sourceName, const juce::String& destinationName)
+{
+    const SY1000Parameter::Block* source = SY1000Param.getBlock(sourceName);
+    const SY1000Parameter::Block* destination = SY1000Param.getBlock(destinationName);
+    if (source == nullptr || destination == nullptr || source == destination || source->templateName != destination->templateName)
+        return false;
+
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] copy block " + sourceName + " -> " + destinationName);
+    std::vector<int> values((size_t)source->numParameters);
+    for (int i = 0; i < source->numParameters; i++)
+        values[(size_t)i] = parameterValues.get(source->firstIndex + i);
+    writeBlock(*destination, values);
+    return true;
+}
+
+bool SY1000AudioProcessor::swapBlocks(const juce::String& nameA, const juce::String& nameB)
+{
+    const SY1000Parameter::Block* blockA = SY1000Param.getBlock(nameA);
+    const SY1000Parameter::Block* blockB = SY1000Param.getBlock(nameB);
+    if (blockA == nullptr || blockB == nullptr || blockA == blockB || blockA->templateName != blockB->templateName)
+        return false;
+
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] swap blocks " + nameA + " <-> " + nameB);
+    std::vector<int> valuesA((size_t)blockA->numParameters);
+    std::vector<int> valuesB((size_t)blockB->numParameters);
+    for (int i = 0; i < blockA->numParameters; i++)
+    {
+        valuesA[(size_t)i] = parameterValues.get(blockA->firstIndex + i);
+        valuesB[(size_t)i] = parameterValues.get(blockB->firstIndex + i);
+    }
+    writeBlock(*blockA, valuesB);
+    writeBlock(*blockB, valuesA);
+    return true;
+}
+
+void SY1000AudioProcessor::writeBlock(const SY1000Parameter::Block& block, const std::vector<int>& values)
+{
+    SY1000WritePlan writePlan(addressIndex);
+    juce::uint32 beginAddress = 0xFFFFFFFF;
+    juce::uint32 endAddress = 0;
+    for (int i = 0; i < block.numParameters; i++)
     {
-        if (SY1000Param.getParameterData(hexAddress, dataBytes, SY1000Parameter::ParameterType::DUALTIME, parameterData))
+        int parameterIndex = block.firstIndex + i;
+        if (addressIndex.isWritable(parameterIndex))
         {
-            updatePluginParameter(parameterData.parameterID, newValue, parameterData.parameterName);
+            const SY1000AddressIndex::Entry& layout = addressIndex.getLayout(parameterIndex);
+            beginAddress = juce::jmin(beginAddress, layout.linearAddress);
+            endAddress = juce::jmax(endAddress, layout.linearAddress + (juce::uint32)layout.dataBytes);
+            writePlan.add(parameterIndex, values[(size_t)i]);
         }
     }
-    if (parameterAttributes.isRegister)
+
+    // The host gets the changed values, the single writes of the resulting parameterChanged calls are
+    // suppressed, the device gets the whole block as packed DT1s
     {
-        if (SY1000Param.getParameterData(hexAddress, dataBytes, SY1000Parameter::ParameterType::REGISTER, parameterData))
+        ScopedSuppressedRange suppressedRange(*this, beginAddress, endAddress);
+        ScopedBulkTransfer bulkTransfer(*this);
+        for (int i = 0; i < block.numParameters; i++)
         {
-            if (hexAddress == "10000312")
-            {
-                registerA = newValue;
-            }
-            if (hexAddress == "1000031A")
+            // DUALBPM follows its DUALTIME parameter
+            int parameterIndex = block.firstIndex + i;
+            if (addressIndex.isWritable(parameterIndex))
             {
-                registerB = newValue;
+                const SY1000Parameter::Data& data = SY1000Param.getParameterData(parameterIndex);
+                updatePluginParameter(data.parameterID, values[(size_t)i], data.parameterName);
             }
-            //updatePluginParameter(parameterData.parameterID, newValue, parameterData.parameterName);
-            updatePluginRegisterbitParameter(hexAddress);
         }
     }
+
+    queueWritePlan(writePlan);
+}
+
+SY1000AudioProcessor::ScopedPatchTransfer::ScopedPatchTransfer(SY1000AudioProcessor& p)
+    : processor(p), bulkTransfer(p), valuesBefore(p.parameterValues.getSnapshot()),
+      registerABefore(p.registerA), registerBBefore(p.registerB),
+      suppressedRange(p, 0, 0xFFFFFFFF),
+      previousPatchTransfer(currentPatchTransfer), changedIndices(valuesBefore.size(), false)
+{
+    currentPatchTransfer = this;
+}
+
+SY1000AudioProcessor::ScopedPatchTransfer::~ScopedPatchTransfer()
+{
+    currentPatchTransfer = previousPatchTransfer;
+
+    std::vector<int> valuesAfter = processor.parameterValues.getSnapshot();
+    for (size_t i = 0; i < valuesAfter.size(); i++)
+    {
+        // changes of other threads are sent by them
+        if (!changedIndices[i])
+            valuesAfter[i] = valuesBefore[i];
+        // inactive INST/FX engines get their changes on activation
+        if (valuesAfter[i] != valuesBefore[i] && !processor.engineRelevance.isRelevant((int)i) && processor.engineRelevance.defer((int)i))
+            valuesBefore[i] = valuesAfter[i];
+    }
+
+    SY1000WritePlan writePlan(processor.addressIndex);
+    for (int activatedIndex : activatedIndices)
+    {
+        if (processor.engineRelevance.isRelevant(activatedIndex))
+            writePlan.add(activatedIndex, valuesAfter[(size_t)activatedIndex]);
+    }
+    int numChanged = SY1000PatchDiff::diff(processor.addressIndex, valuesBefore, valuesAfter, writePlan);
+    if (processor.isDebugMode) juce::Logger::writeToLog("[SY1000] patch transfer -> changed parameters = " + juce::String(numChanged));
+    processor.queueWritePlan(writePlan);
+
+    // Pedal states are bits of the register parameters, they have no value of their own in the store
+    if (processor.registerA != registerABefore)
+        processor.sendSysEx("10000312", 8, processor.registerA, true);
+    if (processor.registerB != registerBBefore)
+        processor.sendSysEx("1000031A", 8, processor.registerB, true);
+}
+
+void SY1000AudioProcessor::applyPatch(const std::vector<int>& values)
+{
+    // inside a running patch transfer (state restore) the changes are part of its diff
+    std::unique_ptr<ScopedPatchTransfer> patchTransfer;
+    if (getPatchTransfer() == nullptr)
+        patchTransfer = std::make_unique<ScopedPatchTransfer>(*this);
+
+    for (int i = 0; i < (int)values.size() && i < (int)SY1000Param.size(); i++)
+    {
+        const SY1000Parameter::Data& data = SY1000Param.getParameterData(i);
+        // DUALBPM follows its DUALTIME parameter, REGISTER follows its REGISTERBIT parameters
+        if (data.parameterType != SY1000Parameter::DUALBPM && data.parameterType != SY1000Parameter::REGISTER)
+            updatePluginParameter(data.parameterID, values[(size_t)i], data.parameterName);
+    }
+}
+
+void SY1000AudioProcessor::startMorph(const std::vector<int>& target, double durationMs, double switchPoint)
+{
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] start morph -> Duration = " + juce::String(durationMs) + " ms");
+    const juce::SpinLock::ScopedLockType lock(morphLock);
+    morphEngine.start(parameterValues.getSnapshot(), target, durationMs, switchPoint);
+    morphStartTime = juce::Time::getMillisecondCounterHiRes();
+    isMorphRunning = morphEngine.isRunning();
+}
+
+void SY1000AudioProcessor::startMorphBeats(const std::vector<int>& target, double beats, double switchPoint)
+{
+    double bpm = myBPM;
+    startMorph(target, beats * 60000.0 / (bpm > 0.0 ? bpm : 120.0), switchPoint);
+}
+
+void SY1000AudioProcessor::stopMorph()
+{
+    const juce::SpinLock::ScopedLockType lock(morphLock);
+    morphEngine.stop();
+    isMorphRunning = false;
+}
+
+bool SY1000AudioProcessor::isMorphing() const
+{
+    return isMorphRunning;
+}
+
+// Called by processBlock, writes the morph values that fit into the bandwidth of this block
+void SY1000AudioProcessor::processMorph()
+{
+    if (!isMorphRunning)
+        return;
+
+    const juce::SpinLock::ScopedTryLockType lock(morphLock);
+    if (!lock.isLocked())
+        return;
+
+    // bytes the link carries during this block, minus what is still on the wire and what is still queued
+    double blockDuration = blockTiming.numSamples / blockTiming.sampleRate;
+    double bytesQueued = outputScheduler.getStatistics().bytesInFlight + realtimeLane.getNumPendingBytes() + transitionPlanner.getNumPendingBytes();
+    int byteBudget = juce::jmax(0, (int)(outputScheduler.getBytesPerSecond() * blockDuration - bytesQueued));
+
+    for (auto& step : morphEngine.process(blockTiming.blockTime - morphStartTime, byteBudget))
+    {
+        const SY1000Parameter::Data& data = SY1000Param.getParameterData(step.parameterIndex);
+        updatePluginParameter(data.parameterID, step.value, data.parameterName);
+    }
+    isMorphRunning = morphEngine.isRunning();
+}
+
+int SY1000AudioProcessor::addModulator(const SY1000ModulationEngine::Modulator& modulator)
+{
+    const juce::SpinLock::ScopedLockType lock(modulationLock);
+    int modulatorId = modulationEngine.addModulator(modulator);
+    hasModulators = !modulationEngine.isEmpty();
+    return modulatorId;
+}
+
+void SY1000AudioProcessor::removeModulator(int modulatorId)
+{
+    const juce::SpinLock::ScopedLockType lock(modulationLock);
+    modulationEngine.removeModulator(modulatorId);
+    hasModulators = !modulationEngine.isEmpty();
+}
+
+void SY1000AudioProcessor::clearModulators()
+{
+    const juce::SpinLock::ScopedLockType lock(modulationLock);
+    modulationEngine.clear();
+    hasModulators = false;
+}
+
+// Called by processBlock with the host MIDI input of the block, writes the due modulator values
+void SY1000AudioProcessor::processModulation(const juce::MidiBuffer& midiMessages)
+{
+    if (!hasModulators)
+        return;
+
+    const juce::SpinLock::ScopedTryLockType lock(modulationLock);
+    if (!lock.isLocked())
+        return;
+
+    for (const auto metadata : midiMessages)
+    {
+        auto message = metadata.getMessage();
+        if (!message.isSysEx())
+            modulationEngine.handleMidiMessage(message);
+    }
+
+    SY1000ModulationEngine::Transport transport;
+    transport.timeMs = blockTiming.blockTime;
+    transport.blockDurationMs = 1000.0 * blockTiming.numSamples / blockTiming.sampleRate;
+    if (playHead != nullptr)
+    {
+        transport.bpm = currentPositionInfo.bpm > 0.0 ? currentPositionInfo.bpm : 120.0;
+        transport.ppqPosition = currentPositionInfo.ppqPosition;
+        transport.isPlaying = currentPositionInfo.isPlaying;
+    }
+
+    for (auto& step : modulationEngine.process(transport))
+    {
+        const SY1000Parameter::Data& data = SY1000Param.getParameterData(step.parameterIndex);
+        updatePluginParameter(data.parameterID, step.value, data.parameterName);
+    }
+}
+
+void SY1000AudioProcessor::setMacroTargets(int macroIndex, const std::vector<SY1000MacroMap::Target>& targets)
+{
+    std::vector<SY1000MacroMap::Target> validTargets;
+    for (auto& target : targets)
+    {
+        // DUALBPM follows its DUALTIME parameter, REGISTER follows its REGISTERBIT parameters
+        if (juce::isPositiveAndBelow(target.parameterIndex, (int)SY1000Param.size())
+            && SY1000Param.getParameterData(target.parameterIndex).parameterType != SY1000Parameter::DUALBPM
+            && SY1000Param.getParameterData(target.parameterIndex).parameterType != SY1000Parameter::REGISTER)
+            validTargets.push_back(target);
+    }
+
+    SY1000MacroMap newMacroMap(SY1000Param);
+    {
+        const juce::SpinLock::ScopedLockType lock(macroLock);
+        newMacroMap.copyFrom(macroMap);
+    }
+    newMacroMap.setTargets(macroIndex, validTargets);
+    juce::ValueTree macros = setMacroMap(newMacroMap);
+    apvts.state.removeChild(apvts.state.getChildWithName("MACROS"), nullptr);
+    apvts.state.appendChild(macros, nullptr);
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] macro " + juce::String(macroIndex + 1) + " -> targets = " + juce::String((int)validTargets.size()));
+}
+
+std::vector<SY1000MacroMap::Target> SY1000AudioProcessor::getMacroTargets(int macroIndex)
+{
+    const juce::SpinLock::ScopedLockType lock(macroLock);
+    return macroMap.getTargets(macroIndex);
+}
+
+// The storage of macroChanged is reserved for the new mapping before it is published, both inside
+// macroWriteLock: a macro change never runs with a mapping larger than its storage.
+juce::ValueTree SY1000AudioProcessor::setMacroMap(const SY1000MacroMap& newMacroMap)
+{
+    const juce::ScopedLock writeLock(macroWriteLock);
+    int numTargets = newMacroMap.getNumTargets();
+    macroSteps.reserve((size_t)numTargets);
+    macroWritePlan.reserve(numTargets);
+    macroPackets.reserve((size_t)numTargets);
+
+    const juce::SpinLock::ScopedLockType lock(macroLock);
+    macroMap.copyFrom(newMacroMap);
+    return macroMap.toValueTree();
+}
+
+// All targets of the macro in one pass. The changed values go to the device as packed DT1s built straight
+// from the steps, without snapshots or a diff of the whole patch.
+void SY1000AudioProcessor::macroChanged(int macroIndex, float newValue)
+{
+    const juce::ScopedLock writeLock(macroWriteLock);
+    {
+        const juce::SpinLock::ScopedLockType lock(macroLock);
+        macroMap.evaluate(macroIndex, newValue, macroSteps);
+    }
+    if (macroSteps.empty())
+        return;
+
+    // Inside a running patch transfer (state restore) the changes are part of its diff
+    bool isPacked = getPatchTransfer() == nullptr;
+    size_t numChanged = 0;
+    for (auto& step : macroSteps)
+    {
+        const SY1000Parameter::Data& data = SY1000Param.getParameterData(step.parameterIndex);
+        int maxValue = data.choices.size() > 0 ? data.choices.size() - 1 : data.maxValue;
+        int minValue = data.choices.size() > 0 ? 0 : data.minValue;
+        int value = juce::jlimit(minValue, maxValue, step.value);
+        if (value == parameterValues.get(step.parameterIndex))
+            continue;
+
+        if (isPacked && addressIndex.isWritable(step.parameterIndex))
+        {
+            // the packet carries the value, other writes (e.g. of an activated engine) are sent as usual
+            const SY1000AddressIndex::Entry& layout = addressIndex.getLayout(step.parameterIndex);
+            ScopedSuppressedRange suppressedRange(*this, layout.linearAddress, layout.linearAddress + (juce::uint32)layout.dataBytes);
+            updatePluginParameter(data.parameterID, value, data.parameterName);
+        }
+        else
+        {
+            updatePluginParameter(data.parameterID, value, data.parameterName);
+        }
+        macroSteps[numChanged++] = { step.parameterIndex, value };
+    }
+    if (!isPacked || numChanged == 0)
+        return;
+
+    // After all steps, a type selector among them decides which engine parameters are relevant.
+    // Parameters of an inactive engine were deferred by parameterChanged.
+    macroWritePlan.clear();
+    for (size_t i = 0; i < numChanged; i++)
+    {
+        if (engineRelevance.isRelevant(macroSteps[i].parameterIndex))
+            macroWritePlan.add(macroSteps[i].parameterIndex, parameterValues.get(macroSteps[i].parameterIndex));
+    }
+    if (macroWritePlan.isEmpty())
+        return;
+    macroWritePlan.build(macroPackets, getMaxPacketDataBytes());
+    queuePackets(macroPackets);
+}
+
+void SY1000AudioProcessor::queueWritePlan(const SY1000WritePlan& writePlan)
+{
+    if (isDormant)
+        return;
+
+    queuePackets(writePlan.build(getMaxPacketDataBytes()));
+}
+
+// Packed DT1s are split so one leaves the wire within an audio block: at 3125 bytes/s (DIN) a full 128 byte
+// packet takes 45 ms, a real-time write (pedal press) could not go out in the next block. The widest
+// parameter (8 bytes) is the lower limit.
+int SY1000AudioProcessor::getMaxPacketDataBytes() const
+{
+    return juce::jlimit(8, SY1000WritePlan::maxDataBytes, outputScheduler.getMaxMessageBytes() - SY1000WritePlan::overheadBytes);
+}
+
+void SY1000AudioProcessor::queuePackets(const std::vector<SY1000WritePlan::Packet>& packets)
+{
+    if (isDormant)
+        return;
+
+    {
+        const juce::ScopedLock lock(midiOutLock);
+        for (auto& packet : packets)
+            transitionPlanner.addPacket(packet.hexAddress, packet.message, packet.beginAddress, packet.endAddress, currentChangeTime);
+    }
+
+    // logged outside the lock, the audio thread waits for it in sendSysEx
+    for (auto& packet : packets)
+    {
+        if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx OUT : " + packet.message.getDescription() + " Hex = " + packet.hexAddress + " Parameters = " + juce::String(packet.numParameters));
+    }
+}
+
+// Searches and sets the associated plugin parameter value based on the received SysEx message data
+void SY1000AudioProcessor::updatePluginParameter(juce::String hexAddress, int dataBytes, int newValue)
+{
+    juce::uint32 address = 0;
+    if (!SY1000AddressIndex::parseHexAddress(hexAddress, address))
+        return;
+
+    auto range = addressIndex.findAll(SY1000AddressIndex::toLinear(address));
+    for (auto* entry = range.first; entry != range.second; ++entry)
+    {
+        if (entry->dataBytes == dataBytes && entry->parameterType != SY1000Parameter::DUALBPM)
+        {
+            updatePluginParameter(*entry, newValue);
+            break;
+        }
+    }
+}
+
+void SY1000AudioProcessor::updatePluginParameter(const SY1000AddressIndex::Entry& entry, int newValue)
+{
+    const SY1000Parameter::Data& data = SY1000Param.getParameterData(entry.parameterIndex);
+    if (entry.parameterType == SY1000Parameter::SINGLE || entry.parameterType == SY1000Parameter::DUALTIME)
+    {
+        if (isDebugMode) juce::Logger::writeToLog("[SY1000] SysEx IN  : Hex = " + data.hexAddress + " DataBytes = " + juce::String(data.dataBytes) + " Value = " + juce::String(newValue));
+        // choice parameters are sent as index + minValue
+        updatePluginParameter(data.parameterID, newValue - entry.valueOffset, data.parameterName);
+    }
+    if (entry.parameterType == SY1000Parameter::REGISTER)
+    {
+        if (data.hexAddress == "10000312")
+        {
+            registerA = newValue;
+        }
+        if (data.hexAddress == "1000031A")
+        {
+            registerB = newValue;
+        }
+        updatePluginRegisterbitParameter(data.hexAddress);
+    }
 }
 
 
 // Searches and sets the associated plugin parameter value based on the parameterID
 void SY1000AudioProcessor::updatePluginParameter(juce::String parameterID, int newValue, juce::String parameterName)
 {
-    juce::RangedAudioParameter* rangedAudioParameter = apvts.getParameter(parameterID);
-    if (rangedAudioParameter != nullptr)
+    int parameterIndex = parameterID.getIntValue();
+    if (parameterValues.isValidIndex(parameterIndex))
     {
+        newValue = juce::jlimit(hostSlots.getMinValue(parameterIndex), hostSlots.getMaxValue(parameterIndex), newValue);
         // Update only if current Value is different from newValue
-        if (newValue != rangedAudioParameter->convertFrom0to1(rangedAudioParameter->getValue()))
+        if (parameterValues.set(parameterIndex, newValue))
         {
             if (isDebugMode) juce::Logger::writeToLog("[SY1000] update parameter -> Value = " + juce::String(newValue) + " : ParameterName = " + parameterName);
-            
-            rangedAudioParameter->beginChangeGesture();
-            rangedAudioParameter->setValueNotifyingHost(rangedAudioParameter->convertTo0to1((float)newValue));
-            rangedAudioParameter->endChangeGesture();
-           
+
+            if (auto* rangedAudioParameter = getHostParameter(parameterIndex))
+            {
+                rangedAudioParameter->beginChangeGesture();
+                rangedAudioParameter->setValueNotifyingHost(toHostValue(parameterIndex, newValue));
+                rangedAudioParameter->endChangeGesture();
+            }
+            else
+            {
+                // internal only parameter, no host callback
+                parameterChanged(parameterIndex, newValue);
+            }
+            dirtyParameters.set(parameterIndex);
         }
-        
     }
 }
 
@@ -476,25 +1137,75 @@ void SY1000AudioProcessor::updatePluginRegisterbitParameter(juce::String hexAddr
 
 void SY1000AudioProcessor::updatePresetParameter(juce::String parameterID, int newValue)
 {
-    juce::RangedAudioParameter* rangedAudioParameter = apvts.getParameter(parameterID);
-    if (rangedAudioParameter != nullptr)
+    int parameterIndex = parameterID.getIntValue();
+    if (parameterValues.isValidIndex(parameterIndex))
     {
+        newValue = juce::jlimit(hostSlots.getMinValue(parameterIndex), hostSlots.getMaxValue(parameterIndex), newValue);
         // Update only if current Value is different from newValue
-        if (newValue != rangedAudioParameter->convertFrom0to1(rangedAudioParameter->getValue()))
+        if (parameterValues.set(parameterIndex, newValue))
         {
             if (isDebugMode) juce::Logger::writeToLog("[SY1000] update preset parameter -> Value = " + juce::String(newValue) + " : ID = " + parameterID);
-            rangedAudioParameter->setValue(rangedAudioParameter->convertTo0to1((float)newValue));
+            if (auto* rangedAudioParameter = getHostParameter(parameterIndex))
+                rangedAudioParameter->setValue(toHostValue(parameterIndex, newValue));
+            dirtyParameters.set(parameterIndex);
         }
 
     }
 }
 
+juce::RangedAudioParameter* SY1000AudioProcessor::getHostParameter(int parameterIndex)
+{
+    int hostIndex = hostSlots.isSlotMode() ? hostSlots.getSlot(parameterIndex) : parameterIndex;
+    if (hostIndex < 0 || hostIndex >= hostSlots.getNumDeviceHostParameters())
+        return nullptr;
+    return dynamic_cast<juce::RangedAudioParameter*>(getParameters()[hostIndex]);
+}
+
+// Normalised host value of the table value
+float SY1000AudioProcessor::toHostValue(int parameterIndex, int value)
+{
+    if (hostSlots.isSlotMode())
+        return hostSlots.toNormalised(parameterIndex, value);
+    auto* rangedAudioParameter = getHostParameter(parameterIndex);
+    return rangedAudioParameter != nullptr ? rangedAudioParameter->convertTo0to1((float)value) : 0.0f;
+}
+
+void SY1000AudioProcessor::setSlotParameter(int slot, int parameterIndex)
+{
+    if (!hostSlots.isSlotMode())
+        return;
+
+    hostSlots.setSlotParameter(slot, parameterIndex);
+    apvts.state.removeChild(apvts.state.getChildWithName("SLOTS"), nullptr);
+    apvts.state.appendChild(hostSlots.toValueTree(), nullptr);
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] slot " + juce::String(slot + 1) + " -> parameter = " + juce::String(parameterIndex));
+
+    // The slot takes the current value of the parameter, the device has it already
+    if (auto* rangedAudioParameter = getHostParameter(parameterIndex))
+    {
+        ScopedPatchTransfer patchTransfer(*this);
+        rangedAudioParameter->setValueNotifyingHost(toHostValue(parameterIndex, parameterValues.get(parameterIndex)));
+    }
+    updateHostDisplay();
+}
+
+void SY1000AudioProcessor::setParameterExposure(SY1000HostSlots::Mode mode)
+{
+    if (isDebugMode) juce::Logger::writeToLog("[SY1000] exposed parameters -> " + juce::String(mode == SY1000HostSlots::SLOTS ? "slots" : "all") + " (next plugin load)");
+    SY1000HostSlots::saveMode(mode);
+}
+
 
 juce::AudioProcessorValueTreeState::ParameterLayout SY1000AudioProcessor::createParameterLayout()
 {
     std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameterLayout;
  
-    for (int i = 0; i < SY1000Param.size(); i++)
+    for (int slot = 0; hostSlots.isSlotMode() && slot < SY1000HostSlots::numSlots; slot++)
+    {
+        parameterLayout.push_back(std::make_unique<SY1000SlotParameter>(SY1000Param, hostSlots, slot));
+    }
+
+    for (int i = 0; !hostSlots.isSlotMode() && i < SY1000Param.size(); i++)
     {
         if (SY1000Param.getParameterData(juce::String(i), parameterData))
         {
@@ -508,72 +1219,141 @@ juce::AudioProcessorValueTreeState::ParameterLayout SY1000AudioProcessor::create
             }
         }
     }
+
+    // Macro parameters, their indices follow the SY1000Param indices (slot indices in slot mode)
+    for (int m = 0; m < SY1000MacroMap::numMacros; m++)
+    {
+        parameterLayout.push_back(std::make_unique<juce::AudioParameterFloat>(SY1000MacroMap::getParameterID(m), "MACRO/" + juce::String(m + 1), 0.0f, 1.0f, 0.0f));
+    }
     return { parameterLayout.begin(), parameterLayout.end() };
 }
 
-void SY1000AudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
+std::vector<int> SY1000AudioProcessor::findParameters(const juce::String& query) const
+{
+    return parameterSearchIndex.find(query);
+}
+
+int SY1000AudioProcessor::getParameterIndex(const juce::String& parameterName) const
+{
+    return parameterSearchIndex.getParameterIndex(parameterName);
+}
+
+void SY1000AudioProcessor::parameterValueChanged(int parameterIndex, float newValue)
+{
+    int numDeviceHostParameters = hostSlots.getNumDeviceHostParameters();
+    if (parameterIndex >= numDeviceHostParameters)
+    {
+        macroChanged(parameterIndex - numDeviceHostParameters, newValue);
+        return;
+    }
+
+    if (hostSlots.isSlotMode())
+    {
+        // parameterIndex is the slot
+        int slotParameterIndex = hostSlots.getSlotParameter(parameterIndex);
+        if (slotParameterIndex >= 0)
+            parameterChanged(slotParameterIndex, hostSlots.fromNormalised(slotParameterIndex, newValue));
+        return;
+    }
+
+    // newValue is normalised, the table works with the integer values
+    if (auto* rangedAudioParameter = dynamic_cast<juce::RangedAudioParameter*>(getParameters()[parameterIndex]))
+    {
+        parameterChanged(parameterIndex, juce::roundToInt(rangedAudioParameter->convertFrom0to1(newValue)));
+    }
+}
+
+void SY1000AudioProcessor::parameterGestureChanged(int, bool)
+{
+}
+
+void SY1000AudioProcessor::parameterChanged(int parameterIndex, int newValue)
 {
-    if (SY1000Param.getParameterData(parameterID, parameterData))
+    if (juce::isPositiveAndBelow(parameterIndex, (int)SY1000Param.size()))
     {
-        if (isDebugMode) juce::Logger::writeToLog("[SY1000] parameter changed -> Value = " + juce::String(newValue) + " : ParameterName = " + parameterData.parameterName);
-        if (parameterData.parameterType == SY1000Parameter::ParameterType::SINGLE)
+        const SY1000Parameter::Data& data = SY1000Param.getParameterData(parameterIndex);
+        if (isDebugMode) juce::Logger::writeToLog("[SY1000] parameter changed -> Value = " + juce::String(newValue) + " : ParameterName = " + data.parameterName);
+        parameterValues.set(parameterIndex, newValue);
+        dirtyParameters.set(parameterIndex);
+        if (auto* patchTransfer = getPatchTransfer())
+            patchTransfer->changedIndices[(size_t)parameterIndex] = true;
+
+        // A local change (editor, host automation) wakes a dormant instance up and is sent. During a host
+        // bypass or a state restore it stays dormant, the resynchronisation after the wake up sends the value.
+        if (isDormant && !isBypassed && getPatchTransfer() == nullptr)
+            setDormant(false);
+
+        // Parameters of an inactive INST/FX engine are not sent, the type selector sends them on activation
+        bool isRelevant = engineRelevance.isRelevant(parameterIndex);
+        if (!isRelevant && (data.parameterType == SY1000Parameter::ParameterType::SINGLE || data.parameterType == SY1000Parameter::ParameterType::DUALTIME))
         {
-            if (parameterData.choices.size() == 0)
+            // another thread may have activated the engine meanwhile, then the value is sent now
+            isRelevant = !engineRelevance.defer(parameterIndex);
+            if (isDebugMode && !isRelevant) juce::Logger::writeToLog("[SY1000] SysEx OUT : ->  deferred (inactive engine)");
+        }
+
+        // The device has this value now: sent, part of a patch transfer or received from the device
+        if (isRelevant && !isDormant && (data.parameterType == SY1000Parameter::ParameterType::SINGLE || data.parameterType == SY1000Parameter::ParameterType::DUALTIME))
+            sharedDevice->deviceValues.set(parameterIndex, newValue);
+
+        if (data.parameterType == SY1000Parameter::ParameterType::SINGLE && isRelevant)
+        {
+            if (data.choices.size() == 0)
             {
                 // normal parameter
-                sendSysEx(parameterData.hexAddress, parameterData.dataBytes, (int)newValue);
+                sendSysEx(data.hexAddress, data.dataBytes, newValue);
             }
             else
             {
                 // choices parameter
-                sendSysEx(parameterData.hexAddress, parameterData.dataBytes, (int)newValue + parameterData.minValue);
+                sendSysEx(data.hexAddress, data.dataBytes, newValue + data.minValue);
             }
 
         }
         
-        if (parameterData.parameterType == SY1000Parameter::ParameterType::DUALTIME)
+        if (data.parameterType == SY1000Parameter::ParameterType::DUALTIME)
         {
             // DUALTIME is the normal Time parameter. 
-            sendSysEx(parameterData.hexAddress, parameterData.dataBytes, (int)newValue);
+            if (isRelevant) sendSysEx(data.hexAddress, data.dataBytes, newValue);
             // Update the corresponding virtual BPM parameter
 
-            if (SY1000Param.getParameterData(parameterData.hexAddress, parameterData.dataBytes, SY1000Parameter::ParameterType::DUALBPM, parameterData_BPM))
+            if (SY1000Param.getParameterData(data.hexAddress, data.dataBytes, SY1000Parameter::ParameterType::DUALBPM, parameterData_BPM))
             {
                 int BPMValue = 0;
                 // Update BPM only for newValues >= maxtimeValue
                 if (newValue >= parameterData_BPM.maxtimeValue)
                 {
-                    BPMValue = (int)newValue - parameterData_BPM.maxtimeValue;
+                    BPMValue = newValue - parameterData_BPM.maxtimeValue;
                 }
                 updatePluginParameter(parameterData_BPM.parameterID, BPMValue);
             }
         }
 
-        if (parameterData.parameterType == SY1000Parameter::ParameterType::DUALBPM)
+        if (data.parameterType == SY1000Parameter::ParameterType::DUALBPM)
         {
             // DUALBPM is the virtual BPM parameter that controls only the upper part of the corresponding Time parameter
-            //sendSysEx(parameterData.hexAddress, parameterData.dataBytes, newValue + parameterData.maxtimeValue);
+            //sendSysEx(data.hexAddress, data.dataBytes, newValue + data.maxtimeValue);
             // Update the corresponding Time parameter if BPM newValue > 0 (TIME)
             SY1000Parameter::Data parameterData_Time;
-            if (SY1000Param.getParameterData(parameterData.hexAddress, parameterData.dataBytes, SY1000Parameter::ParameterType::DUALTIME, parameterData_Time) && newValue > 0)
+            if (SY1000Param.getParameterData(data.hexAddress, data.dataBytes, SY1000Parameter::ParameterType::DUALTIME, parameterData_Time) && newValue > 0)
             {
-                updatePluginParameter(parameterData_Time.parameterID, (int)newValue + parameterData.maxtimeValue);
+                updatePluginParameter(parameterData_Time.parameterID, newValue + data.maxtimeValue);
             }
         }
 
-        if (parameterData.parameterType == SY1000Parameter::ParameterType::REGISTER)
+        if (data.parameterType == SY1000Parameter::ParameterType::REGISTER)
         {
             // The REGISTER Parameter is not activly used as a VST Value. 
         }
 
-        if (parameterData.parameterType == SY1000Parameter::ParameterType::REGISTERBIT)
+        if (data.parameterType == SY1000Parameter::ParameterType::REGISTERBIT)
         {
             // REGISTERBIT is used for Pedal On/Off state. (See. SY-1000_MIDI_Implementation.pdf Page 76 Table 3+4)
             // Register A HexAddress = 10000312_XX -> XX = BIT Number (Table 3) 00-31
             // Register B HexAddress = 1000030B_YY -> YY = BIT Number (Table 4) 00-07
-            juce::String hexAddress = parameterData.hexAddress.substring(0, 8);
-            juce::String test = parameterData.hexAddress.substring(9);
-            int bitPosition = parameterData.hexAddress.substring(9).getIntValue();
+            juce::String hexAddress = data.hexAddress.substring(0, 8);
+            juce::String test = data.hexAddress.substring(9);
+            int bitPosition = data.hexAddress.substring(9).getIntValue();
             int mask = 1 << bitPosition;
             //int registerValue = 0;
             int registerValue = 0;
@@ -612,6 +1392,19 @@ void SY1000AudioProcessor::parameterChanged(const juce::String& parameterID, flo
             }
             
         }
+
+        if (engineRelevance.isSelector(parameterIndex))
+        {
+            // INST TYPE / FX TYPE changed -> send the deferred parameters of the activated engine
+            ScopedBulkTransfer bulkTransfer(*this);
+            for (int activatedIndex : engineRelevance.setSelectorValue(parameterIndex, newValue))
+            {
+                // inside a patch transfer the single writes are suppressed, it sends them with its plan
+                if (auto* patchTransfer = getPatchTransfer())
+                    patchTransfer->activatedIndices.push_back(activatedIndex);
+                parameterChanged(activatedIndex, parameterValues.get(activatedIndex));
+            }
+        }
     }
 }
 
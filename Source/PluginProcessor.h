@@ -10,12 +10,31 @@
 
 #include <JuceHeader.h>
 #include "Parameter.h"
+#include "TransitionPlanner.h"
+#include "EngineRelevance.h"
+#include "OutputScheduler.h"
+#include "ParameterSearchIndex.h"
+#include "DirtyBits.h"
+#include "ValueStore.h"
+#include "SysExCodec.h"
+#include "SysExDecoder.h"
+#include "AddressIndex.h"
+#include "WritePlan.h"
+#include "PatchDiff.h"
+#include "MorphEngine.h"
+#include "ModulationEngine.h"
+#include "MacroMap.h"
+#include "HostSlots.h"
+#include "SharedDevice.h"
+#include "TempoEngine.h"
+#include "LinkMeter.h"
 
 //==============================================================================
 /**
 */
 class SY1000AudioProcessor  : public juce::AudioProcessor,
-                              public juce::AudioProcessorValueTreeState::Listener
+                              public juce::AudioProcessorParameter::Listener,
+                              private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -31,6 +50,7 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -58,24 +78,68 @@ public:
 
     
     void sendSysEx(juce::String hexAddress, int dataBytes, int value, bool forceSending = false);
+    void applyIncomingDT1(const SY1000SysExDecoder::DT1& dt1);
     void updatePluginParameter(juce::String hexAddress, int dataBytes, int newValue);
+    void updatePluginParameter(const SY1000AddressIndex::Entry& entry, int newValue);
     void updatePluginParameter(juce::String parameterID, int newValue, juce::String parameterName = "");
 
     void updatePluginRegisterbitParameter(juce::String hexAddress);
 
     void updatePresetParameter(juce::String parameterID, int newValue);
 
+    // Block operations on the repeated INST1/2/3 and FX1/2/3 blocks, e.g. copyBlock("FX1", "FX2").
+    // The device gets one packed DT1 per contiguous address range, false if the blocks don't match.
+    bool copyBlock(const juce::String& sourceName, const juce::String& destinationName);
+    bool swapBlocks(const juce::String& nameA, const juce::String& nameB);
+
+    // Device level setting shared by all instances, see SY1000SharedDevice::setLinkProfile
+    void setMidiLinkProfile(SY1000OutputScheduler::LinkProfile profile, double customBytesPerSecond = 0.0);
+    // Measures the SysEx rate of the USB link with the next blocks (done automatically for an unmeasured USB link)
+    void measureMidiLink();
+    SY1000OutputScheduler::Statistics getMidiOutStatistics() const;
+    SY1000SysExDecoder::Statistics getSysExInStatistics() const;
+
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    void parameterChanged(const juce::String& parameterID, float newValue);
+    // Parameter lookup by (parts of) the hierarchical name, e.g. for mapping widgets by name
+    std::vector<int> findParameters(const juce::String& query) const;
+    // -1 for a name shared by several parameters, they are found by their unique names (SY1000ParameterSearchIndex)
+    int getParameterIndex(const juce::String& parameterName) const;
+
+    // Host parameter of a table parameter, nullptr if the parameter is not exposed to the host (slot mode)
+    juce::RangedAudioParameter* getHostParameter(int parameterIndex);
+    float toHostValue(int parameterIndex, int value);
+    // Slot mode: maps the slot to the table parameter (-1 clears it). The mode applies to the next plugin load.
+    void setSlotParameter(int slot, int parameterIndex);
+    void setParameterExposure(SY1000HostSlots::Mode mode);
+
+    // juce::AudioProcessorParameter::Listener, dispatched by parameter index without any String lookup
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
+    void parameterChanged(int parameterIndex, int newValue);
 
 
     
+    // Process wide device engine, all instances share its tables and its outgoing SysEx queue
+    juce::SharedResourcePointer<SY1000SharedDevice> sharedDevice;
+    bool isPrepared = false;
+
     // SY1000 Parameter
-    SY1000Parameter SY1000Param;
+    SY1000Parameter& SY1000Param { sharedDevice->parameter };
     SY1000Parameter::Data parameterData;
     SY1000Parameter::Data parameterData_BPM;
-    SY1000Parameter::ParameterAttributes parameterAttributes;
+    SY1000EngineRelevance engineRelevance { SY1000Param };
+    SY1000ParameterSearchIndex& parameterSearchIndex { sharedDevice->parameterSearchIndex };
+    SY1000AddressIndex& addressIndex { sharedDevice->addressIndex };
+
+    // Integer values of all parameters, the source of truth for the SysEx and the host path
+    SY1000ValueStore parameterValues { SY1000Param };
+
+    // Parameters whose value changed since the editor refreshed the last time
+    SY1000DirtyBits dirtyParameters { SY1000Param.size() };
+
+    // Host parameters: every table parameter or a pool of remappable slots (global setting)
+    SY1000HostSlots hostSlots { SY1000Param, SY1000HostSlots::loadMode() };
 
     // AudioProcessorValueTreeState definitions
     juce::AudioProcessorValueTreeState apvts;
@@ -83,19 +147,145 @@ public:
     // Host program BPM detection 
     juce::AudioPlayHead* playHead;
     juce::AudioPlayHead::CurrentPositionInfo currentPositionInfo;
-    double myBPM = -1.0;
+    std::atomic<double> myBPM = -1.0;     // read by startMorphBeats on other threads
+
+    // Host tempo to the master BPM with hysteresis and rate limit
+    void setTempoSyncSettings(const SY1000TempoEngine::Settings& settings);
+    SY1000TempoEngine tempoEngine;
+    juce::SpinLock tempoLock;
 
 
     juce::MidiMessage midiOutMessage;
-    juce::String sysExInMessage = "";
-    std::atomic<bool> isNewMidiOutMessage = false;
+
+    // Validates the incoming SysEx and counts the rejected frames
+    SY1000SysExDecoder sysExDecoder;
+    // Linear address range whose single writes are not sent, because the device gets these values by a
+    // packed DT1 or already has them (incoming DT1 being applied, block copy, patch transfer).
+    // The range belongs to the thread that makes these changes, the writes of other threads are sent.
+    bool isSuppressedAddress(const juce::String& hexAddress) const;
+
+    // Suppresses the single writes of this processor in the range for the calling thread while it exists
+    struct ScopedSuppressedRange
+    {
+        ScopedSuppressedRange(const SY1000AudioProcessor& processor, juce::uint32 beginAddress, juce::uint32 endAddress);
+        ~ScopedSuppressedRange();
+        const SY1000AudioProcessor* previousProcessor;
+        juce::uint32 previousBeginAddress;
+        juce::uint32 previousEndAddress;
+    };
+
+    // Sets the values of a block in the host and sends them as packed DT1s
+    void writeBlock(const SY1000Parameter::Block& block, const std::vector<int>& values);
+    void queueWritePlan(const SY1000WritePlan& writePlan);
+    void queuePackets(const std::vector<SY1000WritePlan::Packet>& packets);
+    int getMaxPacketDataBytes() const;
+
+    // Outgoing SysEx writes, released in audible-first order by processBlock.
+    // Single audible changes (pedal states, levels, BPM) use the real-time lane, everything else and all
+    // writes inside a ScopedBulkTransfer (state restores, engine activation) use the bulk lane.
+    SY1000TransitionPlanner& realtimeLane { sharedDevice->realtimeLane };
+    SY1000TransitionPlanner& transitionPlanner { sharedDevice->transitionPlanner };
+    juce::CriticalSection& midiOutLock { sharedDevice->midiOutLock };
+    std::atomic<int> bulkTransferDepth = 0;
+
+    struct ScopedBulkTransfer
+    {
+        ScopedBulkTransfer(SY1000AudioProcessor& p) : processor(p) { processor.bulkTransferDepth++; }
+        ~ScopedBulkTransfer() { processor.bulkTransferDepth--; }
+        SY1000AudioProcessor& processor;
+    };
+
+    // Collects the changes of many parameters (state restore, variation switch). Their single writes are
+    // suppressed, at the end only the difference to the values before is sent as packed DT1s.
+    // A transfer belongs to the thread that created it: changes of other threads (e.g. an incoming DT1 on
+    // the audio thread) are neither suppressed nor part of its diff.
+    struct ScopedPatchTransfer
+    {
+        ScopedPatchTransfer(SY1000AudioProcessor& p);
+        ~ScopedPatchTransfer();
+        SY1000AudioProcessor& processor;
+        ScopedBulkTransfer bulkTransfer;
+        std::vector<int> valuesBefore;
+        int registerABefore;
+        int registerBBefore;
+        ScopedSuppressedRange suppressedRange;
+        ScopedPatchTransfer* previousPatchTransfer;
+        std::vector<bool> changedIndices;    // parameters changed by this thread during the transfer
+        std::vector<int> activatedIndices;   // deferred parameters of engines activated during the transfer
+    };
+    // Patch transfer of this processor running on the calling thread, nullptr if there is none
+    ScopedPatchTransfer* getPatchTransfer() const;
+
+    // Sets all parameters to values (indexed like SY1000Param), the device gets only the changes
+    void applyPatch(const std::vector<int>& values);
+
+    // Morphs from the current values to target (indexed like SY1000Param), paced by processBlock to the
+    // bandwidth of the MIDI link. Discrete parameters switch at switchPoint (0..1) of the morph.
+    void startMorph(const std::vector<int>& target, double durationMs, double switchPoint = 0.5);
+    void startMorphBeats(const std::vector<int>& target, double beats, double switchPoint = 0.5);
+    void stopMorph();
+    bool isMorphing() const;
+    void processMorph();
+
+    // Plugin side modulators (LFO, envelope follower, step sequencer), evaluated once per block
+    int addModulator(const SY1000ModulationEngine::Modulator& modulator);
+    void removeModulator(int modulatorId);
+    void clearModulators();
+    void processModulation(const juce::MidiBuffer& midiMessages);
+
+    // Macro host parameters (after the SY1000Param parameters), one macro change sets all its targets and
+    // sends the changed values as packed DT1s. The mapping is stored in the state tree.
+    void setMacroTargets(int macroIndex, const std::vector<SY1000MacroMap::Target>& targets);
+    std::vector<SY1000MacroMap::Target> getMacroTargets(int macroIndex);
+    void macroChanged(int macroIndex, float newValue);
+
+    SY1000MacroMap macroMap { SY1000Param };
+    juce::SpinLock macroLock;
+
+    // Storage of macroChanged, sized to the mapping so a macro change on the audio thread doesn't allocate.
+    // Macro changes of one instance are serialised by macroWriteLock. Returns the state tree of the mapping.
+    juce::ValueTree setMacroMap(const SY1000MacroMap& newMacroMap);
+    std::vector<SY1000MacroMap::Step> macroSteps;
+    SY1000WritePlan macroWritePlan { addressIndex };
+    std::vector<SY1000WritePlan::Packet> macroPackets;
+    juce::CriticalSection macroWriteLock;
+
+    SY1000ModulationEngine modulationEngine { SY1000Param };
+    juce::SpinLock modulationLock;
+    std::atomic<bool> hasModulators = false;
+
+    SY1000MorphEngine morphEngine { SY1000Param, addressIndex };
+    juce::SpinLock morphLock;
+    double morphStartTime = 0.0;
+    std::atomic<bool> isMorphRunning = false;
+
+    // Dormant mode of an inactive instance: no host polling, no decoding of incoming SysEx and no sending.
+    // Entered when the host deactivates or bypasses the instance, or after timeoutMs without MIDI input
+    // (0 = never). The end of a bypass, prepareToPlay or a local parameter change wake it up (MIDI input not),
+    // then the device gets only the values that differ from the values it is known to have.
+    // The resynchronisation and the release of the morph buffers run on the message thread.
+    void setDormant(bool shouldBeDormant);
+    bool isDormantMode() const;
+    void setDormantTimeout(double timeoutMs);
+    void resynchronise();
+    void handleAsyncUpdate() override;
+
+    std::atomic<bool> isDormant = false;
+    std::atomic<bool> isBypassed = false;   // processBlockBypassed was the last block callback
+    std::atomic<bool> needsDormantUpdate = false;
+    std::atomic<double> dormantTimeoutMs = 0.0;
+    double lastActivityTime = 0.0;
+
+    // Paces the outgoing messages to the bandwidth of the MIDI link
+    SY1000OutputScheduler& outputScheduler { sharedDevice->outputScheduler };
+    SY1000OutputScheduler::BlockTiming blockTiming;
+    SY1000LinkMeter linkMeter;
+    std::atomic<bool> needsLinkMeasurement = false;
+    std::atomic<bool> needsLinkSettingsSave = false;
     std::atomic<int> registerA = 0;
     std::atomic<int> registerB = 0;
 
 
-    // SY1000 Slider and SliderAttachment Definition
-#include "ParameterDefinitions.h"
-
 private:
 
     bool isDebugMode = true;
@@ -0,0 +1,156 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+#include "AddressIndex.h"
+#include "ParameterSearchIndex.h"
+#include "ValueStore.h"
+#include "TransitionPlanner.h"
+#include "OutputScheduler.h"
+#include "HostSlots.h"
+
+// Process wide SY1000 engine, shared by all plugin instances through a juce::SharedResourcePointer
+// (created with the first instance, deleted with the last one).
+// It owns the read-only parameter tables, the values the device is known to have and the one outgoing
+// SysEx queue. Every instance queues its writes here and one processing instance, the output owner, drains
+// the queue into its MIDI output, so the device gets one paced stream and a write of the same address by two
+// instances is coalesced.
+class SY1000SharedDevice
+{
+public:
+
+    // An owner without a processed block for this time loses the output to a processing instance
+    static constexpr double ownerTimeoutMs = 500.0;
+
+    SY1000SharedDevice()
+        : addressIndex(parameter), parameterSearchIndex(parameter), deviceValues(parameter),
+          realtimeLane(parameter), transitionPlanner(parameter)
+    {
+        loadLinkSettings();
+    }
+
+    // An instance starts processing. Returns true for the first one, which becomes the output owner,
+    // (re)starts the output queue and activates the SysEx sync of the device.
+    bool prepareInstance(const void* instance)
+    {
+        const juce::ScopedLock instanceLock(mInstanceLock);
+        mPreparedInstances.addIfNotAlreadyThere(instance);
+        if (mPreparedInstances.size() > 1)
+            return false;
+
+        const juce::ScopedLock lock(midiOutLock);
+        realtimeLane.clear();
+        transitionPlanner.clear();
+        outputScheduler.reset();
+        mOutputOwner = instance;
+        mOwnerHeartbeat = juce::Time::getMillisecondCounterHiRes();
+        return true;
+    }
+
+    // Only for a prepared instance. The output goes over to another prepared instance.
+    void releaseInstance(const void* instance)
+    {
+        const juce::ScopedLock instanceLock(mInstanceLock);
+        mPreparedInstances.removeFirstMatchingValue(instance);
+        if (mOutputOwner == instance)
+        {
+            mOutputOwner = mPreparedInstances.isEmpty() ? nullptr : mPreparedInstances.getFirst();
+            mOwnerHeartbeat = juce::Time::getMillisecondCounterHiRes();
+        }
+    }
+
+    // The owner stops draining the queue (dormant instance), the next processing instance takes it over
+    void releaseOutput(const void* instance)
+    {
+        const void* owner = instance;
+        mOutputOwner.compare_exchange_strong(owner, nullptr);
+    }
+
+    // Called by every processing instance once per block, timeMs is the block time. True if the instance
+    // drains the queue. The instance takes the output over if there is no owner or the owner has not
+    // processed a block for ownerTimeoutMs (a host that stops calling an inactive rackspace doesn't tell it).
+    bool claimOutput(const void* instance, double timeMs)
+    {
+        const void* owner = mOutputOwner.load();
+        if (owner != instance && owner != nullptr && timeMs - mOwnerHeartbeat.load() <= ownerTimeoutMs)
+            return false;
+        if (owner != instance && !mOutputOwner.compare_exchange_strong(owner, instance))
+            return false;
+        mOwnerHeartbeat = timeMs;
+        return true;
+    }
+
+    // The MIDI link to the device is a setting of the machine, not of a plugin state: all instances share it
+    // and a rate measured by one instance holds for all of them. Stored in the settings file.
+    void setLinkProfile(SY1000OutputScheduler::LinkProfile profile, double customBytesPerSecond = 0.0)
+    {
+        {
+            const juce::ScopedLock lock(midiOutLock);
+            outputScheduler.setLinkProfile(profile, customBytesPerSecond);
+            mCustomBytesPerSecond = customBytesPerSecond;
+        }
+        saveLinkSettings();
+    }
+
+    double getCustomBytesPerSecond() const
+    {
+        return mCustomBytesPerSecond;
+    }
+
+    // Not on the audio thread, the measured rate is set there by outputScheduler.setMeasuredBytesPerSecond
+    void saveLinkSettings() const
+    {
+        juce::PropertiesFile settings(SY1000HostSlots::getSettingsOptions());
+        settings.setValue("midiLinkProfile", (int)outputScheduler.getLinkProfile());
+        settings.setValue("midiLinkBytesPerSecond", mCustomBytesPerSecond.load());
+        settings.setValue("midiLinkMeasuredBytesPerSecond", outputScheduler.getMeasuredBytesPerSecond());
+        settings.saveIfNeeded();
+    }
+
+    // Echo suppression: the last DT1 received by any instance is not sent back by any instance
+    void setLastReceived(const juce::String& description)
+    {
+        const juce::SpinLock::ScopedLockType lock(mReceivedLock);
+        mLastReceived = description;
+    }
+
+    bool isLastReceived(const juce::String& description) const
+    {
+        const juce::SpinLock::ScopedLockType lock(mReceivedLock);
+        return mLastReceived == description;
+    }
+
+    SY1000Parameter parameter;
+    SY1000AddressIndex addressIndex;
+    SY1000ParameterSearchIndex parameterSearchIndex;
+
+    // Values the device has, last sent by any instance or received from the device (indexed like SY1000Param)
+    SY1000ValueStore deviceValues;
+
+    // Outgoing SysEx writes of all instances, see SY1000AudioProcessor::sendSysEx
+    SY1000TransitionPlanner realtimeLane;
+    SY1000TransitionPlanner transitionPlanner;
+    SY1000OutputScheduler outputScheduler;
+    juce::CriticalSection midiOutLock;
+
+private:
+
+    void loadLinkSettings()
+    {
+        juce::PropertiesFile settings(SY1000HostSlots::getSettingsOptions());
+        mCustomBytesPerSecond = settings.getDoubleValue("midiLinkBytesPerSecond", 0.0);
+        outputScheduler.setMeasuredBytesPerSecond(settings.getDoubleValue("midiLinkMeasuredBytesPerSecond", 0.0));
+        outputScheduler.setLinkProfile((SY1000OutputScheduler::LinkProfile)juce::jlimit(0, (int)SY1000OutputScheduler::CUSTOM, settings.getIntValue("midiLinkProfile", (int)SY1000OutputScheduler::DIN)),
+                                       mCustomBytesPerSecond);
+    }
+
+    std::atomic<double> mCustomBytesPerSecond { 0.0 };
+    juce::CriticalSection mInstanceLock;
+    juce::Array<const void*> mPreparedInstances;
+    std::atomic<const void*> mOutputOwner { nullptr };
+    std::atomic<double> mOwnerHeartbeat { 0.0 };    // block time of the last block of the owner
+
+    mutable juce::SpinLock mReceivedLock;
+    juce::String mLastReceived;
+
+    JUCE_DECLARE_NON_COPYABLE(SY1000SharedDevice)
+};
@@ -0,0 +1,130 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Value encoding of the SY1000 DT1 data bytes.
+// 1 data byte carries a 7 bit value, 2/3/4/8 data bytes carry the value as 4 bit nibbles, most significant
+// nibble first (only the lowest 4 bits of each 7 bit byte are used by the SY1000).
+// The widths are compile-time specialisations of shifts and masks, the run-time width selects them by table.
+class SY1000SysExCodec
+{
+public:
+
+    template <int dataBytes>
+    struct Width
+    {
+        static_assert(dataBytes >= 1 && dataBytes <= 8, "data width out of range");
+
+        static void encode(int value, juce::uint8* data)
+        {
+            if constexpr (dataBytes == 1)
+            {
+                data[0] = (juce::uint8)(value & 0x7F);
+            }
+            else
+            {
+                auto bits = (juce::uint32)value;
+                for (int i = 0; i < dataBytes; i++)
+                    data[i] = (juce::uint8)((bits >> (4 * (dataBytes - 1 - i))) & 0x0F);
+            }
+        }
+
+        static int decode(const juce::uint8* data)
+        {
+            if constexpr (dataBytes == 1)
+            {
+                return data[0] & 0x7F;
+            }
+            else
+            {
+                juce::uint32 bits = 0;
+                for (int i = 0; i < dataBytes; i++)
+                    bits = (bits << 4) | (juce::uint32)(data[i] & 0x0F);
+                return (int)bits;
+            }
+        }
+    };
+
+    static bool isSupportedWidth(int dataBytes)
+    {
+        return juce::isPositiveAndBelow(dataBytes, numWidths) && getTable()[dataBytes].encode != nullptr;
+    }
+
+    // Writes dataBytes bytes to data, returns false for an unsupported width
+    static bool encode(int dataBytes, int value, juce::uint8* data)
+    {
+        if (!isSupportedWidth(dataBytes))
+            return false;
+        getTable()[dataBytes].encode(value, data);
+        return true;
+    }
+
+    // Reads dataBytes bytes from data, returns false for an unsupported width
+    static bool decode(int dataBytes, const juce::uint8* data, int& value)
+    {
+        if (!isSupportedWidth(dataBytes))
+            return false;
+        value = getTable()[dataBytes].decode(data);
+        return true;
+    }
+
+    // Roland checksum of address and data bytes: (sum + checksum) % 128 == 0
+    static juce::uint8 checksum(const juce::uint8* data, int size)
+    {
+        int sum = 0;
+        for (int i = 0; i < size; i++)
+            sum += data[i];
+        return (juce::uint8)((128 - sum % 128) & 0x7F);
+    }
+
+    // DT1 message for data bytes that are already in device format. address holds the 4 address bytes
+    // (e.g. 0x10001500 for "10001500").
+    static juce::MidiMessage createDT1(juce::uint32 address, const juce::uint8* data, int numDataBytes)
+    {
+        std::vector<juce::uint8> sysEx = { 0x41, 0x00, 0x00, 0x00, 0x00, 0x69, 0x12 };
+        for (int i = 0; i < 4; i++)
+            sysEx.push_back((juce::uint8)((address >> (8 * (3 - i))) & 0x7F));
+        sysEx.insert(sysEx.end(), data, data + numDataBytes);
+        sysEx.push_back(checksum(sysEx.data() + 7, 4 + numDataBytes));
+        return juce::MidiMessage::createSysExMessage(sysEx.data(), (int)sysEx.size());
+    }
+
+    // RQ1 message, asks the device for size bytes from address. The size is sent as 4 bytes of 7 bits.
+    static juce::MidiMessage createRQ1(juce::uint32 address, int size)
+    {
+        juce::uint8 sysEx[16] = { 0x41, 0x00, 0x00, 0x00, 0x00, 0x69, 0x11 };
+        for (int i = 0; i < 4; i++)
+        {
+            sysEx[7 + i] = (juce::uint8)((address >> (8 * (3 - i))) & 0x7F);
+            sysEx[11 + i] = (juce::uint8)((size >> (7 * (3 - i))) & 0x7F);
+        }
+        sysEx[15] = checksum(sysEx + 7, 8);
+        return juce::MidiMessage::createSysExMessage(sysEx, 16);
+    }
+
+private:
+
+    static constexpr int numWidths = 9;
+
+    struct Kernel
+    {
+        void (*encode)(int, juce::uint8*);
+        int (*decode)(const juce::uint8*);
+    };
+
+    static const Kernel* getTable()
+    {
+        static const Kernel table[numWidths] =
+        {
+            { nullptr, nullptr },
+            { &Width<1>::encode, &Width<1>::decode },
+            { &Width<2>::encode, &Width<2>::decode },
+            { &Width<3>::encode, &Width<3>::decode },
+            { &Width<4>::encode, &Width<4>::decode },
+            { nullptr, nullptr },
+            { nullptr, nullptr },
+            { nullptr, nullptr },
+            { &Width<8>::encode, &Width<8>::decode }
+        };
+        return table;
+    }
+};
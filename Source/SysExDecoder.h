@@ -0,0 +1,108 @@
+#pragma once
+#include <JuceHeader.h>
+#include "SysExCodec.h"
+
+// Validates incoming SysEx before anything of it reaches a parameter.
+// A frame is only accepted as SY1000 DT1 if header, command, length, 7 bit data and checksum are correct.
+// Bad frames are dropped and counted, so a corrupted or truncated message never writes a garbage value that
+// would be notified to the host and echoed back to the device.
+class SY1000SysExDecoder
+{
+public:
+
+    enum Result { VALID, OTHER_DEVICE, BAD_COMMAND, BAD_LENGTH, BAD_DATA, BAD_CHECKSUM };
+
+    // Address and data bytes of a valid DT1, data points into the message
+    struct DT1
+    {
+        juce::uint32 address = 0;      // 4 address bytes, e.g. 0x10001500
+        const juce::uint8* data = nullptr;
+        int numDataBytes = 0;
+
+        juce::String getHexAddress() const
+        {
+            return juce::String::toHexString((juce::int64)address).paddedLeft('0', 8).toUpperCase();
+        }
+    };
+
+    struct Statistics
+    {
+        juce::int64 accepted = 0;
+        juce::int64 otherDevice = 0;   // not a SY1000 message, not an error
+        juce::int64 badCommand = 0;
+        juce::int64 badLength = 0;
+        juce::int64 badData = 0;
+        juce::int64 badChecksum = 0;
+    };
+
+    // sysExData / size as returned by MidiMessage::getSysExData / getSysExDataSize (without F0 and F7)
+    static Result parse(const juce::uint8* sysExData, int size, DT1& dt1)
+    {
+        static const juce::uint8 header[] = { 0x41, 0x00, 0x00, 0x00, 0x00, 0x69 };
+        if (size < (int)sizeof(header) || memcmp(sysExData, header, sizeof(header)) != 0)
+            return OTHER_DEVICE;
+        if (size < 7 || sysExData[6] != 0x12)
+            return BAD_COMMAND;
+        // header, command, 4 address bytes, at least one data byte, checksum
+        if (size < 13)
+            return BAD_LENGTH;
+        for (int i = 7; i < size; i++)
+        {
+            if (sysExData[i] > 0x7F)
+                return BAD_DATA;
+        }
+        if (SY1000SysExCodec::checksum(sysExData + 7, size - 8) != sysExData[size - 1])
+            return BAD_CHECKSUM;
+
+        dt1.address = ((juce::uint32)sysExData[7] << 24) | ((juce::uint32)sysExData[8] << 16) | ((juce::uint32)sysExData[9] << 8) | (juce::uint32)sysExData[10];
+        dt1.data = sysExData + 11;
+        dt1.numDataBytes = size - 12;
+        return VALID;
+    }
+
+    // Counts the result, called once per incoming SysEx frame
+    void count(Result result)
+    {
+        switch (result)
+        {
+        case VALID:         mAccepted++; break;
+        case OTHER_DEVICE:  mOtherDevice++; break;
+        case BAD_COMMAND:   mBadCommand++; break;
+        case BAD_LENGTH:    mBadLength++; break;
+        case BAD_DATA:      mBadData++; break;
+        case BAD_CHECKSUM:  mBadChecksum++; break;
+        }
+    }
+
+    Statistics getStatistics() const
+    {
+        Statistics statistics;
+        statistics.accepted = mAccepted;
+        statistics.otherDevice = mOtherDevice;
+        statistics.badCommand = mBadCommand;
+        statistics.badLength = mBadLength;
+        statistics.badData = mBadData;
+        statistics.badChecksum = mBadChecksum;
+        return statistics;
+    }
+
+    void resetStatistics()
+    {
+        mAccepted = 0;
+        mOtherDevice = 0;
+        mBadCommand = 0;
+        mBadLength = 0;
+        mBadData = 0;
+        mBadChecksum = 0;
+    }
+
+private:
+
+    // written by the audio thread, read by the UI
+    std::atomic<juce::int64> mAccepted { 0 };
+    std::atomic<juce::int64> mOtherDevice { 0 };
+    std::atomic<juce::int64> mBadCommand { 0 };
+    std::atomic<juce::int64> mBadLength { 0 };
+    std::atomic<juce::int64> mBadData { 0 };
+    std::atomic<juce::int64> mBadChecksum { 0 };
+};
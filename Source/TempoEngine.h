@@ -0,0 +1,82 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Host tempo to the SY1000 master BPM (value = BPM * 10, 40.0 - 250.0 BPM).
+// A new value is sent if the tempo moved by at least the hysteresis and the last send is older than
+// 1 / maxUpdateRate, so a tempo ramp of the host doesn't send one write per block. As soon as the tempo
+// stays unchanged for settleMs, the exact value is sent even inside the hysteresis: the final tempo of a
+// ramp always reaches the device.
+class SY1000TempoEngine
+{
+public:
+
+    struct Settings
+    {
+        double hysteresisBpm = 0.5;
+        double maxUpdateRate = 10.0;    // writes per second
+        double settleMs = 100.0;
+    };
+
+    static constexpr int minValue = 400;
+    static constexpr int maxValue = 2500;
+
+    void setSettings(const Settings& settings)
+    {
+        mSettings = settings;
+        mSettings.hysteresisBpm = juce::jmax(0.0, settings.hysteresisBpm);
+        mSettings.maxUpdateRate = juce::jmax(0.1, settings.maxUpdateRate);
+        mSettings.settleMs = juce::jmax(0.0, settings.settleMs);
+    }
+
+    const Settings& getSettings() const
+    {
+        return mSettings;
+    }
+
+    // Next value is sent unconditionally (e.g. the device was not reachable)
+    void reset()
+    {
+        mLastSentValue = -1;
+    }
+
+    static int toValue(double bpm)
+    {
+        return juce::jlimit(minValue, maxValue, juce::roundToInt(bpm * 10.0));
+    }
+
+    // Host tempo of the current block, returns the value to send or -1
+    int process(double bpm, double timeMs)
+    {
+        if (bpm <= 0.0)
+            return -1;
+
+        if (bpm != mLastBpm)
+        {
+            mLastBpm = bpm;
+            mLastChangeTime = timeMs;
+        }
+
+        int value = toValue(bpm);
+        if (value == mLastSentValue)
+            return -1;
+
+        bool isFirst = mLastSentValue < 0;
+        bool isOutsideHysteresis = std::abs(value - mLastSentValue) >= juce::roundToInt(mSettings.hysteresisBpm * 10.0);
+        bool isSettled = timeMs - mLastChangeTime >= mSettings.settleMs;
+        bool isDue = timeMs - mLastSendTime >= 1000.0 / mSettings.maxUpdateRate;
+        if (!isFirst && !(isDue && (isOutsideHysteresis || isSettled)))
+            return -1;
+
+        mLastSentValue = value;
+        mLastSendTime = timeMs;
+        return value;
+    }
+
+private:
+
+    Settings mSettings;
+    double mLastBpm = -1.0;
+    double mLastChangeTime = 0.0;
+    double mLastSendTime = 0.0;
+    int mLastSentValue = -1;
+};
@@ -0,0 +1,254 @@
+#pragma once
+#include <JuceHeader.h>
+#include <deque>
+#include "Parameter.h"
+
+// Collects the DT1 writes of a patch transition and releases them in tier order.
+// The audible parameters (INST/EFFECTS on/off and levels) reach the SY1000 first,
+// the type selectors second and the fine detail (ALT TUNE, SEQ steps, ...) last.
+class SY1000TransitionPlanner
+{
+public:
+
+    enum Tier { AUDIBLE, TYPE, DETAIL, FINEDETAIL, numTiers };
+
+    SY1000TransitionPlanner(const SY1000Parameter& parameter)
+    {
+        for (int i = 0; i < (int)parameter.size(); i++)
+        {
+            const SY1000Parameter::Data& parameterData = parameter.getParameterData(i);
+            // REGISTERBIT addresses carry a "_XX" bit suffix, the device only sees the register address
+            juce::String hexAddress = parameterData.hexAddress.substring(0, 8);
+            int tier = classify(parameterData);
+            // Several parameters can share one address (DUALTIME/DUALBPM), the most audible one wins
+            if (!mTierByAddress.contains(hexAddress) || tier < mTierByAddress[hexAddress])
+            {
+                mTierByAddress.set(hexAddress, tier);
+            }
+        }
+    }
+
+    static Tier classify(const SY1000Parameter::Data& parameterData)
+    {
+        if (parameterData.parameterType == SY1000Parameter::ParameterType::REGISTER || parameterData.parameterType == SY1000Parameter::ParameterType::REGISTERBIT)
+        {
+            // Pedal On/Off states switch effects audibly
+            return AUDIBLE;
+        }
+
+        const juce::String& name = parameterData.parameterName;
+        juce::String leaf = name.fromLastOccurrenceOf("/", false, false);
+        bool isSoundBlock = name.startsWith("INST") || name.startsWith("EFFECTS/") || name.startsWith("NORMAL/");
+
+        if (name.contains("/ALT TUNE/") || name.contains("/SEQ") || leaf.contains("STEP"))
+        {
+            return FINEDETAIL;
+        }
+        if (isSoundBlock && (leaf.endsWith("ON_OFF") || leaf.contains("LEVEL") || leaf == "BPM"))
+        {
+            return AUDIBLE;
+        }
+        if (leaf.contains("TYPE"))
+        {
+            return TYPE;
+        }
+        return DETAIL;
+    }
+
+    int getTier(const juce::String& hexAddress) const
+    {
+        if (mTierByAddress.contains(hexAddress))
+        {
+            return mTierByAddress[hexAddress];
+        }
+        return DETAIL;
+    }
+
+    struct Write
+    {
+        juce::String hexAddress;
+        juce::MidiMessage message;
+        int tier = DETAIL;
+        double timeStamp = 0.0;  // Time::getMillisecondCounterHiRes() of the originating change
+        double changeTime = -1.0; // block time of the change if it was made by processBlock, -1 if before the block
+        juce::uint32 beginAddress = 0;  // linear address range of the data bytes
+        juce::uint32 endAddress = 0;
+    };
+
+    // Queue a write. A pending write to the same address is replaced, only the latest value matters.
+    // The write is stamped with the time of the originating change, changeTime places it in the audio block.
+    // A write into the range of a pending packet is queued behind the packet, the packet must not overwrite it.
+    void addWrite(const juce::String& hexAddress, const juce::MidiMessage& message, double changeTime = -1.0)
+    {
+        double timeStamp = juce::Time::getMillisecondCounterHiRes();
+        juce::uint32 beginAddress = toLinearAddress(hexAddress);
+        juce::uint32 endAddress = beginAddress + (juce::uint32)juce::jmax(0, message.getSysExDataSize() - 12);
+        if (isInPendingPacket(beginAddress))
+        {
+            addPacket(hexAddress, message, beginAddress, endAddress, changeTime);
+            return;
+        }
+        if (mPendingWrite.contains(hexAddress))
+        {
+            Write* write = mPendingWrite[hexAddress];
+            mPendingBytes += message.getRawDataSize() - write->message.getRawDataSize();
+            write->message = message;
+            write->timeStamp = timeStamp;
+            write->changeTime = changeTime;
+            return;
+        }
+        int tier = getTier(hexAddress);
+        mPending[tier].push_back({ hexAddress, message, tier, timeStamp, changeTime, beginAddress, endAddress });
+        mPendingWrite.set(hexAddress, &mPending[tier].back());
+        mPendingBytes += message.getRawDataSize();
+    }
+
+    // Queue a packed DT1 (or any other message that must not be merged) covering the linear addresses
+    // [beginAddress, endAddress). Packets go out in call order, before the single writes of the tiers.
+    // Pending single writes inside the range are dropped, the packet carries newer values.
+    void addPacket(const juce::String& hexAddress, const juce::MidiMessage& message, juce::uint32 beginAddress, juce::uint32 endAddress, double changeTime = -1.0)
+    {
+        if (endAddress > beginAddress)
+            removeWrites(beginAddress, endAddress);
+        mPackets.push_back({ hexAddress, message, AUDIBLE, juce::Time::getMillisecondCounterHiRes(), changeTime, beginAddress, endAddress });
+        mPendingBytes += message.getRawDataSize();
+    }
+
+    bool isInPendingPacket(juce::uint32 linearAddress) const
+    {
+        for (auto& packet : mPackets)
+        {
+            if (linearAddress >= packet.beginAddress && linearAddress < packet.endAddress)
+                return true;
+        }
+        return false;
+    }
+
+    bool isInPendingPacket(const juce::String& hexAddress) const
+    {
+        return isInPendingPacket(toLinearAddress(hexAddress));
+    }
+
+    // Update a pending write without queueing a new one, e.g. after the value was sent on another lane
+    void replaceIfPending(const juce::String& hexAddress, const juce::MidiMessage& message)
+    {
+        if (mPendingWrite.contains(hexAddress))
+        {
+            Write* write = mPendingWrite[hexAddress];
+            mPendingBytes += message.getRawDataSize() - write->message.getRawDataSize();
+            write->message = message;
+        }
+    }
+
+    bool isEmpty() const
+    {
+        if (!mPackets.empty())
+            return false;
+        for (auto& tierWrites : mPending)
+        {
+            if (!tierWrites.empty())
+                return false;
+        }
+        return true;
+    }
+
+    // Next write: the packets in call order, then the single writes in tier order. Within a tier the call order is kept.
+    const Write& front() const
+    {
+        if (!mPackets.empty())
+            return mPackets.front();
+        for (auto& tierWrites : mPending)
+        {
+            if (!tierWrites.empty())
+                return tierWrites.front();
+        }
+        jassertfalse;
+        return mPending[0].front();
+    }
+
+    void popFront()
+    {
+        if (!mPackets.empty())
+        {
+            mPendingBytes -= mPackets.front().message.getRawDataSize();
+            mPackets.pop_front();
+            return;
+        }
+        for (auto& tierWrites : mPending)
+        {
+            if (!tierWrites.empty())
+            {
+                mPendingWrite.remove(tierWrites.front().hexAddress);
+                mPendingBytes -= tierWrites.front().message.getRawDataSize();
+                tierWrites.pop_front();
+                return;
+            }
+        }
+    }
+
+    int getNumPending() const
+    {
+        int numPending = (int)mPackets.size();
+        for (auto& tierWrites : mPending)
+            numPending += (int)tierWrites.size();
+        return numPending;
+    }
+
+    // Bytes of all pending messages, readable from any thread
+    int getNumPendingBytes() const
+    {
+        return mPendingBytes;
+    }
+
+    void clear()
+    {
+        for (auto& tierWrites : mPending)
+            tierWrites.clear();
+        mPendingWrite.clear();
+        mPackets.clear();
+        mPendingBytes = 0;
+    }
+
+private:
+
+    static juce::uint32 toLinearAddress(const juce::String& hexAddress)
+    {
+        return SY1000Parameter::toLinearAddress((juce::uint32)hexAddress.substring(0, 8).getHexValue32());
+    }
+
+    // Drops the pending single writes that start inside the range
+    void removeWrites(juce::uint32 beginAddress, juce::uint32 endAddress)
+    {
+        bool isRemoved = false;
+        for (auto& tierWrites : mPending)
+        {
+            auto end = std::remove_if(tierWrites.begin(), tierWrites.end(), [&](const Write& write)
+            {
+                bool isInRange = write.beginAddress >= beginAddress && write.beginAddress < endAddress;
+                if (isInRange)
+                    mPendingBytes -= write.message.getRawDataSize();
+                return isInRange;
+            });
+            isRemoved = isRemoved || end != tierWrites.end();
+            tierWrites.erase(end, tierWrites.end());
+        }
+        if (!isRemoved)
+            return;
+
+        // erasing inside a std::deque moves the elements
+        mPendingWrite.clear();
+        for (auto& tierWrites : mPending)
+        {
+            for (auto& write : tierWrites)
+                mPendingWrite.set(write.hexAddress, &write);
+        }
+    }
+
+    juce::HashMap<juce::String, int> mTierByAddress;
+    // std::deque keeps the element addresses stable on push_back/pop_front
+    std::deque<Write> mPending[numTiers];
+    juce::HashMap<juce::String, Write*> mPendingWrite;
+    // packed DT1s, never merged by address
+    std::deque<Write> mPackets;
+    std::atomic<int> mPendingBytes { 0 };
+};
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    Unit tests of the SY1000 engine classes, run by a juce::UnitTestRunner in a
+    build with JUCE_UNIT_TESTS=1.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "SharedDevice.h"
+#include "ParameterSearchIndex.h"
+
+#if JUCE_UNIT_TESTS
+
+//==============================================================================
+class SY1000SharedDeviceTests  : public juce::UnitTest
+{
+public:
+    SY1000SharedDeviceTests() : juce::UnitTest("SY1000SharedDevice", "SY1000") {}
+
+    void runTest() override
+    {
+        SY1000SharedDevice device;
+        int instanceA = 0;
+        int instanceB = 0;
+
+        beginTest("The first prepared instance owns the output");
+        expect(device.prepareInstance(&instanceA));
+        expect(!device.prepareInstance(&instanceB));
+        double timeMs = juce::Time::getMillisecondCounterHiRes();
+        expect(device.claimOutput(&instanceA, timeMs));
+        expect(!device.claimOutput(&instanceB, timeMs + 10.0));
+
+        beginTest("An owner that stopped processing loses the output");
+        // the host no longer calls instance A (inactive rackspace), instance B keeps processing
+        expect(!device.claimOutput(&instanceB, timeMs + SY1000SharedDevice::ownerTimeoutMs - 1.0));
+        expect(device.claimOutput(&instanceB, timeMs + SY1000SharedDevice::ownerTimeoutMs + 1.0));
+        expect(device.claimOutput(&instanceB, timeMs + SY1000SharedDevice::ownerTimeoutMs + 20.0));
+        // A processes again, B is still processing and keeps the output
+        expect(!device.claimOutput(&instanceA, timeMs + SY1000SharedDevice::ownerTimeoutMs + 30.0));
+
+        beginTest("releaseInstance hands the output over");
+        device.releaseInstance(&instanceB);
+        expect(device.claimOutput(&instanceA, juce::Time::getMillisecondCounterHiRes()));
+        device.releaseInstance(&instanceA);
+    }
+};
+
+static SY1000SharedDeviceTests sharedDeviceTests;
+
+//==============================================================================
+class SY1000ParameterSearchIndexTests  : public juce::UnitTest
+{
+public:
+    SY1000ParameterSearchIndexTests() : juce::UnitTest("SY1000ParameterSearchIndex", "SY1000") {}
+
+    void runTest() override
+    {
+        SY1000Parameter parameter;
+        SY1000ParameterSearchIndex index(parameter);
+
+        beginTest("Every parameter is found by its unique name");
+        int numMismatches = 0;
+        for (int i = 0; i < (int)parameter.size(); i++)
+        {
+            if (index.getParameterIndex(index.getUniqueName(i)) != i)
+                numMismatches++;
+        }
+        expectEquals(numMismatches, 0);
+
+        beginTest("An ambiguous name returns every match");
+        std::vector<int> indices = index.getParameterIndices("CTL/ON OFF STATE");
+        expectEquals((int)indices.size(), 2);
+        expectEquals(index.getParameterIndex("CTL/ON OFF STATE"), -1);
+        for (int parameterIndex : indices)
+        {
+            expectEquals(parameter.getParameterData(parameterIndex).parameterName, juce::String("CTL/ON OFF STATE"));
+            expect(index.getUniqueName(parameterIndex) != "CTL/ON OFF STATE");
+        }
+        expectEquals(index.getParameterIndex("ctl/on off state [1000031a]"), indices[1]);
+
+        beginTest("The LFO rates of the dynamic synth have their own names");
+        for (auto prefix : { "INST1", "INST2", "INST3" })
+        {
+            int lfo1 = index.getParameterIndex(juce::String(prefix) + "/DYNAMIC SYNTH/LFO1/RATE BPM");
+            int lfo2 = index.getParameterIndex(juce::String(prefix) + "/DYNAMIC SYNTH/LFO2/RATE BPM");
+            expect(lfo1 >= 0 && lfo2 >= 0 && lfo1 != lfo2);
+        }
+    }
+};
+
+static SY1000ParameterSearchIndexTests parameterSearchIndexTests;
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+#include <JuceHeader.h>
+#include "Parameter.h"
+
+// Integer value of every parameter, indexed like SY1000Param. This is the value the plugin works with:
+// the device value of numeric parameters and the choice index of choice parameters.
+// The SysEx and the host paths compare and store plain integers here, the normalised host value is only
+// calculated when the host has to be notified, so values never drift by float round trips (e.g. TIME 1..2018).
+class SY1000ValueStore
+{
+public:
+
+    SY1000ValueStore(const SY1000Parameter& parameter)
+        : mNumValues(parameter.size()), mValues(new std::atomic<int>[parameter.size()])
+    {
+        for (size_t i = 0; i < mNumValues; i++)
+            mValues[i] = getDefaultValue(parameter.getParameterData((int)i));
+    }
+
+    // Default value as the host parameter has it: clamped to the choice indices or to the value range
+    // (the table has defaults outside the range, e.g. master BPM default 0 with minimum 400)
+    static int getDefaultValue(const SY1000Parameter::Data& data)
+    {
+        if (data.choices.size() > 0)
+            return juce::jlimit(0, data.choices.size() - 1, data.defaultValue);
+        return juce::jlimit(data.minValue, data.maxValue, data.defaultValue);
+    }
+
+    int get(int parameterIndex) const
+    {
+        return isValidIndex(parameterIndex) ? mValues[(size_t)parameterIndex].load() : 0;
+    }
+
+    // Returns true if the value has changed
+    bool set(int parameterIndex, int value)
+    {
+        return isValidIndex(parameterIndex) && mValues[(size_t)parameterIndex].exchange(value) != value;
+    }
+
+    // Copy of all values, e.g. as the base of a patch diff
+    std::vector<int> getSnapshot() const
+    {
+        std::vector<int> snapshot(mNumValues);
+        for (size_t i = 0; i < mNumValues; i++)
+            snapshot[i] = mValues[i].load();
+        return snapshot;
+    }
+
+    bool isValidIndex(int parameterIndex) const
+    {
+        return parameterIndex >= 0 && (size_t)parameterIndex < mNumValues;
+    }
+
+private:
+
+    size_t mNumValues;
+    std::unique_ptr<std::atomic<int>[]> mValues;
+};
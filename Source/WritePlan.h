@@ -0,0 +1,130 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AddressIndex.h"
+#include "SysExCodec.h"
+
+// Collects parameter values for the device and packs them into as few DT1 messages as possible:
+// the values are sorted by address and every run of contiguous addresses becomes one DT1.
+class SY1000WritePlan
+{
+public:
+
+    struct Packet
+    {
+        juce::String hexAddress;
+        juce::MidiMessage message;
+        int numParameters = 0;
+        juce::uint32 beginAddress = 0;  // linear address range of the data bytes
+        juce::uint32 endAddress = 0;
+    };
+
+    // Upper limit of the data bytes per DT1, longer runs are split. The caller passes a lower limit that
+    // fits the link: a packet on the wire delays every real-time write behind it.
+    static constexpr int maxDataBytes = 128;
+    // F0, manufacturer, device, model, command, address, checksum, F7
+    static constexpr int overheadBytes = 14;
+
+    SY1000WritePlan(const SY1000AddressIndex& addressIndex) : mAddressIndex(addressIndex) {}
+
+    // parameterValue as stored in SY1000ValueStore. Parameters without an own address are ignored.
+    void add(int parameterIndex, int parameterValue)
+    {
+        if (mAddressIndex.isWritable(parameterIndex))
+            mWrites.push_back({ parameterIndex, parameterValue, (int)mWrites.size() });
+    }
+
+    bool isEmpty() const
+    {
+        return mWrites.empty();
+    }
+
+    void clear()
+    {
+        mWrites.clear();
+    }
+
+    // Capacity for numWrites values, add() does not allocate below it
+    void reserve(int numWrites)
+    {
+        mWrites.reserve((size_t)numWrites);
+    }
+
+    std::vector<Packet> build(int maxPacketDataBytes = maxDataBytes) const
+    {
+        SY1000WritePlan writePlan(*this);
+        std::vector<Packet> packets;
+        writePlan.build(packets, maxPacketDataBytes);
+        return packets;
+    }
+
+    // Packs into packets (cleared first) and sorts the collected values in place. Apart from the DT1
+    // messages nothing is allocated once the plan and packets have their capacity (macro changes on the
+    // audio thread).
+    void build(std::vector<Packet>& packets, int maxPacketDataBytes = maxDataBytes)
+    {
+        maxPacketDataBytes = juce::jlimit(1, maxDataBytes, maxPacketDataBytes);
+        // by address, a later value of the same parameter wins
+        std::sort(mWrites.begin(), mWrites.end(), [this](const Write& a, const Write& b)
+        {
+            juce::uint32 addressA = mAddressIndex.getLayout(a.parameterIndex).linearAddress;
+            juce::uint32 addressB = mAddressIndex.getLayout(b.parameterIndex).linearAddress;
+            return addressA != addressB ? addressA < addressB : a.order < b.order;
+        });
+
+        packets.clear();
+        juce::uint8 data[maxDataBytes];
+        int numDataBytes = 0;
+        juce::uint32 startAddress = 0;
+        juce::uint32 endAddress = 0;
+        int numParameters = 0;
+
+        auto flush = [&]()
+        {
+            if (numDataBytes == 0)
+                return;
+            Packet packet;
+            juce::uint32 address = SY1000AddressIndex::fromLinear(startAddress);
+            packet.hexAddress = juce::String::toHexString((juce::int64)address).paddedLeft('0', 8).toUpperCase();
+            packet.message = SY1000SysExCodec::createDT1(address, data, numDataBytes);
+            packet.numParameters = numParameters;
+            packet.beginAddress = startAddress;
+            packet.endAddress = startAddress + (juce::uint32)numDataBytes;
+            packets.push_back(packet);
+            numDataBytes = 0;
+            numParameters = 0;
+        };
+
+        for (size_t i = 0; i < mWrites.size(); i++)
+        {
+            if (i + 1 < mWrites.size() && mWrites[i + 1].parameterIndex == mWrites[i].parameterIndex)
+                continue;
+
+            const SY1000AddressIndex::Entry& layout = mAddressIndex.getLayout(mWrites[i].parameterIndex);
+            if (!SY1000SysExCodec::isSupportedWidth(layout.dataBytes))
+                continue;
+            if (numDataBytes == 0 || layout.linearAddress != endAddress || numDataBytes + layout.dataBytes > maxPacketDataBytes)
+            {
+                flush();
+                startAddress = layout.linearAddress;
+            }
+
+            SY1000SysExCodec::encode(layout.dataBytes, mWrites[i].parameterValue + layout.valueOffset, data + numDataBytes);
+            numDataBytes += layout.dataBytes;
+            endAddress = layout.linearAddress + (juce::uint32)layout.dataBytes;
+            numParameters++;
+        }
+        flush();
+    }
+
+private:
+
+    struct Write
+    {
+        int parameterIndex;
+        int parameterValue;
+        int order;      // call order, keeps the sort stable without a merge buffer
+    };
+
+    const SY1000AddressIndex& mAddressIndex;
+    std::vector<Write> mWrites;
+};